@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_arena_allocator c++ arena allocator
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_ARENA_ALLOCATOR_H
+#define _LOS_ARENA_ALLOCATOR_H
+
+#include "los_arena.h"
+
+#if defined(__cplusplus) && (LOSCFG_MEM_ARENA == 1)
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/**
+ * @ingroup los_arena_allocator
+ * Allocator for standard containers that allocates from an arena created by LOS_ArenaCreate.
+ *
+ * deallocate does nothing, the memory is given back when the arena is reset or destroyed, which must
+ * happen after the containers using it are destroyed. Copies, and rebinds to other types, share the arena.
+ */
+template <typename T>
+class LosArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit LosArenaAllocator(VOID *arena) noexcept : arena_(arena) {}
+
+    template <typename U>
+    LosArenaAllocator(const LosArenaAllocator<U> &other) noexcept : arena_(other.Arena()) {}
+
+    T *allocate(std::size_t n)
+    {
+        VOID *ptr = NULL;
+
+        if (n <= (OS_NULL_INT / sizeof(T))) {
+            ptr = LOS_ArenaAllocAlign(arena_, static_cast<UINT32>(n * sizeof(T)), alignof(T));
+        }
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+        if (ptr == NULL) {
+            throw std::bad_alloc();
+        }
+#endif
+        return static_cast<T *>(ptr);
+    }
+
+    void deallocate(T *ptr, std::size_t n) noexcept
+    {
+        (VOID)ptr;
+        (VOID)n;
+    }
+
+    VOID *Arena() const noexcept
+    {
+        return arena_;
+    }
+
+private:
+    VOID *arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const LosArenaAllocator<T> &lhs, const LosArenaAllocator<U> &rhs) noexcept
+{
+    return lhs.Arena() == rhs.Arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const LosArenaAllocator<T> &lhs, const LosArenaAllocator<U> &rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * @ingroup los_arena_allocator
+ * Resets an arena when it goes out of scope, so that everything allocated from it within a request is
+ * freed in one call however the request ends.
+ */
+class LosArenaScope {
+public:
+    explicit LosArenaScope(VOID *arena) noexcept : arena_(arena) {}
+
+    ~LosArenaScope()
+    {
+        (VOID)LOS_ArenaReset(arena_);
+    }
+
+    LosArenaScope(const LosArenaScope &) = delete;
+    LosArenaScope &operator=(const LosArenaScope &) = delete;
+
+    /* Constructs an object in the arena. Its destructor is never run, so it should not own other resources. */
+    template <typename T, typename... Args>
+    T *New(Args &&...args)
+    {
+        VOID *ptr = LOS_ArenaAllocAlign(arena_, sizeof(T), alignof(T));
+        if (ptr == NULL) {
+            return NULL;
+        }
+        return new (ptr) T(std::forward<Args>(args)...);
+    }
+
+    VOID *Arena() const noexcept
+    {
+        return arena_;
+    }
+
+private:
+    VOID *arena_;
+};
+#endif
+
+#endif /* _LOS_ARENA_ALLOCATOR_H */
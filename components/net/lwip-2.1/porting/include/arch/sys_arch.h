@@ -32,6 +32,7 @@
 #ifndef _LWIP_PORTING_SYS_ARCH_H_
 #define _LWIP_PORTING_SYS_ARCH_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -63,6 +64,13 @@ typedef void *sys_prot_t;
  */
 typedef uint32_t sys_thread_t;
 
+/**
+ * Heap
+ */
+void *sys_mem_malloc(size_t size);
+void *sys_mem_calloc(size_t count, size_t size);
+void sys_mem_free(void *mem);
+
 #ifdef __cplusplus
 }
 #endif
@@ -37,6 +37,7 @@
 #include <los_queue.h>
 #include <los_sem.h>
 #include <los_mux.h>
+#include <los_memory.h>
 #include "cmsis_os2.h"
 #include <los_tick.h>
 #include <los_config.h>
@@ -324,6 +325,35 @@ void sys_mutex_set_invalid(sys_mutex_t *mutex)
     *mutex = LOSCFG_BASE_IPC_MUX_LIMIT;
 }
 
+/**
+ * Heap, in the fast memory tier of the system memory pool when it has one, as packet buffers live there
+ */
+void *sys_mem_malloc(size_t size)
+{
+    return LOS_MemAllocHint(OS_SYS_MEM_ADDR, (UINT32)size, LOS_MEM_HINT_FAST);
+}
+
+void *sys_mem_calloc(size_t count, size_t size)
+{
+    size_t realSize = count * size;
+    void *mem = NULL;
+
+    if ((count == 0) || (size == 0) || ((realSize / count) != size)) {
+        return NULL;
+    }
+
+    mem = sys_mem_malloc(realSize);
+    if (mem != NULL) {
+        (void)memset_s(mem, realSize, 0, realSize);
+    }
+    return mem;
+}
+
+void sys_mem_free(void *mem)
+{
+    (void)LOS_MemFree(OS_SYS_MEM_ADDR, mem);
+}
+
 void HilogPrintf(const char *fmt, ...)
 {
     if ((fmt == NULL) || (strlen(fmt) == 0)) {
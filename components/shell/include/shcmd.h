@@ -94,6 +94,10 @@ extern int VfsNormalizePath(const char *directory, const char *filename, char **
 extern INT32 OsShellCmdDate(INT32 argc, const CHAR **argv);
 extern INT32 OsShellCmdDumpTask(INT32 argc, const CHAR **argv);
 extern UINT32 OsShellCmdFree(INT32 argc, const CHAR **argv);
+extern UINT32 OsShellCmdMemUsage(INT32 argc, const CHAR **argv);
+#if (LOSCFG_MEM_PROFILE == 1)
+extern UINT32 OsShellCmdMemProfile(INT32 argc, const CHAR **argv);
+#endif
 extern UINT32 lwip_ifconfig(INT32 argc, const CHAR **argv);
 extern UINT32 OsShellPing(INT32 argc, const CHAR **argv);
 extern INT32 OsShellCmdTouch(INT32 argc, const CHAR **argv);
@@ -32,6 +32,7 @@
 #include "stdlib.h"
 #include "shcmd.h"
 #include "shell.h"
+#include "los_memory.h"
 
 #define MEM_SIZE_1K 0x400
 #define MEM_SIZE_1M 0x100000
@@ -78,3 +79,88 @@ LITE_OS_SEC_TEXT_MINOR UINT32 OsShellCmdFree(INT32 argc, const CHAR *argv[])
     return 0;
 }
 
+LITE_OS_SEC_TEXT_MINOR STATIC VOID OsShellCmdMemGapShow(const LOS_MEM_FRAG_GAP *gap)
+{
+    PRINTK("0x%-10x    %-10p    %-10p\n", gap->size, gap->prevUsed, gap->nextUsed);
+#if (LOSCFG_MEM_LEAKCHECK == 1)
+    UINT32 index;
+    for (index = 0; index < LOSCFG_MEM_RECORD_LR_CNT; index++) {
+        PRINTK("    LR[%u]: prev 0x%x  next 0x%x\n", index, gap->prevLR[index], gap->nextLR[index]);
+    }
+#endif
+}
+
+LITE_OS_SEC_TEXT_MINOR UINT32 OsShellCmdMemUsage(INT32 argc, const CHAR *argv[])
+{
+    LOS_MEM_FRAG_INFO fragInfo;
+    UINT32 index;
+
+    (VOID)argv;
+    if (argc != 0) {
+        PRINTK("\nUsage: memusage\n");
+        return OS_ERROR;
+    }
+
+    if (LOS_MemFragInfoGet(m_aucSysMem0, &fragInfo) != LOS_OK) {
+        return OS_ERROR;
+    }
+
+    PRINTK("\r\nfree size     max free node    free node num    max free ratio\n");
+    PRINTK("0x%-10x    0x%-10x     %-13u    %u%%\n", fragInfo.totalFreeSize, fragInfo.maxFreeNodeSize,
+           fragInfo.freeNodeNum, fragInfo.maxFreeRatio);
+
+    PRINTK("\nfree node size             num\n");
+    for (index = 0; index < LOS_MEM_FRAG_CLASS_NUM; index++) {
+        if (fragInfo.freeNodeHist[index] != 0) {
+            PRINTK("[0x%-8x, 0x%-8x]   %u\n", 1U << index, (UINT32)((2ULL << index) - 1),
+                   fragInfo.freeNodeHist[index]);
+        }
+    }
+
+    PRINTK("\nlargest free nodes and the allocations around them\n");
+    PRINTK("size            prev used     next used\n");
+    for (index = 0; (index < LOS_MEM_FRAG_GAP_NUM) && (fragInfo.gap[index].size != 0); index++) {
+        OsShellCmdMemGapShow(&fragInfo.gap[index]);
+    }
+    return 0;
+}
+
+#if (LOSCFG_MEM_PROFILE == 1)
+#define MEM_PROFILE_SHOW_NUM 10
+
+LITE_OS_SEC_TEXT_MINOR UINT32 OsShellCmdMemProfile(INT32 argc, const CHAR *argv[])
+{
+    LOS_MEM_PROFILE_SITE sites[MEM_PROFILE_SHOW_NUM];
+    UINT32 num = MEM_PROFILE_SHOW_NUM;
+    UINT32 index;
+    UINT32 count;
+    CHAR *end = NULL;
+
+    if (argc == 1) {
+        num = (UINT32)strtoul(argv[0], &end, 0);
+    }
+    if ((argc > 1) || ((argc == 1) && (*end != '\0')) || (num == 0) || (num > MEM_PROFILE_SHOW_NUM)) {
+        PRINTK("\nUsage: memprofile [1-%u]\n", MEM_PROFILE_SHOW_NUM);
+        return OS_ERROR;
+    }
+
+    if (LOS_MemProfileGet(sites, &num) != LOS_OK) {
+        return OS_ERROR;
+    }
+
+    PRINTK("\r\nlive size     live num      alloc num     peak size     ");
+    for (count = 0; count < LOSCFG_MEM_RECORD_LR_CNT; count++) {
+        PRINTK("    LR[%u]   ", count);
+    }
+    PRINTK("\n");
+    for (index = 0; index < num; index++) {
+        PRINTK("0x%-10x    %-10u    %-10u    0x%-10x", sites[index].liveSize, sites[index].liveCount,
+               sites[index].allocCount, sites[index].peakSize);
+        for (count = 0; count < LOSCFG_MEM_RECORD_LR_CNT; count++) {
+            PRINTK("  0x%-8x", sites[index].linkReg[count]);
+        }
+        PRINTK("\n");
+    }
+    return 0;
+}
+#endif
@@ -142,20 +142,20 @@ STATIC VOID LOS_TraceMuxCreate(const LosMuxCB *muxCB)
 
 STATIC VOID LOS_TraceMuxPost(const LosMuxCB *muxCB)
 {
-    LOS_TRACE(MUX_POST, muxCB->muxID, muxCB->muxCount,
-                (muxCB->owner == NULL) ? 0xffffffff : muxCB->owner->taskID);
+    LOS_TRACE(MUX_POST, muxCB->muxID, OsMuxCountGet(muxCB),
+                (muxCB->lockWord == OS_MUX_WORD_FREE) ? 0xffffffff : OS_MUX_WORD_TID(muxCB->lockWord));
 }
 
 STATIC VOID LOS_TraceMuxPend(const LosMuxCB *muxCB, UINT32 timeout)
 {
-    LOS_TRACE(MUX_PEND, muxCB->muxID, muxCB->muxCount,
-                (muxCB->owner == NULL) ? 0xffffffff : muxCB->owner->taskID, timeout);
+    LOS_TRACE(MUX_PEND, muxCB->muxID, OsMuxCountGet(muxCB),
+                (muxCB->lockWord == OS_MUX_WORD_FREE) ? 0xffffffff : OS_MUX_WORD_TID(muxCB->lockWord), timeout);
 }
 
 STATIC VOID LOS_TraceMuxDelete(const LosMuxCB *muxCB)
 {
-    LOS_TRACE(MUX_DELETE, muxCB->muxID, muxCB->muxStat, muxCB->muxCount,
-                (muxCB->owner == NULL) ? 0xffffffff : muxCB->owner->taskID);
+    LOS_TRACE(MUX_DELETE, muxCB->muxID, muxCB->muxStat, OsMuxCountGet(muxCB),
+                (muxCB->lockWord == OS_MUX_WORD_FREE) ? 0xffffffff : OS_MUX_WORD_TID(muxCB->lockWord));
 }
 
 STATIC VOID LOS_TraceTaskCreate(const LosTaskCB *taskCB)
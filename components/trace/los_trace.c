@@ -31,6 +31,7 @@
 
 #include "los_trace_pri.h"
 #include "trace_pipeline.h"
+#include "los_atomic.h"
 #include "los_memory.h"
 #include "los_config.h"
 #include "securec.h"
@@ -52,7 +53,7 @@ extern "C" {
 #endif /* __cplusplus */
 
 #if (LOSCFG_KERNEL_TRACE == 1)
-LITE_OS_SEC_BSS STATIC UINT32 g_traceEventCount;
+LITE_OS_SEC_BSS STATIC Atomic g_traceEventCount;
 LITE_OS_SEC_BSS STATIC volatile enum TraceState g_traceState = TRACE_UNINIT;
 LITE_OS_SEC_DATA_INIT STATIC volatile BOOL g_enableTrace = FALSE;
 LITE_OS_SEC_BSS STATIC UINT32 g_traceMask = TRACE_DEFAULT_MASK;
@@ -97,6 +98,10 @@ STATIC VOID OsTraceSetFrame(TraceEventFrame *frame, UINT32 eventType, UINTPTR id
         paramCount = LOSCFG_TRACE_FRAME_MAX_PARAMS;
     }
 
+#if (LOSCFG_TRACE_FRAME_EVENT_COUNT == 1)
+    frame->eventCount = (UINT32)LOS_AtomicIncRet(&g_traceEventCount) - 1;
+#endif
+
     TRACE_LOCK(intSave);
     frame->curTask   = OsTraceGetMaskTid(LOS_CurTaskIDGet());
     frame->identity  = identity;
@@ -110,10 +115,6 @@ STATIC VOID OsTraceSetFrame(TraceEventFrame *frame, UINT32 eventType, UINTPTR id
     frame->core.paramCount = paramCount;
 #endif
 
-#if (LOSCFG_TRACE_FRAME_EVENT_COUNT == 1)
-    frame->eventCount = g_traceEventCount;
-    g_traceEventCount++;
-#endif
     TRACE_UNLOCK(intSave);
 
     for (i = 0; i < paramCount; i++) {
@@ -275,7 +276,7 @@ UINT32 LOS_TraceInit(VOID *buf, UINT32 size)
     OsTraceHookInstall();
     OsTraceCnvInit();
 
-    g_traceEventCount = 0;
+    LOS_AtomicSet(&g_traceEventCount, 0);
 
 #if (LOSCFG_RECORDER_MODE_ONLINE == 1)  /* Wait trace client to start trace */
     g_enableTrace = FALSE;
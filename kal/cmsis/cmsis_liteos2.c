@@ -37,6 +37,7 @@
 #include "los_interrupt.h"
 #include "los_mux.h"
 #include "los_queue.h"
+#include "los_sched.h"
 #include "los_sem.h"
 #include "los_swtmr.h"
 #include "los_task.h"
@@ -1052,7 +1053,7 @@ osThreadId_t osMutexGetOwner(osMutexId_t mutex_id)
     }
 
     intSave = LOS_IntLock();
-    pstTaskCB = ((LosMuxCB *)mutex_id)->owner;
+    pstTaskCB = OsMuxOwnerGet((LosMuxCB *)mutex_id);
     LOS_IntRestore(intSave);
 
     return (osThreadId_t)pstTaskCB;
@@ -1207,14 +1208,22 @@ osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, cons
 {
     UINT32 uwQueueID;
     UINT32 uwRet;
-    UNUSED(attr);
+    UINT32 uwBufferSize;
     osMessageQueueId_t handle;
 
     if (0 == msg_count || 0 == msg_size || OS_INT_ACTIVE) {
         return (osMessageQueueId_t)NULL;
     }
 
-    uwRet = LOS_QueueCreate((char *)NULL, (UINT16)msg_count, &uwQueueID, 0, (UINT16)msg_size);
+    if ((attr != NULL) && (attr->attr_bits & osMessageQueueVarLen)) {
+        uwBufferSize = (attr->mq_size != 0) ? attr->mq_size : (msg_count * OS_QUEUE_MSGBUF_NODE_SIZE(msg_size));
+        if (uwBufferSize > OS_NULL_SHORT) {
+            return (osMessageQueueId_t)NULL;
+        }
+        uwRet = LOS_QueueCreateMsgBuf((char *)NULL, (UINT16)uwBufferSize, &uwQueueID, 0, (UINT16)msg_size);
+    } else {
+        uwRet = LOS_QueueCreate((char *)NULL, (UINT16)msg_count, &uwQueueID, 0, (UINT16)msg_size);
+    }
     if (uwRet == LOS_OK) {
         handle = (osMessageQueueId_t)(GET_QUEUE_HANDLE(uwQueueID));
     } else {
@@ -1227,19 +1236,31 @@ osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, cons
 
 osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
 {
-    UNUSED(msg_prio);
-    UINT32 uwRet;
-    UINT32 uwBufferSize;
     LosQueueCB *pstQueue = (LosQueueCB *)mq_id;
 
-    if (pstQueue == NULL || msg_ptr == NULL || ((OS_INT_ACTIVE) && (0 != timeout))) {
+    if (pstQueue == NULL) {
         return osErrorParameter;
     }
     if (pstQueue->queueSize < sizeof(UINT32)) {
         return osErrorParameter;
     }
-    uwBufferSize = (UINT32)(pstQueue->queueSize - sizeof(UINT32));
-    uwRet = LOS_QueueWriteCopy((UINT32)pstQueue->queueID, (void *)msg_ptr, uwBufferSize, timeout);
+
+    return osMessageQueuePutExt(mq_id, msg_ptr, (UINT32)(pstQueue->queueSize - sizeof(UINT32)), msg_prio, timeout);
+}
+
+
+osStatus_t osMessageQueuePutExt(osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_len, uint8_t msg_prio,
+                                uint32_t timeout)
+{
+    UNUSED(msg_prio);
+    UINT32 uwRet;
+    LosQueueCB *pstQueue = (LosQueueCB *)mq_id;
+
+    if (pstQueue == NULL || msg_ptr == NULL || msg_len == 0 || ((OS_INT_ACTIVE) && (0 != timeout))) {
+        return osErrorParameter;
+    }
+
+    uwRet = LOS_QueueWriteCopy((UINT32)pstQueue->queueID, (void *)msg_ptr, msg_len, timeout);
     if (uwRet == LOS_OK) {
         return osOK;
     } else if (uwRet == LOS_ERRNO_QUEUE_INVALID || uwRet == LOS_ERRNO_QUEUE_NOT_CREATE) {
@@ -1254,17 +1275,30 @@ osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint
 
 osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
 {
-    UNUSED(msg_prio);
-    UINT32 uwRet;
     UINT32 uwBufferSize;
     LosQueueCB *pstQueue = (LosQueueCB *)mq_id;
 
-    if (pstQueue == NULL || msg_ptr == NULL || ((OS_INT_ACTIVE) && (0 != timeout))) {
+    if (pstQueue == NULL) {
         return osErrorParameter;
     }
 
     uwBufferSize = (UINT32)(pstQueue->queueSize - sizeof(UINT32));
-    uwRet = LOS_QueueReadCopy((UINT32)pstQueue->queueID, msg_ptr, &uwBufferSize, timeout);
+    return osMessageQueueGetExt(mq_id, msg_ptr, &uwBufferSize, msg_prio, timeout);
+}
+
+
+osStatus_t osMessageQueueGetExt(osMessageQueueId_t mq_id, void *msg_ptr, uint32_t *msg_len, uint8_t *msg_prio,
+                                uint32_t timeout)
+{
+    UNUSED(msg_prio);
+    UINT32 uwRet;
+    LosQueueCB *pstQueue = (LosQueueCB *)mq_id;
+
+    if (pstQueue == NULL || msg_ptr == NULL || msg_len == NULL || ((OS_INT_ACTIVE) && (0 != timeout))) {
+        return osErrorParameter;
+    }
+
+    uwRet = LOS_QueueReadCopy((UINT32)pstQueue->queueID, msg_ptr, (UINT32 *)msg_len, timeout);
     if (uwRet == LOS_OK) {
         return osOK;
     } else if (uwRet == LOS_ERRNO_QUEUE_INVALID || uwRet == LOS_ERRNO_QUEUE_NOT_CREATE) {
@@ -1283,6 +1317,9 @@ uint32_t osMessageQueueGetCapacity(osMessageQueueId_t mq_id)
 
     if (pstQueue == NULL) {
         capacity = 0U;
+    } else if (pstQueue->queueType == OS_QUEUE_TYPE_MSGBUF) {
+        /* messages of the maximum size that fit in the buffer */
+        capacity = pstQueue->queueLen / OS_QUEUE_MSGBUF_NODE_SIZE(pstQueue->queueSize - sizeof(UINT32));
     } else {
         capacity = pstQueue->queueLen;
     }
@@ -1333,6 +1370,9 @@ uint32_t osMessageQueueGetSpace(osMessageQueueId_t mq_id)
     } else {
         intSave = LOS_IntLock();
         space = (uint32_t)pstQueue->readWriteableCnt[OS_QUEUE_WRITE];
+        if (pstQueue->queueType == OS_QUEUE_TYPE_MSGBUF) {
+            space /= OS_QUEUE_MSGBUF_NODE_SIZE(pstQueue->queueSize - sizeof(UINT32));
+        }
         LOS_IntRestore(intSave);
     }
     return space;
@@ -1434,6 +1474,7 @@ osMemoryPoolId_t osMemoryPoolNew(uint32_t block_count, uint32_t block_size, cons
     mp->poolInfo.uwBlkCnt = 0;
     mp->poolInfo.uwBlkNum = block_count;
     mp->poolInfo.uwBlkSize = block_size;
+    LOS_ListInit(&mp->poolInfo.stWaitList);
 
     node = (LOS_MEMBOX_NODE *)mp->poolBase;
     mp->poolInfo.stFreeList.pstNext = node;
@@ -1454,8 +1495,6 @@ void *osMemoryPoolAlloc(osMemoryPoolId_t mp_id, uint32_t timeout)
     LOS_MEMBOX_NODE *node = NULL;
     UINT32 intSave;
 
-    UNUSED(timeout);
-
     if (mp_id == NULL) {
         return NULL;
     }
@@ -1466,6 +1505,9 @@ void *osMemoryPoolAlloc(osMemoryPoolId_t mp_id, uint32_t timeout)
         if (node != NULL) {
             mp->poolInfo.stFreeList.pstNext = node->pstNext;
             mp->poolInfo.uwBlkCnt++;
+        } else if ((timeout != 0) && !OS_INT_ACTIVE && (g_losTaskLock == 0)) {
+            /* osMemoryPoolFree hands the next freed block over, already counted, or NULL on osMemoryPoolDelete. */
+            node = OsMemboxPend(&mp->poolInfo, timeout, &intSave);
         }
     }
     LOS_IntRestore(intSave);
@@ -1497,6 +1539,12 @@ osStatus_t osMemoryPoolFree(osMemoryPoolId_t mp_id, void *block)
         return osErrorParameter;
     }
 
+    if (OsMemboxPost(&mp->poolInfo, block) != OS_INVALID) {
+        LOS_IntRestore(intSave);
+        LOS_Schedule();
+        return osOK;
+    }
+
     node = (LOS_MEMBOX_NODE *)block;
     nodeTmp = mp->poolInfo.stFreeList.pstNext;
     mp->poolInfo.stFreeList.pstNext = node;
@@ -1526,6 +1574,10 @@ osStatus_t osMemoryPoolDelete(osMemoryPoolId_t mp_id)
         return osErrorResource;
     }
 
+    /* Waiters in osMemoryPoolAlloc return NULL. */
+    while (OsMemboxPost(&mp->poolInfo, NULL) != OS_INVALID) {
+    }
+
     if (mp->status & MD_ALLOC) {
         (void)LOS_MemFree(OS_SYS_MEM_ADDR, mp->poolBase);
         mp->poolBase = NULL;
@@ -1538,6 +1590,7 @@ osStatus_t osMemoryPoolDelete(osMemoryPoolId_t mp_id)
         (void)LOS_MemFree(OS_SYS_MEM_ADDR, mp);
     }
     LOS_IntRestore(intSave);
+    LOS_Schedule();
 
     return osOK;
 }
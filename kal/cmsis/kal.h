@@ -71,6 +71,34 @@ osTimerId_t osTimerExtNew (osTimerFunc_t func, osTimerType_t type, void *argumen
                            osTimerRouses_t ucRouses, osTimerAlign_t ucSensitive);
 #endif
 
+#if (LOSCFG_BASE_IPC_QUEUE == 1)
+/**
+* @brief Message queue attribute bit: store variable-length messages in a byte ring.
+*
+* When set in osMessageQueueAttr_t::attr_bits, osMessageQueueNew creates a message buffer whose size in bytes is
+* given by osMessageQueueAttr_t::mq_size, or msg_count messages of msg_size bytes when mq_size is 0. msg_size is
+* then the maximum size of a single message. Use osMessageQueuePutExt and osMessageQueueGetExt to transfer
+* messages of their actual length.
+*/
+#define osMessageQueueVarLen      0x00000001U
+
+/**
+* @brief Puts a message of msg_len bytes into a message queue.
+*
+* On a queue created with osMessageQueueVarLen the message only occupies msg_len bytes plus its length prefix.
+*/
+osStatus_t osMessageQueuePutExt (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_len, uint8_t msg_prio,
+                                 uint32_t timeout);
+
+/**
+* @brief Gets a message from a message queue and returns its length in msg_len.
+*
+* msg_len passes in the size of the buffer at msg_ptr, which must be at least the maximum message size.
+*/
+osStatus_t osMessageQueueGetExt (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t *msg_len, uint8_t *msg_prio,
+                                 uint32_t timeout);
+#endif
+
 #ifdef __cplusplus
 #if __cplusplus
 }
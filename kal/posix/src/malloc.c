@@ -33,6 +33,13 @@
 #include "los_config.h"
 #include "los_memory.h"
 
+#if (LOSCFG_MEM_TCACHE == 1)
+#define SYS_MEM_ALLOC(size) LOS_MemTcacheAlloc(size)
+#define SYS_MEM_FREE(ptr)   LOS_MemTcacheFree(ptr)
+#else
+#define SYS_MEM_ALLOC(size) LOS_MemAlloc(OS_SYS_MEM_ADDR, size)
+#define SYS_MEM_FREE(ptr)   LOS_MemFree(OS_SYS_MEM_ADDR, ptr)
+#endif
 
 void *calloc(size_t nitems, size_t size)
 {
@@ -44,7 +51,7 @@ void *calloc(size_t nitems, size_t size)
     }
 
     real_size = (size_t)(nitems * size);
-    ptr = LOS_MemAlloc(OS_SYS_MEM_ADDR, real_size);
+    ptr = SYS_MEM_ALLOC(real_size);
     if (ptr != NULL) {
         (void)memset_s(ptr, real_size, 0, real_size);
     }
@@ -57,7 +64,7 @@ void free(void *ptr)
         return;
     }
 
-    LOS_MemFree(OS_SYS_MEM_ADDR, ptr);
+    (void)SYS_MEM_FREE(ptr);
 }
 
 void *malloc(size_t size)
@@ -66,7 +73,7 @@ void *malloc(size_t size)
         return NULL;
     }
 
-    return LOS_MemAlloc(OS_SYS_MEM_ADDR, size);
+    return SYS_MEM_ALLOC(size);
 }
 
 void *zalloc(size_t size)
@@ -77,7 +84,7 @@ void *zalloc(size_t size)
         return NULL;
     }
 
-    ptr = LOS_MemAlloc(OS_SYS_MEM_ADDR, size);
+    ptr = SYS_MEM_ALLOC(size);
     if (ptr != NULL) {
         (void)memset_s(ptr, size, 0, size);
     }
@@ -180,8 +180,13 @@ STATIC struct mqpersonal *DoMqueueCreate(const struct mq_attr *attr, const CHAR
 {
     struct mqarray *mqueueCB = NULL;
     UINT32 mqueueID;
+    UINT32 err;
 
-    UINT32 err = LOS_QueueCreate(NULL, attr->mq_maxmsg, &mqueueID, 0, attr->mq_msgsize);
+    if ((UINT32)attr->mq_flags & (UINT32)MQ_VARLEN) {
+        err = LOS_QueueCreateMsgBuf(NULL, attr->mq_maxmsg, &mqueueID, 0, attr->mq_msgsize);
+    } else {
+        err = LOS_QueueCreate(NULL, attr->mq_maxmsg, &mqueueID, 0, attr->mq_msgsize);
+    }
     if (MapMqErrno(err) != ENOERR) {
         goto ERROUT;
     }
@@ -387,6 +392,9 @@ int OsMqGetAttr(mqd_t personal, struct mq_attr *mqAttr)
     mqAttr->mq_msgsize = mqueueCB->mqcb->queueSize - sizeof(UINT32);
     mqAttr->mq_curmsgs = mqueueCB->mqcb->readWriteableCnt[OS_QUEUE_READ];
     mqAttr->mq_flags = privateMqPersonal->mq_flags;
+    if (mqueueCB->mqcb->queueType == OS_QUEUE_TYPE_MSGBUF) {
+        mqAttr->mq_flags = (long)((UINT32)mqAttr->mq_flags | (UINT32)MQ_VARLEN);
+    }
     (VOID)pthread_mutex_unlock(&g_mqueueMutex);
     return 0;
 }
@@ -43,6 +43,7 @@
 #include <limits.h>
 #include <sys/select.h>
 #include "los_queue.h"
+#include "mqueue_ext.h"
 #include "los_memory.h"
 #include "los_task.h"
 #include "los_compiler.h"
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include "los_compiler.h"
+#include "los_barrier.h"
+#include "errno.h"
+
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+#define BARRIER_MAGIC 0x4252
+
+/* pthread_barrier_t is opaque storage here; it holds the handle of the kernel barrier. */
+typedef struct {
+    UINT32 magic;
+    UINT32 handle;
+} PthreadBarrier;
+
+typedef struct {
+    UINT32 pshared;
+} PthreadBarrierAttr;
+
+#define BARRIER_IMPL(barrier)     ((PthreadBarrier *)(barrier))
+#define BARRIER_ATTR_IMPL(attr)   ((PthreadBarrierAttr *)(attr))
+
+static inline int MapError(UINT32 err)
+{
+    switch (err) {
+        case LOS_OK:
+            return 0;
+        case LOS_ERRNO_BARRIER_PEND_INTERR:
+            return EPERM;
+        case LOS_ERRNO_BARRIER_PEND_IN_LOCK:
+            return EDEADLK;
+        case LOS_ERRNO_BARRIER_PENDED:
+            return EBUSY;
+        case LOS_ERRNO_BARRIER_ALL_BUSY:
+            return EAGAIN;
+        case LOS_ERRNO_BARRIER_INVALID:
+        case LOS_ERRNO_BARRIER_COUNT_INVALID:
+        default:
+            return EINVAL;
+    }
+}
+
+int pthread_barrierattr_init(pthread_barrierattr_t *attr)
+{
+    if (attr == NULL) {
+        return EINVAL;
+    }
+    BARRIER_ATTR_IMPL(attr)->pshared = PTHREAD_PROCESS_PRIVATE;
+    return 0;
+}
+
+int pthread_barrierattr_destroy(pthread_barrierattr_t *attr)
+{
+    if (attr == NULL) {
+        return EINVAL;
+    }
+    return 0;
+}
+
+int pthread_barrierattr_setpshared(pthread_barrierattr_t *attr, int pshared)
+{
+    if (attr == NULL) {
+        return EINVAL;
+    }
+    /* There is a single address space, but only the private behaviour is promised. */
+    if (pshared != PTHREAD_PROCESS_PRIVATE) {
+        return (pshared == PTHREAD_PROCESS_SHARED) ? ENOTSUP : EINVAL;
+    }
+    BARRIER_ATTR_IMPL(attr)->pshared = (UINT32)pshared;
+    return 0;
+}
+
+int pthread_barrierattr_getpshared(const pthread_barrierattr_t *attr, int *pshared)
+{
+    if ((attr == NULL) || (pshared == NULL)) {
+        return EINVAL;
+    }
+    *pshared = (int)((const PthreadBarrierAttr *)attr)->pshared;
+    return 0;
+}
+
+int pthread_barrier_init(pthread_barrier_t *barrier, const pthread_barrierattr_t *attr, unsigned count)
+{
+    UINT32 handle;
+    UINT32 ret;
+
+    (VOID)attr;
+    if ((barrier == NULL) || (count == 0) || (count > OS_NULL_SHORT)) {
+        return EINVAL;
+    }
+
+    ret = LOS_BarrierCreate((UINT16)count, &handle);
+    if (ret != LOS_OK) {
+        return MapError(ret);
+    }
+    BARRIER_IMPL(barrier)->handle = handle;
+    BARRIER_IMPL(barrier)->magic = BARRIER_MAGIC;
+    return 0;
+}
+
+int pthread_barrier_destroy(pthread_barrier_t *barrier)
+{
+    UINT32 ret;
+
+    if ((barrier == NULL) || (BARRIER_IMPL(barrier)->magic != BARRIER_MAGIC)) {
+        return EINVAL;
+    }
+
+    ret = LOS_BarrierDelete(BARRIER_IMPL(barrier)->handle);
+    if (ret != LOS_OK) {
+        return MapError(ret);
+    }
+    BARRIER_IMPL(barrier)->magic = 0;
+    return 0;
+}
+
+int pthread_barrier_wait(pthread_barrier_t *barrier)
+{
+    BOOL isLast = FALSE;
+    UINT32 ret;
+
+    if ((barrier == NULL) || (BARRIER_IMPL(barrier)->magic != BARRIER_MAGIC)) {
+        return EINVAL;
+    }
+
+    ret = LOS_BarrierWait(BARRIER_IMPL(barrier)->handle, LOS_WAIT_FOREVER, &isLast);
+    if (ret != LOS_OK) {
+        return MapError(ret);
+    }
+    return isLast ? PTHREAD_BARRIER_SERIAL_THREAD : 0;
+}
+#endif /* (LOSCFG_BASE_IPC_BARRIER == 1) */
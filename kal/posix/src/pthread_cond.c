@@ -32,27 +32,14 @@
 #include "time_internal.h"
 #include <errno.h>
 #include <pthread.h>
-#include <stdlib.h>
-#include <unistd.h>
-#include <securec.h>
 #include "los_config.h"
 #include "los_task.h"
-#include <los_swtmr.h>
-#include "los_atomic.h"
+#if (LOSCFG_BASE_IPC_CONDVAR == 1)
+#include "los_condvar.h"
+#else
+#include <stdlib.h>
 #include "los_event.h"
-
-typedef struct {
-    volatile INT32 *realValue;
-    INT32 value;
-    UINT32 clearEvent;
-} EventCond;
-
-#define INLINE inline
-
-#define BROADCAST_EVENT     1
-#define COND_COUNTER_STEP   0x0004U
-#define COND_FLAGS_MASK     0x0003U
-#define COND_COUNTER_MASK   (~COND_FLAGS_MASK)
+#endif
 
 int pthread_condattr_destroy(pthread_condattr_t *attr)
 {
@@ -72,6 +59,146 @@ int pthread_condattr_init(pthread_condattr_t *attr)
     return 0;
 }
 
+#if (LOSCFG_BASE_IPC_CONDVAR == 1)
+/*
+ * pthread_cond_t keeps the layout of the libc port. value holds the handle of the kernel condition variable and
+ * count marks an initialized condition; the event and mutex members are not used.
+ */
+#define COND_INITIALIZED    0x434F4E44
+
+STATIC INLINE INT32 CondInitCheck(const pthread_cond_t *cond)
+{
+    if (cond->count != COND_INITIALIZED) {
+        return 1;
+    }
+    return 0;
+}
+
+STATIC INT32 MapError(UINT32 err)
+{
+    switch (err) {
+        case LOS_OK:
+            return ENOERR;
+        case LOS_ERRNO_CONDVAR_TIMEOUT:
+            return ETIMEDOUT;
+        case LOS_ERRNO_CONDVAR_PENDED:
+            return EBUSY;
+        case LOS_ERRNO_CONDVAR_ALL_BUSY:
+            return EAGAIN;
+        case LOS_ERRNO_CONDVAR_MUX_INVALID:
+            return EPERM;
+        case LOS_ERRNO_CONDVAR_PEND_IN_LOCK:
+            return EDEADLK;
+        default:
+            return EINVAL;
+    }
+}
+
+int pthread_cond_init(pthread_cond_t *cond, const pthread_condattr_t *attr)
+{
+    UINT32 condID;
+    UINT32 ret;
+
+    if (cond == NULL) {
+        return EINVAL;
+    }
+    (VOID)attr;
+
+    ret = LOS_CondCreate(&condID);
+    if (ret != LOS_OK) {
+        return MapError(ret);
+    }
+
+    cond->mutex = NULL;
+    cond->value = (INT32)condID;
+    cond->count = COND_INITIALIZED;
+    return ENOERR;
+}
+
+/* Create the kernel condition variable of a statically initialized condition on first use. */
+STATIC INT32 CondLazyInit(pthread_cond_t *cond)
+{
+    INT32 ret = ENOERR;
+
+    LOS_TaskLock();
+    if (CondInitCheck(cond)) {
+        ret = pthread_cond_init(cond, NULL);
+    }
+    LOS_TaskUnlock();
+    return ret;
+}
+
+int pthread_cond_destroy(pthread_cond_t *cond)
+{
+    UINT32 ret;
+
+    if (cond == NULL) {
+        return EINVAL;
+    }
+
+    if (CondInitCheck(cond)) {
+        return ENOERR;
+    }
+
+    ret = LOS_CondDelete((UINT32)cond->value);
+    if (ret != LOS_OK) {
+        return MapError(ret);
+    }
+    cond->count = 0;
+    return ENOERR;
+}
+
+int pthread_cond_broadcast(pthread_cond_t *cond)
+{
+    if (cond == NULL) {
+        return EINVAL;
+    }
+
+    /* A condition that was never waited on has no waiters to wake. */
+    if (CondInitCheck(cond)) {
+        return ENOERR;
+    }
+
+    return MapError(LOS_CondBroadcast((UINT32)cond->value));
+}
+
+int pthread_cond_signal(pthread_cond_t *cond)
+{
+    if (cond == NULL) {
+        return EINVAL;
+    }
+
+    if (CondInitCheck(cond)) {
+        return ENOERR;
+    }
+
+    return MapError(LOS_CondSignal((UINT32)cond->value));
+}
+
+STATIC INT32 CondWait(pthread_cond_t *cond, pthread_mutex_t *mutex, UINT32 ticks)
+{
+    INT32 ret;
+
+    if ((cond == NULL) || (mutex == NULL) || (mutex->magic != _MUX_MAGIC)) {
+        return EINVAL;
+    }
+
+    if (CondInitCheck(cond)) {
+        ret = CondLazyInit(cond);
+        if (ret != ENOERR) {
+            return ret;
+        }
+    }
+
+    return MapError(LOS_CondWait((UINT32)cond->value, mutex->handle, ticks));
+}
+#else
+/*
+ * Without the condition variable module a condition is an event group that waiters read and signallers write.
+ * cond->mutex protects count, the number of waiters, and value is unused.
+ */
+#define BROADCAST_EVENT     1
+
 STATIC INLINE INT32 CondInitCheck(const pthread_cond_t *cond)
 {
     if ((cond->event.stEventList.pstPrev == NULL) &&
@@ -83,8 +210,6 @@ STATIC INLINE INT32 CondInitCheck(const pthread_cond_t *cond)
 
 int pthread_cond_init(pthread_cond_t *cond, const pthread_condattr_t *attr)
 {
-    int ret = ENOERR;
-
     if (cond == NULL) {
         return EINVAL;
     }
@@ -103,7 +228,7 @@ int pthread_cond_init(pthread_cond_t *cond, const pthread_condattr_t *attr)
     cond->count = 0;
     (VOID)pthread_mutex_unlock(cond->mutex);
 
-    return ret;
+    return ENOERR;
 }
 
 int pthread_cond_destroy(pthread_cond_t *cond)
@@ -137,77 +262,56 @@ STATIC VOID PthreadCountSub(pthread_cond_t *cond)
     (VOID)pthread_mutex_unlock(cond->mutex);
 }
 
-
 int pthread_cond_broadcast(pthread_cond_t *cond)
 {
-    int ret = ENOERR;
-
     if (cond == NULL) {
         return EINVAL;
     }
 
+    if (CondInitCheck(cond)) {
+        return ENOERR;
+    }
+
     (VOID)pthread_mutex_lock(cond->mutex);
     if (cond->count > 0) {
         cond->count = 0;
         (VOID)pthread_mutex_unlock(cond->mutex);
         (VOID)LOS_EventWrite(&(cond->event), BROADCAST_EVENT);
-        return ret;
+        return ENOERR;
     }
     (VOID)pthread_mutex_unlock(cond->mutex);
 
-    return ret;
+    return ENOERR;
 }
 
 int pthread_cond_signal(pthread_cond_t *cond)
 {
-    int ret = ENOERR;
-
     if (cond == NULL) {
         return EINVAL;
     }
 
+    if (CondInitCheck(cond)) {
+        return ENOERR;
+    }
+
     (VOID)pthread_mutex_lock(cond->mutex);
     if (cond->count > 0) {
         cond->count--;
         (VOID)pthread_mutex_unlock(cond->mutex);
-        // This should modify to once.
+        /* The event group wakes every waiter, the ones not counted any more see a spurious wakeup. */
         (VOID)LOS_EventWrite(&(cond->event), BROADCAST_EVENT);
-
-        return ret;
+        return ENOERR;
     }
     (VOID)pthread_mutex_unlock(cond->mutex);
 
-    return ret;
-}
-
-STATIC INT32 ProcessReturnVal(pthread_cond_t *cond, INT32 val)
-{
-    INT32 ret;
-    switch (val) {
-        /* 0: event does not occur */
-        case 0:
-        case BROADCAST_EVENT:
-            ret = ENOERR;
-            break;
-        case LOS_ERRNO_EVENT_READ_TIMEOUT:
-            PthreadCountSub(cond);
-            ret = ETIMEDOUT;
-            break;
-        default:
-            PthreadCountSub(cond);
-            ret = EINVAL;
-            break;
-    }
-    return ret;
+    return ENOERR;
 }
 
-int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex,
-                           const struct timespec *absTime)
+STATIC INT32 CondWait(pthread_cond_t *cond, pthread_mutex_t *mutex, UINT32 ticks)
 {
-    UINT32 absTicks;
     INT32 ret;
 
-    if ((cond == NULL) || (mutex == NULL) || (absTime == NULL)) {
+    if ((cond == NULL) || (mutex == NULL)) {
         return EINVAL;
     }
 
@@ -218,48 +322,10 @@ int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex,
         }
     }
 
-    (VOID)pthread_mutex_lock(cond->mutex);
-    cond->count++;
-    (VOID)pthread_mutex_unlock(cond->mutex);
-
-    if ((absTime->tv_sec == 0) && (absTime->tv_nsec == 0)) {
+    if (ticks == 0) {
         return ETIMEDOUT;
     }
 
-    if (!ValidTimeSpec(absTime)) {
-        return EINVAL;
-    }
-
-    absTicks = OsTimeSpec2Tick(absTime);
-    if (pthread_mutex_unlock(mutex) != ENOERR) {
-        PRINT_ERR("%s: %d failed\n", __FUNCTION__, __LINE__);
-    }
-
-    ret = (INT32)LOS_EventRead(&(cond->event), 0x0f, LOS_WAITMODE_OR | LOS_WAITMODE_CLR, absTicks);
-
-    if (pthread_mutex_lock(mutex) != ENOERR) {
-        PRINT_ERR("%s: %d failed\n", __FUNCTION__, __LINE__);
-    }
-
-    ret = ProcessReturnVal(cond, ret);
-    return ret;
-}
-
-int pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
-{
-    int ret;
-
-    if ((cond == NULL) || (mutex == NULL)) {
-        return EINVAL;
-    }
-
-    if (CondInitCheck(cond)) {
-        ret = pthread_cond_init(cond, NULL);
-        if (ret != ENOERR) {
-            return ret;
-        }
-    }
-
     (VOID)pthread_mutex_lock(cond->mutex);
     cond->count++;
     (VOID)pthread_mutex_unlock(cond->mutex);
@@ -267,7 +333,7 @@ int pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
     if (pthread_mutex_unlock(mutex) != ENOERR) {
         PRINT_ERR("%s: %d failed\n", __FUNCTION__, __LINE__);
     }
-    ret = (INT32)LOS_EventRead(&(cond->event), 0x0f, LOS_WAITMODE_OR | LOS_WAITMODE_CLR, LOS_WAIT_FOREVER);
+    ret = (INT32)LOS_EventRead(&(cond->event), 0x0f, LOS_WAITMODE_OR | LOS_WAITMODE_CLR, ticks);
     if (pthread_mutex_lock(mutex) != ENOERR) {
         PRINT_ERR("%s: %d failed\n", __FUNCTION__, __LINE__);
     }
@@ -276,13 +342,36 @@ int pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
         /* 0: event does not occur */
         case 0:
         case BROADCAST_EVENT:
-            ret = ENOERR;
-            break;
+            return ENOERR;
+        case LOS_ERRNO_EVENT_READ_TIMEOUT:
+            PthreadCountSub(cond);
+            return ETIMEDOUT;
         default:
             PthreadCountSub(cond);
-            ret = EINVAL;
-            break;
+            return EINVAL;
     }
+}
+#endif
 
-    return ret;
+int pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
+{
+    return CondWait(cond, mutex, LOS_WAIT_FOREVER);
+}
+
+int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex,
+                           const struct timespec *absTime)
+{
+    UINT32 ticks;
+    INT32 ret;
+
+    if (absTime == NULL) {
+        return EINVAL;
+    }
+
+    ret = OsAbsTimeSpec2Tick(absTime, &ticks);
+    if (ret != ENOERR) {
+        return ret;
+    }
+
+    return CondWait(cond, mutex, ticks);
 }
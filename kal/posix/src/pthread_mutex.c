@@ -33,12 +33,22 @@
 #include <time.h>
 #include "los_compiler.h"
 #include "los_mux.h"
+#include "securec.h"
 #include "errno.h"
 
 
 #define OS_SYS_NS_PER_MSECOND 1000000
 #define OS_SYS_NS_PER_SECOND  1000000000
 
+/* pthread_mutexattr_t is opaque storage here. */
+typedef struct {
+    UINT8 protocol;
+    UINT8 prioCeiling;
+    UINT16 reserved;
+} PthreadMutexAttr;
+
+#define MUTEX_ATTR_IMPL(attr) ((PthreadMutexAttr *)(attr))
+
 static inline int MapError(UINT32 err)
 {
     switch (err) {
@@ -55,23 +65,100 @@ static inline int MapError(UINT32 err)
             return ETIMEDOUT;
         case LOS_ERRNO_MUX_ALL_BUSY:
             return EAGAIN;
+        case LOS_ERRNO_MUX_CEILING:
         case LOS_ERRNO_MUX_INVALID:
         default:
             return EINVAL;
     }
 }
 
+/* Mutexes inherit priority unless the attributes say otherwise, as kernel mutexes do. */
+int pthread_mutexattr_init(pthread_mutexattr_t *attr)
+{
+    if (attr == NULL) {
+        return EINVAL;
+    }
+
+    MUTEX_ATTR_IMPL(attr)->protocol = PTHREAD_PRIO_INHERIT;
+    MUTEX_ATTR_IMPL(attr)->prioCeiling = LOS_TASK_PRIORITY_HIGHEST;
+    MUTEX_ATTR_IMPL(attr)->reserved = 0;
+    return 0;
+}
+
+int pthread_mutexattr_destroy(pthread_mutexattr_t *attr)
+{
+    if (attr == NULL) {
+        return EINVAL;
+    }
+
+    (VOID)memset_s(attr, sizeof(PthreadMutexAttr), 0, sizeof(PthreadMutexAttr));
+    return 0;
+}
+
+int pthread_mutexattr_setprotocol(pthread_mutexattr_t *attr, int protocol)
+{
+    if ((attr == NULL) ||
+        ((protocol != PTHREAD_PRIO_NONE) && (protocol != PTHREAD_PRIO_INHERIT) && (protocol != PTHREAD_PRIO_PROTECT))) {
+        return EINVAL;
+    }
+
+    MUTEX_ATTR_IMPL(attr)->protocol = (UINT8)protocol;
+    return 0;
+}
+
+int pthread_mutexattr_getprotocol(const pthread_mutexattr_t *attr, int *protocol)
+{
+    if ((attr == NULL) || (protocol == NULL)) {
+        return EINVAL;
+    }
+
+    *protocol = MUTEX_ATTR_IMPL(attr)->protocol;
+    return 0;
+}
+
+int pthread_mutexattr_setprioceiling(pthread_mutexattr_t *attr, int prioceiling)
+{
+    if ((attr == NULL) || (prioceiling < LOS_TASK_PRIORITY_HIGHEST) || (prioceiling > LOS_TASK_PRIORITY_LOWEST)) {
+        return EINVAL;
+    }
+
+    MUTEX_ATTR_IMPL(attr)->prioCeiling = (UINT8)prioceiling;
+    return 0;
+}
+
+int pthread_mutexattr_getprioceiling(const pthread_mutexattr_t *attr, int *prioceiling)
+{
+    if ((attr == NULL) || (prioceiling == NULL)) {
+        return EINVAL;
+    }
+
+    *prioceiling = MUTEX_ATTR_IMPL(attr)->prioCeiling;
+    return 0;
+}
+
 /* Initialize mutex. If mutexAttr is NULL, use default attributes. */
 int pthread_mutex_init(pthread_mutex_t *mutex, const pthread_mutexattr_t *mutexAttr)
 {
     UINT32 muxHandle;
     UINT32 ret;
+    LosMuxAttr attr = { LOS_MUX_PRIO_INHERIT, LOS_TASK_PRIORITY_HIGHEST };
 
     if (mutexAttr != NULL) {
-        return EOPNOTSUPP;
+        switch (MUTEX_ATTR_IMPL(mutexAttr)->protocol) {
+            case PTHREAD_PRIO_NONE:
+                attr.protocol = LOS_MUX_PRIO_NONE;
+                break;
+            case PTHREAD_PRIO_PROTECT:
+                attr.protocol = LOS_MUX_PRIO_PROTECT;
+                break;
+            default:
+                attr.protocol = LOS_MUX_PRIO_INHERIT;
+                break;
+        }
+        attr.prioCeiling = MUTEX_ATTR_IMPL(mutexAttr)->prioCeiling;
     }
 
-    ret = LOS_MuxCreate(&muxHandle);
+    ret = LOS_MuxCreateEx(&muxHandle, &attr);
     if (ret != LOS_OK) {
         return MapError(ret);
     }
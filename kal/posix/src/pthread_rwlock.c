@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <time.h>
+#include "pthread_ext.h"
+#include "time_internal.h"
+#include "los_compiler.h"
+#include "los_rwlock.h"
+#include "errno.h"
+
+#if (LOSCFG_BASE_IPC_RWLOCK == 1)
+#define RWLOCK_MAGIC 0x5257
+
+/* pthread_rwlock_t is opaque storage here, an all-zero lock is created on first use. */
+typedef struct {
+    UINT32 magic;
+    UINT32 handle;
+} PthreadRwlock;
+
+typedef struct {
+    UINT32 pshared;
+    UINT32 kind;
+} PthreadRwlockAttr;
+
+#define RWLOCK_IMPL(rwlock)   ((PthreadRwlock *)(rwlock))
+#define RWLOCK_ATTR_IMPL(attr) ((PthreadRwlockAttr *)(attr))
+
+static inline int MapError(UINT32 err)
+{
+    switch (err) {
+        case LOS_OK:
+            return 0;
+        case LOS_ERRNO_RWLOCK_PEND_INTERR:
+            return EPERM;
+        case LOS_ERRNO_RWLOCK_PEND_IN_LOCK:
+        case LOS_ERRNO_RWLOCK_DEADLOCK:
+            return EDEADLK;
+        case LOS_ERRNO_RWLOCK_PENDED:
+        case LOS_ERRNO_RWLOCK_UNAVAILABLE:
+            return EBUSY;
+        case LOS_ERRNO_RWLOCK_TIMEOUT:
+            return ETIMEDOUT;
+        case LOS_ERRNO_RWLOCK_ALL_BUSY:
+            return EAGAIN;
+        case LOS_ERRNO_RWLOCK_INVALID:
+        default:
+            return EINVAL;
+    }
+}
+
+int pthread_rwlockattr_init(pthread_rwlockattr_t *attr)
+{
+    if (attr == NULL) {
+        return EINVAL;
+    }
+    RWLOCK_ATTR_IMPL(attr)->pshared = PTHREAD_PROCESS_PRIVATE;
+    RWLOCK_ATTR_IMPL(attr)->kind = PTHREAD_RWLOCK_PREFER_READER_NP;
+    return 0;
+}
+
+int pthread_rwlockattr_destroy(pthread_rwlockattr_t *attr)
+{
+    if (attr == NULL) {
+        return EINVAL;
+    }
+    return 0;
+}
+
+int pthread_rwlockattr_setkind_np(pthread_rwlockattr_t *attr, int pref)
+{
+    if ((attr == NULL) ||
+        ((pref != PTHREAD_RWLOCK_PREFER_READER_NP) && (pref != PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP))) {
+        return EINVAL;
+    }
+    RWLOCK_ATTR_IMPL(attr)->kind = (UINT32)pref;
+    return 0;
+}
+
+int pthread_rwlockattr_getkind_np(const pthread_rwlockattr_t *attr, int *pref)
+{
+    if ((attr == NULL) || (pref == NULL)) {
+        return EINVAL;
+    }
+    *pref = (int)((const PthreadRwlockAttr *)attr)->kind;
+    return 0;
+}
+
+static int RwlockCreate(pthread_rwlock_t *rwlock, UINT32 flags)
+{
+    UINT32 handle;
+    UINT32 ret;
+
+    ret = LOS_RwLockCreate(&handle, flags);
+    if (ret != LOS_OK) {
+        return MapError(ret);
+    }
+    RWLOCK_IMPL(rwlock)->handle = handle;
+    RWLOCK_IMPL(rwlock)->magic = RWLOCK_MAGIC;
+    return 0;
+}
+
+int pthread_rwlock_init(pthread_rwlock_t *rwlock, const pthread_rwlockattr_t *attr)
+{
+    UINT32 flags = LOS_RWLOCK_PREFER_READER;
+
+    if (rwlock == NULL) {
+        return EINVAL;
+    }
+    if ((attr != NULL) && (((const PthreadRwlockAttr *)attr)->kind == PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP)) {
+        flags = LOS_RWLOCK_PREFER_WRITER;
+    }
+    return RwlockCreate(rwlock, flags);
+}
+
+/* Return the kernel handle of rwlock, creating it for a statically initialized lock. */
+static int RwlockHandleGet(pthread_rwlock_t *rwlock, UINT32 *handle)
+{
+    int ret = 0;
+
+    if (rwlock == NULL) {
+        return EINVAL;
+    }
+    if (RWLOCK_IMPL(rwlock)->magic != RWLOCK_MAGIC) {
+        if (RWLOCK_IMPL(rwlock)->magic != 0) {
+            return EINVAL;
+        }
+        LOS_TaskLock();
+        if (RWLOCK_IMPL(rwlock)->magic == 0) {
+            ret = RwlockCreate(rwlock, LOS_RWLOCK_PREFER_READER);
+        }
+        LOS_TaskUnlock();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    *handle = RWLOCK_IMPL(rwlock)->handle;
+    return 0;
+}
+
+int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
+{
+    UINT32 ret;
+
+    if ((rwlock == NULL) || (RWLOCK_IMPL(rwlock)->magic != RWLOCK_MAGIC)) {
+        return EINVAL;
+    }
+    ret = LOS_RwLockDelete(RWLOCK_IMPL(rwlock)->handle);
+    if (ret != LOS_OK) {
+        return MapError(ret);
+    }
+    RWLOCK_IMPL(rwlock)->magic = 0;
+    return 0;
+}
+
+static int RwlockRdLock(pthread_rwlock_t *rwlock, UINT32 timeout)
+{
+    UINT32 handle;
+    int ret = RwlockHandleGet(rwlock, &handle);
+    if (ret != 0) {
+        return ret;
+    }
+    return MapError(LOS_RwLockRdLock(handle, timeout));
+}
+
+static int RwlockWrLock(pthread_rwlock_t *rwlock, UINT32 timeout)
+{
+    UINT32 handle;
+    int ret = RwlockHandleGet(rwlock, &handle);
+    if (ret != 0) {
+        return ret;
+    }
+    return MapError(LOS_RwLockWrLock(handle, timeout));
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
+{
+    return RwlockRdLock(rwlock, LOS_WAIT_FOREVER);
+}
+
+int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
+{
+    return RwlockRdLock(rwlock, 0);
+}
+
+int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock, const struct timespec *absTimeout)
+{
+    UINT32 ticks;
+    int ret = OsAbsTimeSpec2Tick(absTimeout, &ticks);
+    if (ret != 0) {
+        return ret;
+    }
+    ret = RwlockRdLock(rwlock, ticks);
+    return (ret == EBUSY) ? ETIMEDOUT : ret;
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t *rwlock)
+{
+    return RwlockWrLock(rwlock, LOS_WAIT_FOREVER);
+}
+
+int pthread_rwlock_trywrlock(pthread_rwlock_t *rwlock)
+{
+    return RwlockWrLock(rwlock, 0);
+}
+
+int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock, const struct timespec *absTimeout)
+{
+    UINT32 ticks;
+    int ret = OsAbsTimeSpec2Tick(absTimeout, &ticks);
+    if (ret != 0) {
+        return ret;
+    }
+    ret = RwlockWrLock(rwlock, ticks);
+    return (ret == EBUSY) ? ETIMEDOUT : ret;
+}
+
+int pthread_rwlock_unlock(pthread_rwlock_t *rwlock)
+{
+    if ((rwlock == NULL) || (RWLOCK_IMPL(rwlock)->magic != RWLOCK_MAGIC)) {
+        return EINVAL;
+    }
+    return MapError(LOS_RwLockUnlock(RWLOCK_IMPL(rwlock)->handle));
+}
+#endif /* (LOSCFG_BASE_IPC_RWLOCK == 1) */
@@ -105,6 +105,25 @@ STATIC INLINE UINT32 OsTimeSpec2Tick(const struct timespec *tp)
     return (UINT32)tick;
 }
 
+/* Ticks from now until the CLOCK_REALTIME time absTime, 0 if it has passed. */
+STATIC INLINE INT32 OsAbsTimeSpec2Tick(const struct timespec *absTime, UINT32 *tick)
+{
+    struct timespec curTime = {0};
+    struct timespec relTime;
+
+    if (!ValidTimeSpec(absTime) || (clock_gettime(CLOCK_REALTIME, &curTime) != 0)) {
+        return EINVAL;
+    }
+    relTime.tv_sec = absTime->tv_sec - curTime.tv_sec;
+    relTime.tv_nsec = absTime->tv_nsec - curTime.tv_nsec;
+    if (relTime.tv_nsec < 0) {
+        relTime.tv_sec--;
+        relTime.tv_nsec += OS_SYS_NS_PER_SECOND;
+    }
+    *tick = (relTime.tv_sec < 0) ? 0 : OsTimeSpec2Tick(&relTime);
+    return 0;
+}
+
 STATIC INLINE VOID OsTick2TimeSpec(struct timespec *tp, UINT32 tick)
 {
     UINT64 ns = ((UINT64)tick * OS_SYS_NS_PER_SECOND) / LOSCFG_BASE_CORE_TICK_PER_SECOND;
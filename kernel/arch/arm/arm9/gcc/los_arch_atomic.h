@@ -33,6 +33,7 @@
 #define _LOS_ARCH_ATOMIC_H
 
 #include "los_compiler.h"
+#include "los_interrupt.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -40,6 +41,8 @@ extern "C" {
 #endif /* __cplusplus */
 #endif /* __cplusplus */
 
+/* ARMv5 has no exclusive load and store, the operations run with interrupts locked. */
+
 /**
  * @ingroup  los_arch_atomic
  * @brief Atomic exchange for 32-bit variable.
@@ -59,7 +62,13 @@ extern "C" {
  */
 STATIC INLINE INT32 HalAtomicXchg32bits(volatile INT32 *v, INT32 val)
 {
-    return -1;
+    INT32 prevVal;
+    UINT32 intSave = LOS_IntLock();
+
+    prevVal = *v;
+    *v = val;
+    LOS_IntRestore(intSave);
+    return prevVal;
 }
 
 /**
@@ -83,7 +92,13 @@ STATIC INLINE INT32 HalAtomicXchg32bits(volatile INT32 *v, INT32 val)
  */
 STATIC INLINE INT32 HalAtomicDecRet(volatile INT32 *v)
 {
-    return -1;
+    INT32 val;
+    UINT32 intSave = LOS_IntLock();
+
+    val = *v - 1;
+    *v = val;
+    LOS_IntRestore(intSave);
+    return val;
 }
 
 /**
@@ -107,7 +122,15 @@ STATIC INLINE INT32 HalAtomicDecRet(volatile INT32 *v)
  */
 STATIC INLINE BOOL HalAtomicCmpXchg32bits(volatile INT32 *v, INT32 val, INT32 oldVal)
 {
-    return FALSE;
+    INT32 prevVal;
+    UINT32 intSave = LOS_IntLock();
+
+    prevVal = *v;
+    if (prevVal == oldVal) {
+        *v = val;
+    }
+    LOS_IntRestore(intSave);
+    return prevVal != oldVal;
 }
 
 #ifdef __cplusplus
@@ -33,6 +33,8 @@
 #define _LOS_ATOMIC_H
 
 #include "los_compiler.h"
+#include "los_interrupt.h"
+#include "los_arch_atomic.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -40,6 +42,701 @@ extern "C" {
 #endif /* __cplusplus */
 #endif /* __cplusplus */
 
+/**
+ * @ingroup los_atomic
+ * 32-bit atomic variable.
+ */
+typedef volatile INT32 Atomic;
+
+/**
+ * @ingroup los_atomic
+ * 64-bit atomic variable.
+ */
+typedef volatile INT64 Atomic64;
+
+/*
+ * The 32-bit operations are built on the exchange, decrement and compare-and-exchange that each arch provides in
+ * los_arch_atomic.h, so every arch decides how they are done, e.g. with interrupts locked where the core has no
+ * atomic instructions. LiteOS-M runs on a single core, where ordering only has to hold against interrupts and
+ * task switches: a compiler barrier on each side of an operation is enough and no fence instruction is issued.
+ */
+#define OS_ATOMIC_BARRIER()     __asm__ __volatile__("" : : : "memory")
+
+#define OS_ATOMIC_FETCH_OP(name, op)                                                \
+STATIC INLINE INT32 OsAtomicFetch##name##32(volatile INT32 *v, INT32 val)           \
+{                                                                                   \
+    INT32 prevVal;                                                                  \
+    INT32 newVal;                                                                   \
+                                                                                    \
+    OS_ATOMIC_BARRIER();                                                            \
+    do {                                                                            \
+        prevVal = *v;                                                               \
+        newVal = (INT32)((UINT32)prevVal op (UINT32)val);                           \
+    } while (HalAtomicCmpXchg32bits(v, newVal, prevVal));                           \
+    OS_ATOMIC_BARRIER();                                                            \
+    return prevVal;                                                                 \
+}
+
+OS_ATOMIC_FETCH_OP(Add, +)
+OS_ATOMIC_FETCH_OP(Or, |)
+OS_ATOMIC_FETCH_OP(And, &)
+#undef OS_ATOMIC_FETCH_OP
+
+STATIC INLINE INT32 OsAtomicLoadAcquire32(const volatile INT32 *v)
+{
+    INT32 val = *v;
+    OS_ATOMIC_BARRIER();
+    return val;
+}
+
+STATIC INLINE VOID OsAtomicStoreRelease32(volatile INT32 *v, INT32 val)
+{
+    OS_ATOMIC_BARRIER();
+    *v = val;
+}
+
+/* ARMv7-M and RV32 have no 64-bit exclusives, 64-bit variables are always updated with interrupts locked. */
+STATIC INLINE INT64 OsAtomicLoad64(const volatile INT64 *v)
+{
+    INT64 val;
+    UINT32 intSave = LOS_IntLock();
+    val = *v;
+    LOS_IntRestore(intSave);
+    return val;
+}
+
+STATIC INLINE VOID OsAtomicStore64(volatile INT64 *v, INT64 val)
+{
+    UINT32 intSave = LOS_IntLock();
+    *v = val;
+    LOS_IntRestore(intSave);
+}
+
+STATIC INLINE INT64 OsAtomicFetchAdd64(volatile INT64 *v, INT64 val)
+{
+    INT64 prevVal;
+    UINT32 intSave = LOS_IntLock();
+    prevVal = *v;
+    *v = (INT64)((UINT64)prevVal + (UINT64)val);
+    LOS_IntRestore(intSave);
+    return prevVal;
+}
+
+STATIC INLINE INT64 OsAtomicXchg64(volatile INT64 *v, INT64 val)
+{
+    INT64 prevVal;
+    UINT32 intSave = LOS_IntLock();
+    prevVal = *v;
+    *v = val;
+    LOS_IntRestore(intSave);
+    return prevVal;
+}
+
+STATIC INLINE INT64 OsAtomicCmpXchg64(volatile INT64 *v, INT64 val, INT64 oldVal)
+{
+    INT64 prevVal;
+    UINT32 intSave = LOS_IntLock();
+    prevVal = *v;
+    if (prevVal == oldVal) {
+        *v = val;
+    }
+    LOS_IntRestore(intSave);
+    return prevVal;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic read.
+ *
+ * @par Description:
+ * This API is used to read the value of the 32-bit atomic variable, with no ordering against other memory accesses.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval #INT32  The value of the atomic variable.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicLoadAcquire
+ */
+STATIC INLINE INT32 LOS_AtomicRead(const Atomic *v)
+{
+    return *v;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic setting.
+ *
+ * @par Description:
+ * This API is used to set the value of the 32-bit atomic variable, with no ordering against other memory accesses.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  setVal    [IN] The value to be set.
+ *
+ * @retval none.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicStoreRelease
+ */
+STATIC INLINE VOID LOS_AtomicSet(Atomic *v, INT32 setVal)
+{
+    *v = setVal;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic read with acquire ordering.
+ *
+ * @par Description:
+ * This API is used to read the 32-bit atomic variable so that no later memory access is performed before it.
+ * It pairs with #LOS_AtomicStoreRelease to publish data through a flag.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval #INT32  The value of the atomic variable.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicStoreRelease
+ */
+STATIC INLINE INT32 LOS_AtomicLoadAcquire(const Atomic *v)
+{
+    return OsAtomicLoadAcquire32(v);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic setting with release ordering.
+ *
+ * @par Description:
+ * This API is used to set the 32-bit atomic variable after all earlier memory accesses have been performed.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  setVal    [IN] The value to be set.
+ *
+ * @retval none.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicLoadAcquire
+ */
+STATIC INLINE VOID LOS_AtomicStoreRelease(Atomic *v, INT32 setVal)
+{
+    OsAtomicStoreRelease32(v, setVal);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic addition.
+ *
+ * @par Description:
+ * This API is used to add addVal to the 32-bit atomic variable and return the result.
+ * The read-modify-write operations of this module are fully ordered.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  addVal    [IN] The addend.
+ *
+ * @retval #INT32  The value of the atomic variable after the addition.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicSub
+ */
+STATIC INLINE INT32 LOS_AtomicAdd(Atomic *v, INT32 addVal)
+{
+    return (INT32)((UINT32)OsAtomicFetchAdd32(v, addVal) + (UINT32)addVal);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic subtraction.
+ *
+ * @par Description:
+ * This API is used to subtract subVal from the 32-bit atomic variable and return the result.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  subVal    [IN] The subtrahend.
+ *
+ * @retval #INT32  The value of the atomic variable after the subtraction.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicAdd
+ */
+STATIC INLINE INT32 LOS_AtomicSub(Atomic *v, INT32 subVal)
+{
+    return LOS_AtomicAdd(v, (INT32)(0U - (UINT32)subVal));
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic auto-increment.
+ *
+ * @par Description:
+ * This API is used to increase the 32-bit atomic variable by 1.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval none.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicIncRet
+ */
+STATIC INLINE VOID LOS_AtomicInc(Atomic *v)
+{
+    (VOID)OsAtomicFetchAdd32(v, 1);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic auto-increment with result.
+ *
+ * @par Description:
+ * This API is used to increase the 32-bit atomic variable by 1 and return the result.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval #INT32  The value of the atomic variable after the increment.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicInc
+ */
+STATIC INLINE INT32 LOS_AtomicIncRet(Atomic *v)
+{
+    return LOS_AtomicAdd(v, 1);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic auto-decrement.
+ *
+ * @par Description:
+ * This API is used to decrease the 32-bit atomic variable by 1.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval none.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicDecRet
+ */
+STATIC INLINE VOID LOS_AtomicDec(Atomic *v)
+{
+    OS_ATOMIC_BARRIER();
+    (VOID)HalAtomicDecRet(v);
+    OS_ATOMIC_BARRIER();
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic auto-decrement with result.
+ *
+ * @par Description:
+ * This API is used to decrease the 32-bit atomic variable by 1 and return the result.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval #INT32  The value of the atomic variable after the decrement.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicDec
+ */
+STATIC INLINE INT32 LOS_AtomicDecRet(Atomic *v)
+{
+    INT32 val;
+
+    OS_ATOMIC_BARRIER();
+    val = HalAtomicDecRet(v);
+    OS_ATOMIC_BARRIER();
+    return val;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic exchange for 32-bit variable.
+ *
+ * @par Description:
+ * This API is used to write val to the 32-bit atomic variable and return its previous value.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  val       [IN] The exchange value.
+ *
+ * @retval #INT32  The previous value of the atomic variable.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicCmpXchg32bits
+ */
+STATIC INLINE INT32 LOS_AtomicXchg32bits(Atomic *v, INT32 val)
+{
+    INT32 prevVal;
+
+    OS_ATOMIC_BARRIER();
+    prevVal = HalAtomicXchg32bits(v, val);
+    OS_ATOMIC_BARRIER();
+    return prevVal;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic exchange for 32-bit variable with compare.
+ *
+ * @par Description:
+ * This API is used to write val to the 32-bit atomic variable if its value is equal to oldVal.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  val       [IN] The new value.
+ * @param  oldVal    [IN] The expected value.
+ *
+ * @retval TRUE  The previous value of the atomic variable is not equal to oldVal, nothing is written.
+ * @retval FALSE The previous value of the atomic variable is equal to oldVal, val is written.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicXchg32bits
+ */
+STATIC INLINE BOOL LOS_AtomicCmpXchg32bits(Atomic *v, INT32 val, INT32 oldVal)
+{
+    BOOL ret;
+
+    OS_ATOMIC_BARRIER();
+    ret = HalAtomicCmpXchg32bits(v, val, oldVal);
+    OS_ATOMIC_BARRIER();
+    return ret;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic bitwise OR.
+ *
+ * @par Description:
+ * This API is used to OR mask into the 32-bit atomic variable and return its previous value.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  mask      [IN] The bits to be set.
+ *
+ * @retval #INT32  The previous value of the atomic variable.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicFetchAnd
+ */
+STATIC INLINE INT32 LOS_AtomicFetchOr(Atomic *v, INT32 mask)
+{
+    return OsAtomicFetchOr32(v, mask);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic bitwise AND.
+ *
+ * @par Description:
+ * This API is used to AND mask into the 32-bit atomic variable and return its previous value.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  mask      [IN] The bits to be kept.
+ *
+ * @retval #INT32  The previous value of the atomic variable.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicFetchOr
+ */
+STATIC INLINE INT32 LOS_AtomicFetchAnd(Atomic *v, INT32 mask)
+{
+    return OsAtomicFetchAnd32(v, mask);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic bit setting.
+ *
+ * @par Description:
+ * This API is used to set one bit of the 32-bit atomic variable and return whether it was already set.
+ * @attention
+ * <ul>
+ * <li>The pointer v must not be NULL.</li>
+ * <li>The bit index must be less than 32.</li>
+ * </ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  bit       [IN] The bit index.
+ *
+ * @retval TRUE  The bit was set before the call.
+ * @retval FALSE The bit was clear before the call.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicBitClear
+ */
+STATIC INLINE BOOL LOS_AtomicBitSet(Atomic *v, UINT32 bit)
+{
+    UINT32 mask = 1U << bit;
+    return ((UINT32)OsAtomicFetchOr32(v, (INT32)mask) & mask) != 0;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic bit clearing.
+ *
+ * @par Description:
+ * This API is used to clear one bit of the 32-bit atomic variable and return whether it was set.
+ * @attention
+ * <ul>
+ * <li>The pointer v must not be NULL.</li>
+ * <li>The bit index must be less than 32.</li>
+ * </ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  bit       [IN] The bit index.
+ *
+ * @retval TRUE  The bit was set before the call.
+ * @retval FALSE The bit was clear before the call.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicBitSet
+ */
+STATIC INLINE BOOL LOS_AtomicBitClear(Atomic *v, UINT32 bit)
+{
+    UINT32 mask = 1U << bit;
+    return ((UINT32)OsAtomicFetchAnd32(v, (INT32)~mask) & mask) != 0;
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit read.
+ *
+ * @par Description:
+ * This API is used to read the value of the 64-bit atomic variable without tearing.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval #INT64  The value of the atomic variable.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64Set
+ */
+STATIC INLINE INT64 LOS_Atomic64Read(const Atomic64 *v)
+{
+    return OsAtomicLoad64(v);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit setting.
+ *
+ * @par Description:
+ * This API is used to set the value of the 64-bit atomic variable without tearing.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  setVal    [IN] The value to be set.
+ *
+ * @retval none.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64Read
+ */
+STATIC INLINE VOID LOS_Atomic64Set(Atomic64 *v, INT64 setVal)
+{
+    OsAtomicStore64(v, setVal);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit addition.
+ *
+ * @par Description:
+ * This API is used to add addVal to the 64-bit atomic variable and return the result.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  addVal    [IN] The addend.
+ *
+ * @retval #INT64  The value of the atomic variable after the addition.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64Sub
+ */
+STATIC INLINE INT64 LOS_Atomic64Add(Atomic64 *v, INT64 addVal)
+{
+    return (INT64)((UINT64)OsAtomicFetchAdd64(v, addVal) + (UINT64)addVal);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit subtraction.
+ *
+ * @par Description:
+ * This API is used to subtract subVal from the 64-bit atomic variable and return the result.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  subVal    [IN] The subtrahend.
+ *
+ * @retval #INT64  The value of the atomic variable after the subtraction.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64Add
+ */
+STATIC INLINE INT64 LOS_Atomic64Sub(Atomic64 *v, INT64 subVal)
+{
+    return LOS_Atomic64Add(v, (INT64)(0ULL - (UINT64)subVal));
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit auto-increment.
+ *
+ * @par Description:
+ * This API is used to increase the 64-bit atomic variable by 1.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval none.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64IncRet
+ */
+STATIC INLINE VOID LOS_Atomic64Inc(Atomic64 *v)
+{
+    (VOID)OsAtomicFetchAdd64(v, 1);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit auto-increment with result.
+ *
+ * @par Description:
+ * This API is used to increase the 64-bit atomic variable by 1 and return the result.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval #INT64  The value of the atomic variable after the increment.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64Inc
+ */
+STATIC INLINE INT64 LOS_Atomic64IncRet(Atomic64 *v)
+{
+    return LOS_Atomic64Add(v, 1);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit auto-decrement.
+ *
+ * @par Description:
+ * This API is used to decrease the 64-bit atomic variable by 1.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval none.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64DecRet
+ */
+STATIC INLINE VOID LOS_Atomic64Dec(Atomic64 *v)
+{
+    (VOID)OsAtomicFetchAdd64(v, -1);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic 64-bit auto-decrement with result.
+ *
+ * @par Description:
+ * This API is used to decrease the 64-bit atomic variable by 1 and return the result.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ *
+ * @retval #INT64  The value of the atomic variable after the decrement.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_Atomic64Dec
+ */
+STATIC INLINE INT64 LOS_Atomic64DecRet(Atomic64 *v)
+{
+    return LOS_Atomic64Add(v, -1);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic exchange for 64-bit variable.
+ *
+ * @par Description:
+ * This API is used to write val to the 64-bit atomic variable and return its previous value.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  val       [IN] The exchange value.
+ *
+ * @retval #INT64  The previous value of the atomic variable.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicCmpXchg64bits
+ */
+STATIC INLINE INT64 LOS_AtomicXchg64bits(Atomic64 *v, INT64 val)
+{
+    return OsAtomicXchg64(v, val);
+}
+
+/**
+ * @ingroup  los_atomic
+ * @brief Atomic exchange for 64-bit variable with compare.
+ *
+ * @par Description:
+ * This API is used to write val to the 64-bit atomic variable if its value is equal to oldVal.
+ * @attention
+ * <ul>The pointer v must not be NULL.</ul>
+ *
+ * @param  v         [IN] The variable pointer.
+ * @param  val       [IN] The new value.
+ * @param  oldVal    [IN] The expected value.
+ *
+ * @retval TRUE  The previous value of the atomic variable is not equal to oldVal, nothing is written.
+ * @retval FALSE The previous value of the atomic variable is equal to oldVal, val is written.
+ * @par Dependency:
+ * <ul><li>los_atomic.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_AtomicXchg64bits
+ */
+STATIC INLINE BOOL LOS_AtomicCmpXchg64bits(Atomic64 *v, INT64 val, INT64 oldVal)
+{
+    return OsAtomicCmpXchg64(v, val, oldVal) != oldVal;
+}
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -48,4 +745,3 @@ extern "C" {
 #endif /* __cplusplus */
 
 #endif /* _LOS_ATOMIC_H */
-
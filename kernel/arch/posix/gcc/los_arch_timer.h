@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _LOS_ARCH_TIMER_H
+#define _LOS_ARCH_TIMER_H
+
+#include "los_config.h"
+#include "los_compiler.h"
+#include "los_context.h"
+#include "los_interrupt.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_arch_timer
+ * Drive the tick from a virtual clock instead of the host timer.
+ *
+ * The virtual clock only moves forward when the idle task runs, which jumps it to the next timer or injected
+ * interrupt event, and by the costs charged through the cost model below. Timer and interrupt events are taken
+ * when interrupts are unlocked, so a run is reproducible as long as the tasks only depend on kernel services.
+ * A task spinning without any kernel call and without HalVirtualTimeAdvance never lets time move.
+ */
+#ifndef LOSCFG_ARCH_POSIX_VIRTUAL_TIME
+#define LOSCFG_ARCH_POSIX_VIRTUAL_TIME          0
+#endif
+
+/**
+ * @ingroup los_arch_timer
+ * Virtual cycles charged for each interrupt lock, the cost model of the kernel code paths.
+ */
+#ifndef LOSCFG_ARCH_POSIX_VIRTUAL_LOCK_CYCLES
+#define LOSCFG_ARCH_POSIX_VIRTUAL_LOCK_CYCLES   100
+#endif
+
+UINT32 HalTickStart(OS_TICK_HANDLER handler);
+
+#if (LOSCFG_ARCH_POSIX_VIRTUAL_TIME == 1)
+/**
+ * @ingroup los_arch_timer
+ * @brief Get the virtual clock.
+ *
+ * @par Description:
+ * This API is used to get the current virtual time in cycles of OS_SYS_CLOCK.
+ *
+ * @param None.
+ *
+ * @retval #UINT64 Virtual cycles since the tick started.
+ * @par Dependency:
+ * <ul><li>los_arch_timer.h: the header file that contains the API declaration.</li></ul>
+ * @see HalVirtualTimeAdvance
+ */
+UINT64 HalVirtualTimeGet(VOID);
+
+/**
+ * @ingroup los_arch_timer
+ * @brief Charge work of the running task to the virtual clock.
+ *
+ * @par Description:
+ * This API is used to model code that runs for the given number of cycles. The clock moves to each timer or
+ * injected interrupt event met on the way and takes it, so the task may be preempted before the call returns.
+ *
+ * @attention
+ * <ul>
+ * <li>The API must not be called in interrupt context or with interrupts locked.</li>
+ * </ul>
+ *
+ * @param cycles [IN] Number of cycles the work takes.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_arch_timer.h: the header file that contains the API declaration.</li></ul>
+ * @see HalVirtualTimeGet
+ */
+VOID HalVirtualTimeAdvance(UINT64 cycles);
+
+/**
+ * @ingroup los_arch_timer
+ * @brief Inject interrupts at pseudo random virtual times.
+ *
+ * @par Description:
+ * This API is used to trigger the interrupt repeatedly, each time after an interval drawn uniformly from
+ * [minInterval, maxInterval] cycles by a generator seeded with seed. The same seed gives the same sequence.
+ *
+ * @attention
+ * <ul>
+ * <li>There is a single injection source, a new call replaces the previous one.</li>
+ * <li>A maxInterval of 0 stops the injection.</li>
+ * </ul>
+ *
+ * @param hwiNum      [IN] Interrupt number to trigger.
+ * @param seed        [IN] Seed of the interval generator.
+ * @param minInterval [IN] Shortest interval in cycles, at least 1.
+ * @param maxInterval [IN] Longest interval in cycles.
+ *
+ * @retval #OS_ERRNO_HWI_NUM_INVALID The interrupt number is invalid.
+ * @retval #LOS_ERRNO_TICK_CFG_INVALID The interval range is invalid.
+ * @retval #LOS_OK The injection is set.
+ * @par Dependency:
+ * <ul><li>los_arch_timer.h: the header file that contains the API declaration.</li></ul>
+ * @see HalIrqPending
+ */
+UINT32 HalVirtualIrqInject(HWI_HANDLE_T hwiNum, UINT32 seed, UINT64 minInterval, UINT64 maxInterval);
+
+/**
+ * @ingroup los_arch_timer
+ * @brief Charge cycles to the virtual clock with interrupts locked.
+ *
+ * @par Description:
+ * This API is used by the cost model of the interrupt layer, the clock moves without taking any event.
+ *
+ * @param cycles [IN] Number of cycles to charge.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_arch_timer.h: the header file that contains the API declaration.</li></ul>
+ * @see HalVirtualTimeAdvance
+ */
+VOID HalVirtualTimeCharge(UINT64 cycles);
+
+/**
+ * @ingroup los_arch_timer
+ * @brief Take the virtual timer and interrupt events that are due.
+ *
+ * @par Description:
+ * This API is called by the interrupt layer right before interrupts are unlocked, it runs the due events the
+ * way the simulated interrupts run them.
+ *
+ * @param None.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_arch_timer.h: the header file that contains the API declaration.</li></ul>
+ */
+VOID HalVirtualTimeCheck(VOID);
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_ARCH_TIMER_H */
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_arch_context.h"
+#include <signal.h>
+#include <unistd.h>
+#include "los_arch_interrupt.h"
+#include "los_arch_timer.h"
+#include "los_task.h"
+#include "los_sched.h"
+#include "los_memory.h"
+#include "los_timer.h"
+#include "los_debug.h"
+
+STATIC UINT32 g_sysNeedSched = FALSE;
+
+/* *
+ * @ingroup los_context
+ * Host contexts of the tasks, indexed by task ID. Each task runs on the host stack kept here, the stack the kernel
+ * allocated for it only carries the magic word and the fill pattern.
+ */
+STATIC TaskContext g_taskContext[LOSCFG_BASE_CORE_TSK_LIMIT + 1];
+
+LITE_OS_SEC_TEXT_INIT VOID HalArchInit(VOID)
+{
+    UINT32 ret;
+    HalHwiInit();
+
+    ret = HalTickStart(OsTickHandler);
+    if (ret != LOS_OK) {
+        PRINT_ERR("Tick start failed!\n");
+        return;
+    }
+}
+
+VOID HalIrqEndCheckNeedSched(VOID)
+{
+    if (g_sysNeedSched) {
+        LOS_Schedule();
+    }
+}
+
+/* ****************************************************************************
+ Function    : HalTaskContextSwitch
+ Description : Switch from the running task to the new task, returns when the running task is scheduled again
+ Input       : intSave --- interrupt state of the running task, restored once it runs again
+ Output      : None
+ Return      : None
+ **************************************************************************** */
+VOID HalTaskContextSwitch(UINT32 intSave)
+{
+    LosTaskCB *runTask = g_losTask.runTask;
+    LosTaskCB *newTask = g_losTask.newTask;
+
+    g_losTask.runTask = newTask;
+    if (runTask != newTask) {
+        (VOID)swapcontext(&g_taskContext[runTask->taskID].context, &g_taskContext[newTask->taskID].context);
+    }
+
+    LOS_IntRestore(intSave);
+}
+
+VOID HalTaskSchedule(VOID)
+{
+    UINT32 intSave;
+
+    if (OS_INT_ACTIVE) {
+        g_sysNeedSched = TRUE;
+        return;
+    }
+
+    intSave = LOS_IntLock();
+    g_sysNeedSched = FALSE;
+    BOOL isSwitch = OsSchedTaskSwitch();
+    if (isSwitch) {
+        HalTaskContextSwitch(intSave);
+        return;
+    }
+
+    LOS_IntRestore(intSave);
+    return;
+}
+
+LITE_OS_SEC_TEXT_MINOR VOID HalSysExit(VOID)
+{
+    HalIntLock();
+    while (1) {
+        (VOID)pause();
+    }
+}
+
+STATIC VOID HalTaskEntry(UINT32 taskID)
+{
+    /* Tasks start with interrupts enabled, as they do on the hardware ports. */
+    (VOID)LOS_IntUnLock();
+    (VOID)OsTaskEntry(taskID);
+    HalSysExit();
+}
+
+LITE_OS_SEC_TEXT_INIT VOID *HalTskStackInit(UINT32 taskID, UINT32 stackSize, VOID *topStack)
+{
+    UINT32 index;
+    TaskContext *context = &g_taskContext[taskID];
+
+    /* initialize the task stack, write magic num to stack top */
+    for (index = 1; index < (stackSize / sizeof(UINT32)); index++) {
+        *((UINT32 *)topStack + index) = OS_TASK_STACK_INIT;
+    }
+    *((UINT32 *)(topStack)) = OS_TASK_MAGIC_WORD;
+
+    (VOID)getcontext(&context->context);
+    context->context.uc_stack.ss_sp = context->stack;
+    context->context.uc_stack.ss_size = sizeof(context->stack);
+    context->context.uc_link = NULL;
+    (VOID)sigemptyset(&context->context.uc_sigmask);
+    (VOID)sigaddset(&context->context.uc_sigmask, OS_POSIX_TICK_SIGNAL);
+    (VOID)sigaddset(&context->context.uc_sigmask, OS_POSIX_IRQ_SIGNAL);
+    makecontext(&context->context, (VOID (*)(VOID))HalTaskEntry, 1, taskID);
+
+    /* The stack check of the scheduler expects the pointer inside the task stack. */
+    return (VOID *)((UINTPTR)topStack + stackSize - sizeof(UINTPTR));
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 HalStartSchedule(VOID)
+{
+    (VOID)LOS_IntLock();
+    OsSchedStart();
+    (VOID)setcontext(&g_taskContext[g_losTask.runTask->taskID].context);
+    return LOS_OK; /* never return */
+}
+
+LITE_OS_SEC_TEXT VOID wfi(VOID)
+{
+    sigset_t set;
+
+    /* Sleep until a signal that is not masked right now is handled. */
+    (VOID)sigprocmask(SIG_SETMASK, NULL, &set);
+    (VOID)sigsuspend(&set);
+}
+
+LITE_OS_SEC_TEXT VOID mb(VOID)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+LITE_OS_SEC_TEXT VOID dsb(VOID)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_interrupt.h"
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "los_arch_interrupt.h"
+#include "los_arch_timer.h"
+#include "los_context.h"
+#include "los_debug.h"
+#include "los_hook.h"
+#include "los_task.h"
+#include "los_sched.h"
+
+#define OS_HWI_BITS_PER_WORD        32
+#define OS_HWI_PENDING_WORDS        ((OS_HWI_MAX_NUM + OS_HWI_BITS_PER_WORD - 1) / OS_HWI_BITS_PER_WORD)
+#define OS_EXC_SIGNAL_STACK_SIZE    0x4000
+#define OS_INT_UNLOCKED             0
+#define OS_INT_LOCKED               1
+
+UINT32 g_intCount = 0;
+
+/* *
+ * @ingroup los_hwi
+ * Handlers of the simulated interrupts.
+ */
+STATIC HWI_PROC_FUNC g_hwiForm[OS_HWI_MAX_NUM] = {0};
+
+#if (OS_HWI_WITH_ARG == 1)
+STATIC VOID *g_hwiParam[OS_HWI_MAX_NUM] = {0};
+#endif
+
+/* *
+ * @ingroup los_hwi
+ * Pending bits of the simulated interrupts, one bit per interrupt number.
+ */
+STATIC UINT32 g_hwiPending[OS_HWI_PENDING_WORDS] = {0};
+
+/* *
+ * @ingroup los_hwi
+ * Signals masked while interrupts are locked.
+ */
+STATIC sigset_t g_intSigSet;
+
+STATIC UINT8 g_excSignalStack[OS_EXC_SIGNAL_STACK_SIZE] __attribute__((aligned(16)));
+
+inline UINT32 HalIsIntActive(VOID)
+{
+    return (g_intCount > 0);
+}
+
+UINT32 HalIntLock(VOID)
+{
+    sigset_t oldSet;
+
+    (VOID)sigprocmask(SIG_BLOCK, &g_intSigSet, &oldSet);
+#if (LOSCFG_ARCH_POSIX_VIRTUAL_TIME == 1)
+    HalVirtualTimeCharge(LOSCFG_ARCH_POSIX_VIRTUAL_LOCK_CYCLES);
+#endif
+    return sigismember(&oldSet, OS_POSIX_TICK_SIGNAL) ? OS_INT_LOCKED : OS_INT_UNLOCKED;
+}
+
+UINT32 HalIntUnLock(VOID)
+{
+    sigset_t oldSet;
+
+#if (LOSCFG_ARCH_POSIX_VIRTUAL_TIME == 1)
+    (VOID)sigprocmask(SIG_SETMASK, NULL, &oldSet);
+    if (!sigismember(&oldSet, OS_POSIX_TICK_SIGNAL)) {
+        return OS_INT_UNLOCKED;
+    }
+    HalVirtualTimeCheck();
+#endif
+    (VOID)sigprocmask(SIG_UNBLOCK, &g_intSigSet, &oldSet);
+    return sigismember(&oldSet, OS_POSIX_TICK_SIGNAL) ? OS_INT_LOCKED : OS_INT_UNLOCKED;
+}
+
+VOID HalIntRestore(UINT32 intSave)
+{
+    if (intSave == OS_INT_UNLOCKED) {
+#if (LOSCFG_ARCH_POSIX_VIRTUAL_TIME == 1)
+        HalVirtualTimeCheck();
+#endif
+        (VOID)sigprocmask(SIG_UNBLOCK, &g_intSigSet, NULL);
+    }
+}
+
+WEAK VOID HalPreInterruptHandler(UINT32 arg)
+{
+    return;
+}
+
+WEAK VOID HalAftInterruptHandler(UINT32 arg)
+{
+    return;
+}
+
+STATIC VOID HalHwiDispatch(UINT32 hwiNum)
+{
+    OsHookCall(LOS_HOOK_TYPE_ISR_ENTER, hwiNum);
+
+    HalPreInterruptHandler(hwiNum);
+
+#if (OS_HWI_WITH_ARG == 1)
+    if (g_hwiForm[hwiNum] != NULL) {
+        g_hwiForm[hwiNum](g_hwiParam[hwiNum]);
+    }
+#else
+    if (g_hwiForm[hwiNum] != NULL) {
+        g_hwiForm[hwiNum]();
+    }
+#endif
+
+    HalAftInterruptHandler(hwiNum);
+
+    OsHookCall(LOS_HOOK_TYPE_ISR_EXIT, hwiNum);
+}
+
+/* ****************************************************************************
+ Function    : HalInterrupt
+ Description : Entry of the simulated interrupts, runs as the handler of OS_POSIX_IRQ_SIGNAL
+ Input       : sig --- signal number
+ Output      : None
+ Return      : None
+ **************************************************************************** */
+STATIC VOID HalInterrupt(INT32 sig)
+{
+    UINT32 index;
+    UINT32 pending;
+    UINT32 hwiNum;
+
+    (VOID)sig;
+    g_intCount++;
+
+    for (index = 0; index < OS_HWI_PENDING_WORDS; index++) {
+        pending = __atomic_exchange_n(&g_hwiPending[index], 0, __ATOMIC_SEQ_CST);
+        while (pending != 0) {
+            hwiNum = (UINT32)__builtin_ctz(pending);
+            pending &= pending - 1;
+            HalHwiDispatch((index * OS_HWI_BITS_PER_WORD) + hwiNum);
+        }
+    }
+
+    g_intCount--;
+    HalIrqEndCheckNeedSched();
+}
+
+/* ****************************************************************************
+ Function    : HalExcHandler
+ Description : Handler of the synchronous faults raised by the running task, runs on its own signal stack
+ Input       : sig --- signal number
+ Output      : None
+ Return      : None
+ **************************************************************************** */
+STATIC VOID HalExcHandler(INT32 sig)
+{
+    PRINT_ERR("signal %d in %s, task %s:%u\n", sig, OS_INT_ACTIVE ? "interrupt" : "task",
+              (g_losTask.runTask != NULL) ? g_losTask.runTask->taskName : "none",
+              (g_losTask.runTask != NULL) ? g_losTask.runTask->taskID : OS_INVALID);
+    OsDoExcHook(EXC_INTERRUPT);
+
+    /* Let the host report the fault, e.g. for a debugger or a core dump. */
+    (VOID)signal(sig, SIG_DFL);
+    (VOID)raise(sig);
+}
+
+/* ****************************************************************************
+ Function    : HalHwiCreate
+ Description : create hardware interrupt
+ Input       : hwiNum   --- hwi num to create
+               hwiPrio  --- priority of the hwi
+               mode     --- unused
+               handler --- hwi handler
+               arg      --- param of the hwi handler
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ **************************************************************************** */
+LITE_OS_SEC_TEXT_INIT UINT32 HalHwiCreate(HWI_HANDLE_T hwiNum,
+                                          HWI_PRIOR_T hwiPrio,
+                                          HWI_MODE_T mode,
+                                          HWI_PROC_FUNC handler,
+                                          HWI_ARG_T arg)
+{
+    UINT32 intSave;
+
+    (VOID)mode;
+    if (handler == NULL) {
+        return OS_ERRNO_HWI_PROC_FUNC_NULL;
+    }
+
+    if (hwiNum >= OS_HWI_MAX_NUM) {
+        return OS_ERRNO_HWI_NUM_INVALID;
+    }
+
+    if (g_hwiForm[hwiNum] != NULL) {
+        return OS_ERRNO_HWI_ALREADY_CREATED;
+    }
+
+    if (hwiPrio > OS_HWI_PRIO_LOWEST) {
+        return OS_ERRNO_HWI_PRIO_INVALID;
+    }
+
+    intSave = LOS_IntLock();
+    g_hwiForm[hwiNum] = handler;
+#if (OS_HWI_WITH_ARG == 1)
+    g_hwiParam[hwiNum] = (VOID *)(UINTPTR)arg;
+#else
+    (VOID)arg;
+#endif
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+/* ****************************************************************************
+ Function    : HalHwiDelete
+ Description : Delete hardware interrupt
+ Input       : hwiNum   --- hwi num to delete
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ **************************************************************************** */
+LITE_OS_SEC_TEXT_INIT UINT32 HalHwiDelete(HWI_HANDLE_T hwiNum)
+{
+    UINT32 intSave;
+
+    if (hwiNum >= OS_HWI_MAX_NUM) {
+        return OS_ERRNO_HWI_NUM_INVALID;
+    }
+
+    intSave = LOS_IntLock();
+    g_hwiForm[hwiNum] = NULL;
+    (VOID)HalIrqUnpending(hwiNum);
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+UINT32 HalIrqPending(HWI_HANDLE_T hwiNum)
+{
+    if (hwiNum >= OS_HWI_MAX_NUM) {
+        return OS_ERRNO_HWI_NUM_INVALID;
+    }
+
+    (VOID)__atomic_fetch_or(&g_hwiPending[hwiNum / OS_HWI_BITS_PER_WORD],
+                            1U << (hwiNum % OS_HWI_BITS_PER_WORD), __ATOMIC_SEQ_CST);
+    (VOID)kill(getpid(), OS_POSIX_IRQ_SIGNAL);
+    return LOS_OK;
+}
+
+UINT32 HalIrqUnpending(HWI_HANDLE_T hwiNum)
+{
+    if (hwiNum >= OS_HWI_MAX_NUM) {
+        return OS_ERRNO_HWI_NUM_INVALID;
+    }
+
+    (VOID)__atomic_fetch_and(&g_hwiPending[hwiNum / OS_HWI_BITS_PER_WORD],
+                             ~(1U << (hwiNum % OS_HWI_BITS_PER_WORD)), __ATOMIC_SEQ_CST);
+    return LOS_OK;
+}
+
+/* ****************************************************************************
+ Function    : HalSignalSet
+ Description : Install a host signal handler
+ Input       : sig     --- signal number
+               handler --- signal handler
+               flags   --- sigaction flags
+ Output      : None
+ Return      : None
+ **************************************************************************** */
+VOID HalSignalSet(INT32 sig, VOID (*handler)(INT32), INT32 flags)
+{
+    struct sigaction action = {0};
+
+    action.sa_handler = handler;
+    action.sa_mask = g_intSigSet;
+    action.sa_flags = flags;
+    if (sigaction(sig, &action, NULL) != 0) {
+        PRINT_ERR("sigaction %d failed\n", sig);
+        abort();
+    }
+}
+
+/* ****************************************************************************
+ Function    : HalHwiInit
+ Description : initialization of the simulated interrupt controller
+ Input       : None
+ Output      : None
+ Return      : None
+ **************************************************************************** */
+LITE_OS_SEC_TEXT_INIT VOID HalHwiInit(VOID)
+{
+    stack_t excStack = {0};
+
+    (VOID)sigemptyset(&g_intSigSet);
+    (VOID)sigaddset(&g_intSigSet, OS_POSIX_TICK_SIGNAL);
+    (VOID)sigaddset(&g_intSigSet, OS_POSIX_IRQ_SIGNAL);
+
+    HalSignalSet(OS_POSIX_IRQ_SIGNAL, HalInterrupt, SA_RESTART);
+
+    /* A stack overflow of the task leaves no room for the handler, so faults use a stack of their own. */
+    excStack.ss_sp = g_excSignalStack;
+    excStack.ss_size = sizeof(g_excSignalStack);
+    if (sigaltstack(&excStack, NULL) != 0) {
+        PRINT_ERR("sigaltstack failed\n");
+    }
+    HalSignalSet(SIGSEGV, HalExcHandler, SA_ONSTACK);
+    HalSignalSet(SIGBUS, HalExcHandler, SA_ONSTACK);
+    HalSignalSet(SIGILL, HalExcHandler, SA_ONSTACK);
+    HalSignalSet(SIGFPE, HalExcHandler, SA_ONSTACK);
+}
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_timer.h"
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include "los_config.h"
+#include "los_tick.h"
+#include "los_arch_interrupt.h"
+#include "los_arch_context.h"
+#include "los_sched.h"
+#include "los_arch_timer.h"
+
+#define OS_TICK_MIN_RESPONSE_US     1
+
+STATIC OS_TICK_HANDLER g_tickHandler = NULL;
+#if (LOSCFG_ARCH_POSIX_VIRTUAL_TIME == 1)
+#define OS_VIRTUAL_TIME_NEVER       ((UINT64)-1)
+#define OS_VIRTUAL_IRQ_DEFAULT_SEED 0x9E3779B9U
+
+STATIC UINT64 g_virtualCycle = 0;
+STATIC UINT64 g_virtualTickExpire = OS_VIRTUAL_TIME_NEVER;
+STATIC BOOL g_virtualTickLocked = FALSE;
+STATIC BOOL g_virtualTimeBusy = FALSE;
+
+STATIC HWI_HANDLE_T g_virtualIrqNum;
+STATIC UINT32 g_virtualIrqState;
+STATIC UINT64 g_virtualIrqMin;
+STATIC UINT64 g_virtualIrqRange;
+STATIC UINT64 g_virtualIrqExpire = OS_VIRTUAL_TIME_NEVER;
+#else
+STATIC struct timespec g_tickStartTime;
+STATIC struct itimerval g_tickLockedTimer;
+#endif
+
+#if (LOSCFG_ARCH_POSIX_VIRTUAL_TIME == 1)
+STATIC UINT32 HalVirtualRandom(VOID)
+{
+    /* xorshift32, the same seed always gives the same intervals */
+    UINT32 x = g_virtualIrqState;
+
+    x ^= x << 13; /* 13: xorshift32 shift */
+    x ^= x >> 17; /* 17: xorshift32 shift */
+    x ^= x << 5;  /* 5: xorshift32 shift */
+    g_virtualIrqState = x;
+    return x;
+}
+
+STATIC VOID HalVirtualIrqNext(VOID)
+{
+    g_virtualIrqExpire = g_virtualCycle + g_virtualIrqMin + (HalVirtualRandom() % g_virtualIrqRange);
+}
+
+STATIC UINT64 HalVirtualNextEvent(VOID)
+{
+    UINT64 next = g_virtualIrqExpire;
+
+    if (!g_virtualTickLocked && (g_virtualTickExpire < next)) {
+        next = g_virtualTickExpire;
+    }
+    return next;
+}
+
+/* ****************************************************************************
+ Function    : HalVirtualTimeCheck
+ Description : Take the due virtual events, called with interrupts locked right before they are unlocked
+ Input       : None
+ Output      : None
+ Return      : None
+ **************************************************************************** */
+VOID HalVirtualTimeCheck(VOID)
+{
+    BOOL tickDue;
+
+    if (g_virtualTimeBusy || OS_INT_ACTIVE) {
+        return;
+    }
+
+    g_virtualTimeBusy = TRUE;
+    if (g_virtualIrqExpire <= g_virtualCycle) {
+        /* Taken by the interrupt signal once the caller unlocks interrupts. */
+        (VOID)HalIrqPending(g_virtualIrqNum);
+        HalVirtualIrqNext();
+    }
+
+    tickDue = !g_virtualTickLocked && (g_virtualTickExpire <= g_virtualCycle) && (g_tickHandler != NULL);
+    if (tickDue) {
+        /* One shot, the handler reloads through HalSysTickReload. */
+        g_virtualTickExpire = OS_VIRTUAL_TIME_NEVER;
+        g_intCount++;
+        g_tickHandler();
+        g_intCount--;
+    }
+    g_virtualTimeBusy = FALSE;
+
+    if (tickDue) {
+        HalIrqEndCheckNeedSched();
+    }
+}
+
+UINT64 HalVirtualTimeGet(VOID)
+{
+    return g_virtualCycle;
+}
+
+VOID HalVirtualTimeCharge(UINT64 cycles)
+{
+    /* The events met are taken when interrupts are unlocked, late by at most this charge. */
+    g_virtualCycle += cycles;
+}
+
+VOID HalVirtualTimeAdvance(UINT64 cycles)
+{
+    UINT32 intSave;
+    UINT64 next;
+
+    while (cycles != 0) {
+        intSave = LOS_IntLock();
+        next = HalVirtualNextEvent();
+        if ((next > g_virtualCycle) && ((next - g_virtualCycle) < cycles)) {
+            cycles -= next - g_virtualCycle;
+            g_virtualCycle = next;
+        } else {
+            g_virtualCycle += cycles;
+            cycles = 0;
+        }
+        LOS_IntRestore(intSave);
+    }
+}
+
+UINT32 HalVirtualIrqInject(HWI_HANDLE_T hwiNum, UINT32 seed, UINT64 minInterval, UINT64 maxInterval)
+{
+    UINT32 intSave;
+
+    if (hwiNum >= OS_HWI_MAX_NUM) {
+        return OS_ERRNO_HWI_NUM_INVALID;
+    }
+
+    if ((maxInterval != 0) && ((minInterval == 0) || (minInterval > maxInterval))) {
+        return LOS_ERRNO_TICK_CFG_INVALID;
+    }
+
+    intSave = LOS_IntLock();
+    if (maxInterval == 0) {
+        g_virtualIrqExpire = OS_VIRTUAL_TIME_NEVER;
+    } else {
+        g_virtualIrqNum = hwiNum;
+        g_virtualIrqState = (seed != 0) ? seed : OS_VIRTUAL_IRQ_DEFAULT_SEED;
+        g_virtualIrqMin = minInterval;
+        g_virtualIrqRange = maxInterval - minInterval + 1;
+        HalVirtualIrqNext();
+    }
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+WEAK UINT32 HalTickStart(OS_TICK_HANDLER handler)
+{
+    if ((OS_SYS_CLOCK == 0) ||
+        (LOSCFG_BASE_CORE_TICK_PER_SECOND == 0) ||
+        (LOSCFG_BASE_CORE_TICK_PER_SECOND > OS_SYS_CLOCK)) {
+        return LOS_ERRNO_TICK_CFG_INVALID;
+    }
+
+    g_sysClock = OS_SYS_CLOCK;
+    g_cyclesPerTick = OS_SYS_CLOCK / LOSCFG_BASE_CORE_TICK_PER_SECOND;
+    g_intCount = 0;
+    g_tickHandler = handler;
+
+    g_virtualCycle = 0;
+    g_virtualTickExpire = LOSCFG_BASE_CORE_TICK_RESPONSE_MAX;
+
+    return LOS_OK;
+}
+
+WEAK VOID HalSysTickReload(UINT64 nextResponseTime)
+{
+    g_virtualTickExpire = g_virtualCycle + nextResponseTime;
+}
+
+WEAK UINT64 HalGetTickCycle(UINT32 *period)
+{
+    (VOID)period;
+    return g_virtualCycle;
+}
+
+WEAK VOID HalTickLock(VOID)
+{
+    g_virtualTickLocked = TRUE;
+}
+
+WEAK VOID HalTickUnlock(VOID)
+{
+    g_virtualTickLocked = FALSE;
+}
+
+UINT32 HalEnterSleep(VOID)
+{
+    UINT32 intSave = LOS_IntLock();
+    UINT64 next = HalVirtualNextEvent();
+
+    /* Every task is blocked, nothing happens before the next event. */
+    if ((next != OS_VIRTUAL_TIME_NEVER) && (next > g_virtualCycle)) {
+        g_virtualCycle = next;
+    }
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+#else
+/* ****************************************************************************
+ Function    : HalTickSignalHandler
+ Description : Tick interrupt entry, runs as the handler of OS_POSIX_TICK_SIGNAL
+ Input       : sig --- signal number
+ Output      : None
+ Return      : None
+ **************************************************************************** */
+STATIC VOID HalTickSignalHandler(INT32 sig)
+{
+    (VOID)sig;
+    g_intCount++;
+    if (g_tickHandler != NULL) {
+        g_tickHandler();
+    }
+    g_intCount--;
+    HalIrqEndCheckNeedSched();
+}
+
+STATIC VOID HalTickTimerSet(UINT64 cycle)
+{
+    struct itimerval timer;
+    UINT64 us = OS_SYS_CYCLE_TO_NS(cycle, g_sysClock) / OS_SYS_NS_PER_US;
+
+    if (us < OS_TICK_MIN_RESPONSE_US) {
+        us = OS_TICK_MIN_RESPONSE_US;
+    }
+
+    /* Periodic like a reloading tick timer, the next reload replaces the period. */
+    timer.it_value.tv_sec = (time_t)(us / OS_SYS_US_PER_SECOND);
+    timer.it_value.tv_usec = (suseconds_t)(us % OS_SYS_US_PER_SECOND);
+    timer.it_interval = timer.it_value;
+    (VOID)setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+WEAK UINT32 HalTickStart(OS_TICK_HANDLER handler)
+{
+    if ((OS_SYS_CLOCK == 0) ||
+        (LOSCFG_BASE_CORE_TICK_PER_SECOND == 0) ||
+        (LOSCFG_BASE_CORE_TICK_PER_SECOND > OS_SYS_CLOCK)) {
+        return LOS_ERRNO_TICK_CFG_INVALID;
+    }
+
+    g_sysClock = OS_SYS_CLOCK;
+    g_cyclesPerTick = OS_SYS_CLOCK / LOSCFG_BASE_CORE_TICK_PER_SECOND;
+    g_intCount = 0;
+    g_tickHandler = handler;
+
+    (VOID)clock_gettime(CLOCK_MONOTONIC, &g_tickStartTime);
+    HalSignalSet(OS_POSIX_TICK_SIGNAL, HalTickSignalHandler, SA_RESTART);
+    HalTickTimerSet(LOSCFG_BASE_CORE_TICK_RESPONSE_MAX);
+
+    return LOS_OK;
+}
+
+WEAK VOID HalSysTickReload(UINT64 nextResponseTime)
+{
+    HalTickTimerSet(nextResponseTime);
+}
+
+WEAK UINT64 HalGetTickCycle(UINT32 *period)
+{
+    struct timespec now;
+    UINT64 ns;
+
+    (VOID)period;
+    (VOID)clock_gettime(CLOCK_MONOTONIC, &now);
+    ns = ((UINT64)(now.tv_sec - g_tickStartTime.tv_sec) * OS_SYS_NS_PER_SECOND) +
+         (UINT64)now.tv_nsec - (UINT64)g_tickStartTime.tv_nsec;
+    return OS_SYS_NS_TO_CYCLE(ns, g_sysClock);
+}
+
+WEAK VOID HalTickLock(VOID)
+{
+    struct itimerval stop = {0};
+
+    (VOID)setitimer(ITIMER_REAL, &stop, &g_tickLockedTimer);
+}
+
+WEAK VOID HalTickUnlock(VOID)
+{
+    (VOID)setitimer(ITIMER_REAL, &g_tickLockedTimer, NULL);
+}
+
+UINT32 HalEnterSleep(VOID)
+{
+    wfi();
+
+    return LOS_OK;
+}
+#endif
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_arena Arena
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_ARENA_H
+#define _LOS_ARENA_H
+
+#include "los_config.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_MEM_ARENA == 1)
+/**
+ * @ingroup los_arena
+ * Arena usage.
+ */
+typedef struct {
+    UINT32 usedSize;     /**< Bytes handed out since the arena was created or last reset */
+    UINT32 peakUsedSize; /**< Maximum of usedSize over the life of the arena */
+    UINT32 totalSize;    /**< Bytes the arena holds from its parent memory pool */
+    UINT32 chunkNum;     /**< Number of chunks the arena holds from its parent memory pool */
+} LOS_ARENA_STATUS;
+
+/**
+ * @ingroup los_arena
+ * @brief Create an arena.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to create an arena that hands out memory by advancing a pointer through chunks taken
+ * from a parent memory pool, and gives it all back at once by LOS_ArenaReset or LOS_ArenaDestroy. It suits
+ * the many small allocations that live and die together, such as the ones of a request handler.</li>
+ * <li>The first chunk is allocated with the arena itself and is kept by LOS_ArenaReset.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The pool parameter must be initialized via func LOS_MemInit.</li>
+ * <li>An arena is not protected against concurrent use, it should be used by one task at a time.</li>
+ * </ul>
+ *
+ * @param pool      [IN] Parent memory pool address.
+ * @param chunkSize [IN] Usable size of each chunk. Requests larger than it get a chunk of their own.
+ *
+ * @retval #VOID*   The arena is created, and return its handle.
+ * @retval #NULL    The arena fails to be created.
+ * @par Dependency:
+ * <ul>
+ * <li>los_arena.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_ArenaDestroy
+ */
+extern VOID *LOS_ArenaCreate(VOID *pool, UINT32 chunkSize);
+
+/**
+ * @ingroup los_arena
+ * @brief Allocate memory from an arena.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to allocate size bytes aligned to the size of a pointer from an arena. The memory is
+ * not freed individually, but together with all the other memory of the arena.</li>
+ * </ul>
+ *
+ * @param arena [IN] Arena handle returned by LOS_ArenaCreate.
+ * @param size  [IN] Size of the memory to allocate.
+ *
+ * @retval #VOID*   The memory is allocated, and return its address.
+ * @retval #NULL    The memory fails to be allocated.
+ * @par Dependency:
+ * <ul>
+ * <li>los_arena.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_ArenaReset
+ */
+extern VOID *LOS_ArenaAlloc(VOID *arena, UINT32 size);
+
+/**
+ * @ingroup los_arena
+ * @brief Allocate aligned memory from an arena.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to allocate size bytes aligned to boundary from an arena.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The boundary parameter must be a power of 2. Boundaries smaller than the size of a pointer are
+ * rounded up to it.</li>
+ * </ul>
+ *
+ * @param arena    [IN] Arena handle returned by LOS_ArenaCreate.
+ * @param size     [IN] Size of the memory to allocate.
+ * @param boundary [IN] Boundary the memory is aligned to.
+ *
+ * @retval #VOID*   The memory is allocated, and return its address.
+ * @retval #NULL    The memory fails to be allocated.
+ * @par Dependency:
+ * <ul>
+ * <li>los_arena.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_ArenaAlloc
+ */
+extern VOID *LOS_ArenaAllocAlign(VOID *arena, UINT32 size, UINT32 boundary);
+
+/**
+ * @ingroup los_arena
+ * @brief Free all the memory allocated from an arena.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to free all the memory allocated from an arena in one call. The chunks added after
+ * the first one are given back to the parent memory pool, and the arena can be used again.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>No destructor or cleanup runs for the objects in the arena.</li>
+ * </ul>
+ *
+ * @param arena [IN] Arena handle returned by LOS_ArenaCreate.
+ *
+ * @retval #LOS_NOK   The arena handle is NULL.
+ * @retval #LOS_OK    The arena is reset.
+ * @par Dependency:
+ * <ul>
+ * <li>los_arena.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_ArenaAlloc | LOS_ArenaDestroy
+ */
+extern UINT32 LOS_ArenaReset(VOID *arena);
+
+/**
+ * @ingroup los_arena
+ * @brief Destroy an arena.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to give all the chunks and the arena itself back to the parent memory pool.</li>
+ * </ul>
+ *
+ * @param arena [IN] Arena handle returned by LOS_ArenaCreate.
+ *
+ * @retval #LOS_NOK   The arena fails to be destroyed.
+ * @retval #LOS_OK    The arena is destroyed.
+ * @par Dependency:
+ * <ul>
+ * <li>los_arena.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_ArenaCreate
+ */
+extern UINT32 LOS_ArenaDestroy(VOID *arena);
+
+/**
+ * @ingroup los_arena
+ * @brief Get the usage of an arena.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to get the memory an arena handed out and holds, which helps to choose its chunk
+ * size.</li>
+ * </ul>
+ *
+ * @param arena  [IN]  Arena handle returned by LOS_ArenaCreate.
+ * @param status [OUT] Usage of the arena.
+ *
+ * @retval #LOS_NOK   The usage fails to be got.
+ * @retval #LOS_OK    The usage is got.
+ * @par Dependency:
+ * <ul>
+ * <li>los_arena.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_ArenaCreate
+ */
+extern UINT32 LOS_ArenaInfoGet(const VOID *arena, LOS_ARENA_STATUS *status);
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_ARENA_H */
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_barrier Barrier
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_BARRIER_H
+#define _LOS_BARRIER_H
+
+#include "los_task.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: The memory request fails.
+ *
+ * Value: 0x02002500
+ *
+ * Solution: Decrease the number of barriers defined by LOSCFG_BASE_IPC_BARRIER_LIMIT.
+ */
+#define LOS_ERRNO_BARRIER_NO_MEMORY         LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x00)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: The barrier is not usable.
+ *
+ * Value: 0x02002501
+ *
+ * Solution: Check whether the barrier ID is valid and the barrier is created.
+ */
+#define LOS_ERRNO_BARRIER_INVALID           LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x01)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: Null pointer.
+ *
+ * Value: 0x02002502
+ *
+ * Solution: Check whether the input parameter is usable.
+ */
+#define LOS_ERRNO_BARRIER_PTR_NULL          LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x02)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: No barrier is available and the creation fails.
+ *
+ * Value: 0x02002503
+ *
+ * Solution: Increase the number of barriers defined by LOSCFG_BASE_IPC_BARRIER_LIMIT.
+ */
+#define LOS_ERRNO_BARRIER_ALL_BUSY          LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x03)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: The barrier is waited on during an interrupt.
+ *
+ * Value: 0x02002504
+ *
+ * Solution: Do not wait on a barrier during an interrupt.
+ */
+#define LOS_ERRNO_BARRIER_PEND_INTERR       LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x04)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: The barrier is waited on while task scheduling is disabled.
+ *
+ * Value: 0x02002505
+ *
+ * Solution: Enable task scheduling before waiting.
+ */
+#define LOS_ERRNO_BARRIER_PEND_IN_LOCK      LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x05)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: Waiting for the other tasks times out.
+ *
+ * Value: 0x02002506
+ *
+ * Solution: Increase the waiting time or set the waiting time to LOS_WAIT_FOREVER.
+ */
+#define LOS_ERRNO_BARRIER_TIMEOUT           LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x06)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: The barrier to be deleted is waited on.
+ *
+ * Value: 0x02002507
+ *
+ * Solution: Delete the barrier after all waiters have been released.
+ */
+#define LOS_ERRNO_BARRIER_PENDED            LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x07)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: LOSCFG_BASE_IPC_BARRIER_LIMIT is zero.
+ *
+ * Value: 0x02002508
+ *
+ * Solution: LOSCFG_BASE_IPC_BARRIER_LIMIT should not be zero.
+ */
+#define LOS_ERRNO_BARRIER_MAXNUM_ZERO       LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x08)
+
+/**
+ * @ingroup los_barrier
+ * Barrier error code: The number of tasks the barrier waits for is zero.
+ *
+ * Value: 0x02002509
+ *
+ * Solution: Create the barrier with a count of at least one.
+ */
+#define LOS_ERRNO_BARRIER_COUNT_INVALID     LOS_ERRNO_OS_ERROR(LOS_MOD_BARRIER, 0x09)
+
+/**
+ * @ingroup los_barrier
+ * @brief Create a barrier.
+ *
+ * @par Description:
+ * This API is used to create a barrier that releases its waiters each time count tasks have arrived at it.
+ * A handle is assigned to barrierID when it is created successfully.
+ *
+ * @param count       [IN]  Number of tasks to wait for. The value range is [1, 0xFFFF].
+ * @param barrierID   [OUT] Handle of the barrier, in [0, LOSCFG_BASE_IPC_BARRIER_LIMIT - 1].
+ *
+ * @retval #LOS_ERRNO_BARRIER_PTR_NULL       The barrierID pointer is NULL.
+ * @retval #LOS_ERRNO_BARRIER_COUNT_INVALID  The count is zero.
+ * @retval #LOS_ERRNO_BARRIER_ALL_BUSY       No available barrier.
+ * @retval #LOS_OK                           The barrier is successfully created.
+ * @par Dependency:
+ * <ul><li>los_barrier.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_BarrierDelete
+ */
+extern UINT32 LOS_BarrierCreate(UINT16 count, UINT32 *barrierID);
+
+/**
+ * @ingroup los_barrier
+ * @brief Delete a barrier.
+ *
+ * @par Description:
+ * This API is used to delete a barrier no task waits on.
+ *
+ * @param barrierID   [IN] Handle of the barrier.
+ *
+ * @retval #LOS_ERRNO_BARRIER_INVALID        Invalid handle or barrier not in use.
+ * @retval #LOS_ERRNO_BARRIER_PENDED         Tasks wait on the barrier.
+ * @retval #LOS_OK                           The barrier is successfully deleted.
+ * @par Dependency:
+ * <ul><li>los_barrier.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_BarrierCreate
+ */
+extern UINT32 LOS_BarrierDelete(UINT32 barrierID);
+
+/**
+ * @ingroup los_barrier
+ * @brief Wait at a barrier.
+ *
+ * @par Description:
+ * This API blocks the calling task until count tasks, itself included, have arrived at the barrier. The task that
+ * arrives last releases all others without blocking, and the barrier is ready for the next round right away.
+ * @attention
+ * <ul>
+ * <li>Do not wait on a barrier during an interrupt or while task scheduling is disabled.</li>
+ * <li>A task whose wait times out is no longer counted as arrived. A timeout of 0 only succeeds for the task that
+ * arrives last.</li>
+ * </ul>
+ *
+ * @param barrierID   [IN]  Handle of the barrier.
+ * @param timeout     [IN]  Waiting time. The value range is [0, LOS_WAIT_FOREVER](unit: Tick).
+ * @param isLast      [OUT] Set to TRUE for the task that released the barrier and to FALSE for the others. It may
+ * be NULL.
+ *
+ * @retval #LOS_ERRNO_BARRIER_INVALID        The barrier is not in use.
+ * @retval #LOS_ERRNO_BARRIER_PEND_INTERR    Called during an interrupt.
+ * @retval #LOS_ERRNO_BARRIER_PEND_IN_LOCK   Called while task scheduling is disabled.
+ * @retval #LOS_ERRNO_BARRIER_TIMEOUT        The other tasks did not arrive within timeout ticks.
+ * @retval #LOS_OK                           The barrier was released.
+ * @par Dependency:
+ * <ul><li>los_barrier.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_BarrierCreate
+ */
+extern UINT32 LOS_BarrierWait(UINT32 barrierID, UINT32 timeout, BOOL *isLast);
+
+/**
+ * @ingroup los_barrier
+ * Barrier object.
+ */
+typedef struct {
+    UINT8 barrierStat;         /**< State OS_BARRIER_UNUSED, OS_BARRIER_USED */
+    UINT16 count;              /**< Number of tasks that release the barrier */
+    UINT16 arrived;            /**< Number of tasks waiting in the current round */
+    UINT16 round;              /**< Incremented each time the barrier is released */
+    UINT32 barrierID;          /**< Handle ID */
+    LOS_DL_LIST barrierList;   /**< Waiting tasks, the free list node while unused */
+} LosBarrierCB;
+
+/**
+ * @ingroup los_barrier
+ * Barrier state: not in use.
+ */
+#define OS_BARRIER_UNUSED 0
+
+/**
+ * @ingroup los_barrier
+ * Barrier state: in use.
+ */
+#define OS_BARRIER_USED   1
+
+extern LosBarrierCB *g_allBarrier;
+
+/**
+ * @ingroup los_barrier
+ * Obtain the pointer to the barrier object that has a specified handle.
+ */
+#define GET_BARRIER(barrierID) (((LosBarrierCB *)g_allBarrier) + (barrierID))
+
+/**
+ * @ingroup los_barrier
+ * Obtain the barrier object from its list node.
+ */
+#define GET_BARRIER_LIST(ptr) LOS_DL_LIST_ENTRY(ptr, LosBarrierCB, barrierList)
+
+/**
+ * @ingroup los_barrier
+ * @brief Initializes the barriers.
+ *
+ * @par Description:
+ * This API is used to allocate the barrier control blocks during kernel initialization.
+ *
+ * @retval UINT32     Initialization result.
+ * @par Dependency:
+ * <ul><li>los_barrier.h: the header file that contains the API declaration.</li></ul>
+ */
+extern UINT32 OsBarrierInit(VOID);
+
+/**
+ * @ingroup los_barrier
+ * @brief Takes back the arrival of a task that left the barrier.
+ *
+ * @par Description:
+ * This API is used after a task waiting at the barrier was taken off its queue other than by the barrier being
+ * released, e.g. when the task was deleted. If the round the task arrived in has not been released, the task no
+ * longer counts towards it.
+ * @attention
+ * <ul>
+ * <li>It must be called with interrupts locked.</li>
+ * </ul>
+ *
+ * @param  barrier    [IN]Type  #LosBarrierCB * Barrier the task arrived at.
+ * @param  round      [IN]Type  #UINT16 Round the task arrived in.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_barrier.h: the header file that contains the API declaration.</li></ul>
+ * @see None.
+ */
+extern VOID OsBarrierWaiterLeft(LosBarrierCB *barrier, UINT16 round);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* __cplusplus */
+
+#endif /* _LOS_BARRIER_H */
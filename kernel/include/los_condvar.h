@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_condvar Condition variable
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_CONDVAR_H
+#define _LOS_CONDVAR_H
+
+#include "los_mux.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: The memory request fails.
+ *
+ * Value: 0x02002400
+ *
+ * Solution: Decrease the number of condition variables defined by LOSCFG_BASE_IPC_CONDVAR_LIMIT.
+ */
+#define LOS_ERRNO_CONDVAR_NO_MEMORY         LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x00)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: The condition variable is not usable.
+ *
+ * Value: 0x02002401
+ *
+ * Solution: Check whether the condition variable ID is valid and the condition variable is created.
+ */
+#define LOS_ERRNO_CONDVAR_INVALID           LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x01)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: Null pointer.
+ *
+ * Value: 0x02002402
+ *
+ * Solution: Check whether the input parameter is usable.
+ */
+#define LOS_ERRNO_CONDVAR_PTR_NULL          LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x02)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: No condition variable is available and the creation fails.
+ *
+ * Value: 0x02002403
+ *
+ * Solution: Increase the number of condition variables defined by LOSCFG_BASE_IPC_CONDVAR_LIMIT.
+ */
+#define LOS_ERRNO_CONDVAR_ALL_BUSY          LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x03)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: The condition variable is waited on during an interrupt.
+ *
+ * Value: 0x02002404
+ *
+ * Solution: Do not wait on a condition variable during an interrupt.
+ */
+#define LOS_ERRNO_CONDVAR_PEND_INTERR       LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x04)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: The condition variable is waited on while task scheduling is disabled.
+ *
+ * Value: 0x02002405
+ *
+ * Solution: Enable task scheduling before waiting.
+ */
+#define LOS_ERRNO_CONDVAR_PEND_IN_LOCK      LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x05)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: Waiting for the condition variable times out.
+ *
+ * Value: 0x02002406
+ *
+ * Solution: Increase the waiting time or set the waiting time to LOS_WAIT_FOREVER.
+ */
+#define LOS_ERRNO_CONDVAR_TIMEOUT           LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x06)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: The condition variable to be deleted is waited on.
+ *
+ * Value: 0x02002407
+ *
+ * Solution: Delete the condition variable after all waiters have been woken.
+ */
+#define LOS_ERRNO_CONDVAR_PENDED            LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x07)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: LOSCFG_BASE_IPC_CONDVAR_LIMIT is zero.
+ *
+ * Value: 0x02002408
+ *
+ * Solution: LOSCFG_BASE_IPC_CONDVAR_LIMIT should not be zero.
+ */
+#define LOS_ERRNO_CONDVAR_MAXNUM_ZERO       LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x08)
+
+/**
+ * @ingroup los_condvar
+ * Condition variable error code: The mutex passed to LOS_CondWait is not locked exactly once by the caller.
+ *
+ * Value: 0x02002409
+ *
+ * Solution: Lock the mutex once before waiting on the condition variable.
+ */
+#define LOS_ERRNO_CONDVAR_MUX_INVALID       LOS_ERRNO_OS_ERROR(LOS_MOD_CONDVAR, 0x09)
+
+/**
+ * @ingroup los_condvar
+ * @brief Create a condition variable.
+ *
+ * @par Description:
+ * This API is used to create a condition variable. A handle is assigned to condID when it is created successfully.
+ *
+ * @param condID      [OUT] Handle of the condition variable, in [0, LOSCFG_BASE_IPC_CONDVAR_LIMIT - 1].
+ *
+ * @retval #LOS_ERRNO_CONDVAR_PTR_NULL       The condID pointer is NULL.
+ * @retval #LOS_ERRNO_CONDVAR_ALL_BUSY       No available condition variable.
+ * @retval #LOS_OK                           The condition variable is successfully created.
+ * @par Dependency:
+ * <ul><li>los_condvar.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_CondDelete
+ */
+extern UINT32 LOS_CondCreate(UINT32 *condID);
+
+/**
+ * @ingroup los_condvar
+ * @brief Delete a condition variable.
+ *
+ * @par Description:
+ * This API is used to delete a condition variable no task waits on.
+ *
+ * @param condID      [IN] Handle of the condition variable.
+ *
+ * @retval #LOS_ERRNO_CONDVAR_INVALID        Invalid handle or condition variable not in use.
+ * @retval #LOS_ERRNO_CONDVAR_PENDED         Tasks wait on the condition variable.
+ * @retval #LOS_OK                           The condition variable is successfully deleted.
+ * @par Dependency:
+ * <ul><li>los_condvar.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_CondCreate
+ */
+extern UINT32 LOS_CondDelete(UINT32 condID);
+
+/**
+ * @ingroup los_condvar
+ * @brief Wait on a condition variable.
+ *
+ * @par Description:
+ * This API unlocks the mutex and starts waiting on the condition variable as one step, so a signal sent by a task
+ * that took the mutex after the unlock is never lost. The mutex is locked again before the API returns, also when
+ * the wait times out.
+ * @attention
+ * <ul>
+ * <li>The mutex must be locked exactly once by the calling task.</li>
+ * <li>Do not wait on a condition variable during an interrupt or while task scheduling is disabled.</li>
+ * <li>Wakeups are not tied to the state the caller waits for. Check the condition again after returning.</li>
+ * </ul>
+ *
+ * @param condID      [IN] Handle of the condition variable.
+ * @param muxHandle   [IN] Handle of the mutex protecting the condition.
+ * @param timeout     [IN] Waiting time. The value range is [0, LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval #LOS_ERRNO_CONDVAR_INVALID        The condition variable is not in use.
+ * @retval #LOS_ERRNO_CONDVAR_MUX_INVALID    The mutex is not locked exactly once by the calling task.
+ * @retval #LOS_ERRNO_CONDVAR_PEND_INTERR    Called during an interrupt.
+ * @retval #LOS_ERRNO_CONDVAR_PEND_IN_LOCK   Called while task scheduling is disabled.
+ * @retval #LOS_ERRNO_CONDVAR_TIMEOUT        No signal arrived within timeout ticks.
+ * @retval #LOS_ERRNO_MUX_INVALID            The mutex was deleted during the wait and is not locked again. Other
+ *                                           error codes of LOS_MuxPend are returned the same way.
+ * @retval #LOS_OK                           The task was signalled.
+ * @par Dependency:
+ * <ul><li>los_condvar.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_CondSignal | LOS_CondBroadcast
+ */
+extern UINT32 LOS_CondWait(UINT32 condID, UINT32 muxHandle, UINT32 timeout);
+
+/**
+ * @ingroup los_condvar
+ * @brief Wake one task waiting on a condition variable.
+ *
+ * @par Description:
+ * This API wakes the task that has waited longest on the condition variable. It does nothing if no task waits.
+ *
+ * @param condID      [IN] Handle of the condition variable.
+ *
+ * @retval #LOS_ERRNO_CONDVAR_INVALID        The condition variable is not in use.
+ * @retval #LOS_OK                           The signal is sent.
+ * @par Dependency:
+ * <ul><li>los_condvar.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_CondWait | LOS_CondBroadcast
+ */
+extern UINT32 LOS_CondSignal(UINT32 condID);
+
+/**
+ * @ingroup los_condvar
+ * @brief Wake all tasks waiting on a condition variable.
+ *
+ * @par Description:
+ * This API wakes every task waiting on the condition variable.
+ *
+ * @param condID      [IN] Handle of the condition variable.
+ *
+ * @retval #LOS_ERRNO_CONDVAR_INVALID        The condition variable is not in use.
+ * @retval #LOS_OK                           The broadcast is sent.
+ * @par Dependency:
+ * <ul><li>los_condvar.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_CondWait | LOS_CondSignal
+ */
+extern UINT32 LOS_CondBroadcast(UINT32 condID);
+
+/**
+ * @ingroup los_condvar
+ * Condition variable object.
+ */
+typedef struct {
+    UINT8 condStat;            /**< State OS_CONDVAR_UNUSED, OS_CONDVAR_USED */
+    UINT32 condID;             /**< Handle ID */
+    LOS_DL_LIST condList;      /**< Waiting tasks, the free list node while unused */
+} LosCondCB;
+
+/**
+ * @ingroup los_condvar
+ * Condition variable state: not in use.
+ */
+#define OS_CONDVAR_UNUSED 0
+
+/**
+ * @ingroup los_condvar
+ * Condition variable state: in use.
+ */
+#define OS_CONDVAR_USED   1
+
+extern LosCondCB *g_allCondVar;
+
+/**
+ * @ingroup los_condvar
+ * Obtain the pointer to the condition variable object that has a specified handle.
+ */
+#define GET_CONDVAR(condID) (((LosCondCB *)g_allCondVar) + (condID))
+
+/**
+ * @ingroup los_condvar
+ * Obtain the condition variable object from its list node.
+ */
+#define GET_CONDVAR_LIST(ptr) LOS_DL_LIST_ENTRY(ptr, LosCondCB, condList)
+
+/**
+ * @ingroup los_condvar
+ * @brief Initializes the condition variables.
+ *
+ * @par Description:
+ * This API is used to allocate the condition variable control blocks during kernel initialization.
+ *
+ * @retval UINT32     Initialization result.
+ * @par Dependency:
+ * <ul><li>los_condvar.h: the header file that contains the API declaration.</li></ul>
+ */
+extern UINT32 OsCondVarInit(VOID);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* __cplusplus */
+
+#endif /* _LOS_CONDVAR_H */
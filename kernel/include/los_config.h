@@ -289,6 +289,25 @@ extern "C" {
 #define LOSCFG_STACK_POINT_ALIGN_SIZE                       8
 #endif
 
+/* =============================================================================
+                                       Event module configuration
+============================================================================= */
+/**
+ * @ingroup los_config
+ * Number of wait lists an event control block spreads its waiters over. A task waiting for events that all map to
+ * one list (event bit modulo the number of lists) waits there, and LOS_EventWrite only visits the lists of the bits
+ * written plus the list of the remaining waiters. Each list costs a LOS_DL_LIST in every EVENT_CB_S, including the
+ * one embedded in each task control block. 0 keeps a single wait list; otherwise a power of two up to 32.
+ */
+#ifndef LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS
+#define LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS                  0
+#endif
+
+#if ((LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 32) || \
+     ((LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS & (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS - 1)) != 0))
+    #error "LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS must be 0 or a power of two no greater than 32"
+#endif
+
 /* =============================================================================
                                        Semaphore module configuration
 ============================================================================= */
@@ -335,6 +354,75 @@ extern "C" {
 #define LOSCFG_BASE_IPC_MUX_LIMIT                           6
 #endif
 
+/* =============================================================================
+                                       Reader-writer lock module configuration
+============================================================================= */
+/**
+ * @ingroup los_config
+ * Configuration item for reader-writer lock module tailoring
+ */
+#ifndef LOSCFG_BASE_IPC_RWLOCK
+#define LOSCFG_BASE_IPC_RWLOCK                              0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of reader-writer locks
+ */
+#ifndef LOSCFG_BASE_IPC_RWLOCK_LIMIT
+#define LOSCFG_BASE_IPC_RWLOCK_LIMIT                        6
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum number of reader-writer locks a task can hold for reading at the same time
+ */
+#ifndef LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT
+#define LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT                   4
+#endif
+
+/* =============================================================================
+                                       Condition variable module configuration
+============================================================================= */
+/**
+ * @ingroup los_config
+ * Configuration item for condition variable module tailoring
+ */
+#ifndef LOSCFG_BASE_IPC_CONDVAR
+#define LOSCFG_BASE_IPC_CONDVAR                             0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of condition variables
+ */
+#ifndef LOSCFG_BASE_IPC_CONDVAR_LIMIT
+#define LOSCFG_BASE_IPC_CONDVAR_LIMIT                       6
+#endif
+
+#if (LOSCFG_BASE_IPC_CONDVAR == 1) && (LOSCFG_BASE_IPC_MUX == 0)
+    #error "if LOSCFG_BASE_IPC_CONDVAR is set to 1, then LOSCFG_BASE_IPC_MUX must also be set to 1"
+#endif
+
+/* =============================================================================
+                                       Barrier module configuration
+============================================================================= */
+/**
+ * @ingroup los_config
+ * Configuration item for barrier module tailoring
+ */
+#ifndef LOSCFG_BASE_IPC_BARRIER
+#define LOSCFG_BASE_IPC_BARRIER                             0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of barriers
+ */
+#ifndef LOSCFG_BASE_IPC_BARRIER_LIMIT
+#define LOSCFG_BASE_IPC_BARRIER_LIMIT                       6
+#endif
+
 /* =============================================================================
                                        Queue module configuration
 ============================================================================= */
@@ -354,6 +442,36 @@ extern "C" {
 #define LOSCFG_BASE_IPC_QUEUE_LIMIT                         6
 #endif
 
+/* =============================================================================
+                                       Stream buffer module configuration
+============================================================================= */
+/**
+ * @ingroup los_config
+ * Configuration item for stream buffer module tailoring
+ */
+#ifndef LOSCFG_BASE_IPC_STREAMBUF
+#define LOSCFG_BASE_IPC_STREAMBUF                           0
+#endif
+
+/* =============================================================================
+                                       Queue set module configuration
+============================================================================= */
+/**
+ * @ingroup los_config
+ * Configuration item for queue set module tailoring
+ */
+#ifndef LOSCFG_BASE_IPC_QUEUESET
+#define LOSCFG_BASE_IPC_QUEUESET                            0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum number of members of a queue set
+ */
+#ifndef LOSCFG_BASE_IPC_QUEUESET_MEMBER_LIMIT
+#define LOSCFG_BASE_IPC_QUEUESET_MEMBER_LIMIT               8
+#endif
+
 
 /* =============================================================================
                                        Software timer module configuration
@@ -478,6 +596,22 @@ extern UINT8 *m_aucSysMem0;
 #define LOSCFG_BASE_MEM_NODE_INTEGRITY_CHECK                0
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration of the incremental integrity check of the system memory pool run by the idle task
+ */
+#ifndef LOSCFG_MEM_BACKGROUND_CHECK
+#define LOSCFG_MEM_BACKGROUND_CHECK                         0
+#endif
+
+/**
+ * @ingroup los_config
+ * Number of mem nodes the idle task checks each time it runs
+ */
+#ifndef LOSCFG_MEM_BACKGROUND_CHECK_NODE_NUM
+#define LOSCFG_MEM_BACKGROUND_CHECK_NODE_NUM                16
+#endif
+
 /**
  * @ingroup los_config
  * Configuration memory leak detection
@@ -522,6 +656,28 @@ extern UINT8 *m_aucSysMem0;
 #define LOSCFG_MEM_LEAKCHECK_RECORD_MAX_NUM                 1024
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration of the allocation profiler, which aggregates the memory in use by call site
+ * @attention
+ * The call sites are the call stacks recorded by LOSCFG_MEM_LEAKCHECK, which must be enabled too.
+ */
+#ifndef LOSCFG_MEM_PROFILE
+#define LOSCFG_MEM_PROFILE                                  0
+#endif
+
+#if (LOSCFG_MEM_PROFILE == 1) && (LOSCFG_MEM_LEAKCHECK == 0)
+    #error "if LOSCFG_MEM_PROFILE is set to 1, then LOSCFG_MEM_LEAKCHECK must be set to 1."
+#endif
+
+/**
+ * @ingroup los_config
+ * Number of call sites the allocation profiler can track
+ */
+#ifndef LOSCFG_MEM_PROFILE_SITE_NUM
+#define LOSCFG_MEM_PROFILE_SITE_NUM                         64
+#endif
+
 /**
  * @ingroup los_config
  * Configuration of memory pool record memory consumption waterline
@@ -530,6 +686,71 @@ extern UINT8 *m_aucSysMem0;
 #define LOSCFG_MEM_WATERLINE                                1
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration of the slab size classes serving small requests from the system memory pool.
+ * Slab objects are not freed by LOS_MemFreeByTaskID and are not listed by the leak check.
+ */
+#ifndef LOSCFG_MEM_SLAB
+#define LOSCFG_MEM_SLAB                                     0
+#endif
+
+/**
+ * @ingroup los_config
+ * Size of the arena the slab size classes take from the system memory pool
+ */
+#ifndef LOSCFG_MEM_SLAB_ARENA_SIZE
+#define LOSCFG_MEM_SLAB_ARENA_SIZE                          0x2000
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration of the per-task caches of small blocks in front of the system memory pool
+ */
+#ifndef LOSCFG_MEM_TCACHE
+#define LOSCFG_MEM_TCACHE                                   0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum number of blocks each per-task cache keeps in one size class
+ */
+#ifndef LOSCFG_MEM_TCACHE_DEPTH
+#define LOSCFG_MEM_TCACHE_DEPTH                             4
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration of membox pools whose free list is updated with compare-and-swap instead of an interrupt lock
+ */
+#ifndef LOSCFG_MEMBOX_LOCK_FREE
+#define LOSCFG_MEMBOX_LOCK_FREE                             0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration of multi size class membox pools, which serve each request from the smallest fitting block size
+ */
+#ifndef LOSCFG_MEMBOX_MULTI
+#define LOSCFG_MEMBOX_MULTI                                 0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum number of size classes of a multi size class membox pool
+ */
+#ifndef LOSCFG_MEMBOX_MULTI_CLASS_NUM
+#define LOSCFG_MEMBOX_MULTI_CLASS_NUM                       8
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration of arenas, which allocate by advancing a pointer and free all their memory at once
+ */
+#ifndef LOSCFG_MEM_ARENA
+#define LOSCFG_MEM_ARENA                                    0
+#endif
+
 /**
  * @ingroup los_config
  * Number of memory checking blocks
@@ -562,6 +783,38 @@ extern UINT8 *m_aucSysMem0;
 #define LOSCFG_MEM_MUL_REGIONS                              0
 #endif
 
+/**
+ * @ingroup los_config
+ * Maximum number of memory regions with placement attributes in one memory pool
+ */
+#ifndef LOSCFG_MEM_REGION_TIER_NUM
+#define LOSCFG_MEM_REGION_TIER_NUM                          4
+#endif
+
+/**
+ * @ingroup los_config
+ * Placement hint of task stacks, LOS_MEM_HINT_* bits as for LOS_MemAllocHint, 0 for none
+ */
+#ifndef LOSCFG_TASK_STACK_MEM_HINT
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+#define LOSCFG_TASK_STACK_MEM_HINT                          LOS_MEM_HINT_FAST
+#else
+#define LOSCFG_TASK_STACK_MEM_HINT                          0
+#endif
+#endif
+
+/**
+ * @ingroup los_config
+ * Placement hint of queue buffers, LOS_MEM_HINT_* bits as for LOS_MemAllocHint, 0 for none
+ */
+#ifndef LOSCFG_QUEUE_MEM_HINT
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+#define LOSCFG_QUEUE_MEM_HINT                               LOS_MEM_HINT_FAST
+#else
+#define LOSCFG_QUEUE_MEM_HINT                               0
+#endif
+#endif
+
 /* =============================================================================
                                         Exception module configuration
 ============================================================================= */
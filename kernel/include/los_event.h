@@ -38,6 +38,7 @@
 #define _LOS_EVENT_H
 
 #include "los_list.h"
+#include "los_config.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -163,6 +164,12 @@ typedef struct tagEvent {
     UINT32 uwEventID;        /**< Event mask in the event control block,
                                   indicating the event that has been logically processed. */
     LOS_DL_LIST stEventList; /**< Event control block linked list */
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    LOS_DL_LIST waitBucket[LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS]; /**< Tasks whose wait mask maps to one bucket */
+#endif
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    VOID *queueSet;          /**< Queue set the event is a member of */
+#endif
 } EVENT_CB_S, *PEVENT_CB_S;
 /**
  * @ingroup los_event
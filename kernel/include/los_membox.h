@@ -39,6 +39,7 @@
 
 #include "los_config.h"
 #include "los_debug.h"
+#include "los_list.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -70,6 +71,11 @@ typedef struct LOS_MEMBOX_INFO {
     struct LOS_MEMBOX_INFO *nextMemBox; /**< Point to the next membox */
 #endif
     LOS_MEMBOX_NODE stFreeList;  /**< Free list */
+    LOS_DL_LIST stWaitList;      /**< Tasks blocked in LOS_MemboxAllocWait */
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    UINT32 uwLockFree;           /**< Whether the free list is uwFreeHead rather than stFreeList */
+    UINT32 uwFreeHead;           /**< ABA tag in the high 16 bits, index + 1 of the first free block in the low */
+#endif
 } LOS_MEMBOX_INFO;
 
 typedef LOS_MEMBOX_INFO OS_MEMBOX_S;
@@ -78,6 +84,13 @@ typedef LOS_MEMBOX_INFO OS_MEMBOX_S;
 UINT32 OsMemboxExcInfoGet(UINT32 memNumMax, MemInfoCB *memExcInfo);
 #endif
 
+/* Block the running task on the wait list of boxInfo, with interrupts locked by *intSave, until a free hands it
+   a block through OsMemboxPost. Return that block, or NULL on timeout. Interrupts are locked again on return. */
+VOID *OsMemboxPend(LOS_MEMBOX_INFO *boxInfo, UINT32 timeout, UINT32 *intSave);
+/* Hand block to the highest priority task on the wait list of boxInfo, with interrupts locked. Return the ID of
+   the woken task, or OS_INVALID if no task is waiting. */
+UINT32 OsMemboxPost(LOS_MEMBOX_INFO *boxInfo, VOID *block);
+
 /**
  * @ingroup los_membox
  * Memory pool alignment
@@ -120,6 +133,38 @@ UINT32 OsMemboxExcInfoGet(UINT32 memNumMax, MemInfoCB *memExcInfo);
  */
 extern UINT32 LOS_MemboxInit(VOID *pool, UINT32 poolSize, UINT32 blkSize);
 
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+/**
+ * @ingroup los_membox
+ * @brief Make a memory pool lock-free.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to make LOS_MemboxAlloc and LOS_MemboxFree update the free list of the memory pool with
+ * compare-and-swap instead of locking interrupts, so that they add no interrupt latency and are safe to call
+ * from interrupts.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemboxInit, and this API must be called before
+ * the pool is used by more than one task or interrupt.</li>
+ * <li>The pool must have no more than 0xFFFF blocks.</li>
+ * <li>LOS_MemboxInit makes the pool use the interrupt lock again.</li>
+ * </ul>
+ *
+ * @param pool     [IN] Memory pool address.
+ *
+ * @retval #LOS_NOK   The pool is NULL, not initialized, or has too many blocks.
+ * @retval #LOS_OK    The memory pool is lock-free.
+ * @par Dependency:
+ * <ul>
+ * <li>los_membox.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemboxInit
+ */
+extern UINT32 LOS_MemboxLockFreeEnable(VOID *pool);
+#endif
+
 /**
  * @ingroup los_membox
  * @brief Request a memory block.
@@ -145,6 +190,37 @@ extern UINT32 LOS_MemboxInit(VOID *pool, UINT32 poolSize, UINT32 blkSize);
  */
 extern VOID *LOS_MemboxAlloc(VOID *pool);
 
+/**
+ * @ingroup los_membox
+ * @brief Request a memory block, waiting for one to be freed if the memory pool is empty.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to request a memory block. If no block is free, the calling task blocks until
+ * LOS_MemboxFree frees one or the timeout expires. A freed block is handed directly to the highest priority
+ * waiting task, tasks of equal priority are served in the order they started waiting.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemboxInit.</li>
+ * <li>This API does not wait, and behaves as LOS_MemboxAlloc, when called in an interrupt or with task
+ * scheduling locked.</li>
+ * </ul>
+ *
+ * @param pool    [IN] Memory pool address.
+ * @param timeout [IN] Maximum number of ticks to wait. LOS_NO_WAIT does not wait, LOS_WAIT_FOREVER waits
+ *                     without timeout.
+ *
+ * @retval #VOID*      The request is accepted, and return a memory block address.
+ * @retval #NULL       The request fails, or no block was freed before the timeout.
+ * @par Dependency:
+ * <ul>
+ * <li>los_membox.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemboxAlloc | LOS_MemboxFree
+ */
+extern VOID *LOS_MemboxAllocWait(VOID *pool, UINT32 timeout);
+
 /**
  * @ingroup los_membox
  * @brief Free a memory block.
@@ -249,6 +325,180 @@ extern VOID LOS_ShowBox(VOID *pool);
  */
 extern UINT32 LOS_MemboxStatisticsGet(const VOID *boxMem, UINT32 *maxBlk, UINT32 *blkCnt, UINT32 *blkSize);
 
+#if (LOSCFG_MEMBOX_MULTI == 1)
+/**
+ * @ingroup los_membox
+ * Size class configuration of a multi size class memory pool
+ */
+typedef struct {
+    UINT32 blkSize;              /**< Block size of the class */
+    UINT32 blkNum;               /**< Block number of the class */
+} LOS_MEMBOX_CLASS_CFG;
+
+/**
+ * @ingroup los_membox
+ * Size class of a multi size class memory pool
+ */
+typedef struct {
+    LOS_MEMBOX_INFO *pool;       /**< Memory pool of the class, NULL for the blocks served by LOS_MemAlloc */
+    UINTPTR poolEnd;             /**< End address of the memory pool of the class */
+    UINT32 peakCnt;              /**< Highest number of allocated blocks */
+    UINT32 allocCount;           /**< Number of requests served by the class */
+    UINT32 fallbackCount;        /**< Number of requests served by the class while a smaller class was full */
+    UINT32 failCount;            /**< Number of requests that found the class full */
+} LOS_MEMBOX_CLASS;
+
+/**
+ * @ingroup los_membox
+ * Multi size class memory pool information structure, followed by the memory pools of the classes
+ */
+typedef struct {
+    UINT32 classNum;             /**< Number of size classes */
+    UINT32 spill;                /**< Whether requests no class can serve are served by LOS_MemAlloc */
+    UINT32 spillCnt;             /**< Number of allocated blocks served by LOS_MemAlloc */
+    LOS_MEMBOX_CLASS spillClass; /**< Counters of the requests served by LOS_MemAlloc */
+    LOS_MEMBOX_CLASS classes[LOSCFG_MEMBOX_MULTI_CLASS_NUM]; /**< Size classes, in increasing block size */
+} LOS_MEMBOX_MULTI_INFO;
+
+/**
+ * @ingroup los_membox
+ * Statistics of a size class of a multi size class memory pool
+ */
+typedef struct {
+    UINT32 blkSize;              /**< Block size, 0 for the blocks served by LOS_MemAlloc */
+    UINT32 blkNum;               /**< Block number */
+    UINT32 blkCnt;               /**< The number of allocated blocks */
+    UINT32 peakCnt;              /**< Highest number of allocated blocks */
+    UINT32 allocCount;           /**< Number of requests served */
+    UINT32 fallbackCount;        /**< Number of requests served while a smaller class was full */
+    UINT32 failCount;            /**< Number of requests that found the class full */
+} LOS_MEMBOX_CLASS_STAT;
+
+/**
+ * @ingroup los_membox
+ * Multi size class memory pool size, to be added up with LOS_MEMBOX_SIZE(blkSize, blkNum) of every class
+ */
+#define LOS_MEMBOX_MULTI_HEAD_SIZE sizeof(LOS_MEMBOX_MULTI_INFO)
+
+/**
+ * @ingroup los_membox
+ * @brief Initialize a multi size class memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to initialize a memory pool made of one membox pool per size class. A request is served
+ * by the class with the smallest fitting block size, by the next larger classes when that one is full, and
+ * optionally by LOS_MemAlloc on the system memory pool when all of them are full or the request is larger than
+ * every block size. Allocation and free take bounded time, independent of the number of blocks.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The pool parameter must be aligned to the size of a pointer.</li>
+ * <li>The poolSize parameter must be at least LOS_MEMBOX_MULTI_HEAD_SIZE plus LOS_MEMBOX_SIZE(blkSize, blkNum)
+ * of every class.</li>
+ * <li>The classes must be given in strictly increasing block size, and there must be 1 to
+ * LOSCFG_MEMBOX_MULTI_CLASS_NUM of them.</li>
+ * </ul>
+ *
+ * @param pool     [IN] Memory pool address.
+ * @param poolSize [IN] Memory pool size.
+ * @param cfg      [IN] Block size and number of every class.
+ * @param classNum [IN] Number of classes.
+ * @param spill    [IN] Whether requests no class can serve are served by LOS_MemAlloc.
+ *
+ * @retval #LOS_NOK   The memory pool fails to be initialized.
+ * @retval #LOS_OK    The memory pool is successfully initialized.
+ * @par Dependency:
+ * <ul>
+ * <li>los_membox.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemboxMultiAlloc | LOS_MemboxMultiFree
+ */
+extern UINT32 LOS_MemboxMultiInit(VOID *pool, UINT32 poolSize, const LOS_MEMBOX_CLASS_CFG *cfg,
+                                  UINT32 classNum, BOOL spill);
+
+/**
+ * @ingroup los_membox
+ * @brief Request a memory block from a multi size class memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to request a memory block of at least size bytes.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemboxMultiInit.</li>
+ * </ul>
+ *
+ * @param pool    [IN] Memory pool address.
+ * @param size    [IN] Size of the memory block.
+ *
+ * @retval #VOID*      The request is accepted, and return a memory block address.
+ * @retval #NULL       The request fails.
+ * @par Dependency:
+ * <ul>
+ * <li>los_membox.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemboxMultiFree
+ */
+extern VOID *LOS_MemboxMultiAlloc(VOID *pool, UINT32 size);
+
+/**
+ * @ingroup los_membox
+ * @brief Free a memory block of a multi size class memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to free a memory block to the class that served it.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemboxMultiInit.</li>
+ * <li>The input box parameter must be allocated by LOS_MemboxMultiAlloc.</li>
+ * </ul>
+ *
+ * @param pool     [IN] Memory pool address.
+ * @param box      [IN] Memory block address.
+ *
+ * @retval #LOS_NOK   This memory block fails to be freed.
+ * @retval #LOS_OK    This memory block is successfully freed.
+ * @par Dependency:
+ * <ul>
+ * <li>los_membox.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemboxMultiAlloc
+ */
+extern UINT32 LOS_MemboxMultiFree(VOID *pool, VOID *box);
+
+/**
+ * @ingroup los_membox
+ * @brief Get the statistics of a size class of a multi size class memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to get the block size, usage and request counters of a size class. The class index
+ * equal to the number of classes reports the blocks served by LOS_MemAlloc.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemboxMultiInit.</li>
+ * </ul>
+ *
+ * @param pool       [IN]  Memory pool address.
+ * @param classIndex [IN]  Index of the class, from 0 for the smallest block size to the number of classes.
+ * @param stat       [OUT] Statistics of the class.
+ *
+ * @retval #LOS_NOK   The statistics fail to be got.
+ * @retval #LOS_OK    The statistics are successfully got.
+ * @par Dependency:
+ * <ul>
+ * <li>los_membox.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemboxMultiInit
+ */
+extern UINT32 LOS_MemboxMultiStatisticsGet(const VOID *pool, UINT32 classIndex, LOS_MEMBOX_CLASS_STAT *stat);
+#endif
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -79,6 +79,50 @@ UINT32 OsMemExcInfoGet(UINT32 memNumMax, MemInfoCB *memExcInfo);
 extern VOID LOS_MemUsedNodeShow(VOID *pool);
 #endif
 
+#if (LOSCFG_MEM_PROFILE == 1)
+/**
+ * @ingroup los_memory
+ * Memory in use and allocation counts of one call site
+ */
+typedef struct {
+    UINTPTR linkReg[LOSCFG_MEM_RECORD_LR_CNT];  /* Call stack that identifies the site */
+    UINT32 liveSize;                            /* Bytes allocated by the site and not freed yet */
+    UINT32 liveCount;                           /* Blocks allocated by the site and not freed yet */
+    UINT32 allocCount;                          /* Blocks allocated by the site since boot */
+    UINT32 peakSize;                            /* Largest liveSize seen */
+} LOS_MEM_PROFILE_SITE;
+
+/**
+ * @ingroup los_memory
+ * @brief Get the call sites that hold the most memory.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to get the call sites that allocated memory, in descending order of the bytes they
+ * still hold. A site is the call stack LOSCFG_MEM_LEAKCHECK records for a block, and the figures cover all
+ * memory pools.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>Sizes include the node head of every block.</li>
+ * <li>At most LOSCFG_MEM_PROFILE_SITE_NUM sites are tracked. Allocations from sites that find no room in the
+ * table are added up in one more site whose call stack is all zero.</li>
+ * </ul>
+ *
+ * @param  sites              [OUT] Array that receives the sites.
+ * @param  num                [IN/OUT] Capacity of sites on input, number of sites stored on output.
+ *
+ * @retval #LOS_NOK           The incoming parameter sites or num is NULL.
+ * @retval #LOS_OK            Success to get the sites.
+ * @par Dependency:
+ * <ul>
+ * <li>los_memory.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemUsedNodeShow
+ */
+extern UINT32 LOS_MemProfileGet(LOS_MEM_PROFILE_SITE *sites, UINT32 *num);
+#endif
+
 #if (LOSCFG_MEM_MUL_POOL == 1)
 /**
  * @ingroup los_memory
@@ -120,10 +164,19 @@ extern UINT32 LOS_MemDeInit(VOID *pool);
 extern UINT32 LOS_MemPoolList(VOID);
 #endif
 
+/**
+ * @ingroup los_memory
+ * Placement hints of LOS_MemAllocHint, which are also the attributes of the regions added by LOS_MemRegionsAdd.
+ */
+#define LOS_MEM_HINT_FAST       0x1U        /* Fast memory, such as on-chip SRAM */
+#define LOS_MEM_HINT_DMA        0x2U        /* Memory that DMA controllers can reach */
+#define LOS_MEM_HINT_STRICT     0x80000000U /* Fail rather than fall back to memory without the hinted attributes */
+
 #if (LOSCFG_MEM_MUL_REGIONS == 1)
 typedef struct {
     VOID *startAddress;
     UINT32 length;
+    UINT32 attr;    /* LOS_MEM_HINT_FAST and LOS_MEM_HINT_DMA bits the region provides, 0 if none */
 } LosMemRegion;
 
 /**
@@ -142,6 +195,9 @@ typedef struct {
  * <li>If the starting address of a memory pool is specified, the start address of the non-continuous memory regions should be
  *  greater than the end address of the memory pool.</li>
  * <li>The multiple non-continuous memory regions shouldn't conflict with each other.</li>
+ * <li>A pool records at most LOSCFG_MEM_REGION_TIER_NUM regions whose attr is not 0, for LOS_MemAllocHint. The
+ *  memory a pool was initialized with by LOS_MemInit has no attributes, so a pool whose first region is fast memory
+ *  should be created by this API with a NULL pool.</li>
  * </ul>
  *
  * @param pool           [IN] The memory pool address. If NULL is specified, the start address of first memory region will be 
@@ -161,6 +217,44 @@ typedef struct {
 extern UINT32 LOS_MemRegionsAdd(VOID *pool, const LosMemRegion * const memRegions, UINT32 memRegionCount);
 #endif
 
+#if (LOSCFG_MEM_SLAB == 1)
+/**
+ * @ingroup los_memory
+ * Number of slab size classes in front of the system memory pool: 16, 32, 64 and 128 bytes.
+ * Slab objects have no node header, so they record neither their owner task nor a call stack: LOS_MemFreeByTaskID
+ * does not free them, and LOS_MemUsedNodeShow reports the whole slab arena as a single used node.
+ */
+#define LOS_MEM_SLAB_CLASS_NUM  4
+
+/**
+ * @ingroup los_memory
+ * Usage of one slab size class
+ */
+typedef struct {
+    UINT32 objSize;     /* Size of the objects of the class */
+    UINT32 pageNum;     /* Slab pages owned by the class */
+    UINT32 usedObjNum;  /* Objects handed out */
+    UINT32 freeObjNum;  /* Objects left in the pages of the class */
+} LOS_MEM_SLAB_STATUS;
+#endif
+
+#if (LOSCFG_MEM_TCACHE == 1)
+/**
+ * @ingroup los_memory
+ * Number of per-task cache classes: blocks of up to 16, 32, ... and 128 bytes.
+ */
+#define LOS_MEM_TCACHE_CLASS_NUM  8
+
+/**
+ * @ingroup los_memory
+ * Per-task cache of small blocks freed to the system memory pool
+ */
+typedef struct {
+    VOID *head[LOS_MEM_TCACHE_CLASS_NUM];   /* Free list of each class */
+    UINT8 count[LOS_MEM_TCACHE_CLASS_NUM];  /* Blocks held in each class */
+} LosMemTcache;
+#endif
+
 /**
  * @ingroup los_memory
  * Memory pool extern information structure
@@ -174,8 +268,51 @@ typedef struct {
 #if (LOSCFG_MEM_WATERLINE == 1)
     UINT32 usageWaterLine;
 #endif
+#if (LOSCFG_MEM_SLAB == 1)
+    UINT32 slabFreePageNum;  /* Slab pages not owned by any class */
+    LOS_MEM_SLAB_STATUS slabStatus[LOS_MEM_SLAB_CLASS_NUM];
+#endif
 } LOS_MEM_POOL_STATUS;
 
+/**
+ * @ingroup los_memory
+ * Number of free node size classes in the fragmentation histogram: class i holds sizes [2^i, 2^(i+1)).
+ */
+#define LOS_MEM_FRAG_CLASS_NUM  32
+
+/**
+ * @ingroup los_memory
+ * Number of largest free nodes reported with the allocations around them.
+ */
+#define LOS_MEM_FRAG_GAP_NUM    4
+
+/**
+ * @ingroup los_memory
+ * A free node and the allocations on both sides of it
+ */
+typedef struct {
+    UINT32 size;        /* Size of the free node, 0 if the entry is not used */
+    VOID *prevUsed;     /* Allocation right before the free node, NULL if there is none */
+    VOID *nextUsed;     /* Allocation right after the free node, NULL if there is none */
+#if (LOSCFG_MEM_LEAKCHECK == 1)
+    UINTPTR prevLR[LOSCFG_MEM_RECORD_LR_CNT];  /* Call stack recorded for prevUsed */
+    UINTPTR nextLR[LOSCFG_MEM_RECORD_LR_CNT];  /* Call stack recorded for nextUsed */
+#endif
+} LOS_MEM_FRAG_GAP;
+
+/**
+ * @ingroup los_memory
+ * Memory pool fragmentation information structure
+ */
+typedef struct {
+    UINT32 totalFreeSize;
+    UINT32 maxFreeNodeSize;
+    UINT32 freeNodeNum;
+    UINT32 maxFreeRatio;    /* maxFreeNodeSize in percent of totalFreeSize, 100 if the free memory is one node */
+    UINT32 freeNodeHist[LOS_MEM_FRAG_CLASS_NUM];
+    LOS_MEM_FRAG_GAP gap[LOS_MEM_FRAG_GAP_NUM];  /* Largest free nodes, in descending order of size */
+} LOS_MEM_FRAG_INFO;
+
 /**
  * @ingroup los_memory
  * @brief Initialize dynamic memory.
@@ -235,6 +372,37 @@ extern UINT32 LOS_MemInit(VOID *pool, UINT32 size);
  */
 extern VOID *LOS_MemAlloc(VOID *pool, UINT32 size);
 
+/**
+ * @ingroup los_memory
+ * @brief Allocate dynamic memory, preferably from the regions with some attributes.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to allocate a memory block from the regions of the pool that provide all the attributes in
+ * hint, such as LOS_MEM_HINT_FAST | LOS_MEM_HINT_DMA. If none of them has a suitable free block, the block comes from
+ * anywhere in the pool as with LOS_MemAlloc, unless hint has LOS_MEM_HINT_STRICT.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit or LOS_MemRegionsAdd.</li>
+ * <li>Regions get attributes from LOS_MemRegionsAdd. Without LOSCFG_MEM_MUL_REGIONS the hint is ignored.</li>
+ * <li>Finding a block in the hinted regions walks the free lists, so it takes longer than LOS_MemAlloc. The walk is
+ * skipped when those regions do not hold size bytes of free memory in total.</li>
+ * </ul>
+ *
+ * @param  pool    [IN] Pointer to the memory pool that contains the memory block to be allocated.
+ * @param  size    [IN] Size of the memory block to be allocated (unit: byte).
+ * @param  hint    [IN] Attributes of the memory to allocate from, LOS_MEM_HINT_STRICT to require them.
+ *
+ * @retval #NULL          The memory fails to be allocated.
+ * @retval #VOID*         The memory is successfully allocated with the starting address of the allocated memory block
+ *                        returned.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemAlloc | LOS_MemAllocAlignHint | LOS_MemRegionsAdd
+ */
+extern VOID *LOS_MemAllocHint(VOID *pool, UINT32 size, UINT32 hint);
+
 /**
  * @ingroup los_memory
  * @brief Free dynamic memory.
@@ -293,6 +461,94 @@ extern UINT32 LOS_MemFree(VOID *pool, VOID *ptr);
  */
 extern VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size);
 
+/**
+ * @ingroup los_memory
+ * @brief Resize a memory block without moving it.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to shrink a memory block, or to grow it into the free memory right after it. The block keeps
+ * its address and contents. If that is not possible, the block is left as it is.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit.</li>
+ * <li>The input ptr parameter must be allocated by LOS_MemAlloc or LOS_MemRealloc. Blocks allocated by
+ * LOS_MemAllocAlign with a gap before them are never resized in place.</li>
+ * </ul>
+ *
+ * @param  pool     [IN] Pointer to the memory pool that contains the memory block.
+ * @param  ptr      [IN] Address of the memory block.
+ * @param  size     [IN] New size of the memory block.
+ *
+ * @retval #LOS_NOK          The memory block cannot be resized without moving it, or the input is invalid.
+ * @retval #LOS_OK           The memory block is successfully resized.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRealloc
+ */
+extern UINT32 LOS_MemReallocInPlace(VOID *pool, VOID *ptr, UINT32 size);
+
+#if (LOSCFG_MEM_TCACHE == 1)
+/**
+ * @ingroup los_memory
+ * @brief Allocate a memory block from the system memory pool through the cache of the running task.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to allocate a memory block of up to 128 bytes from the small blocks the running task freed
+ * with LOS_MemTcacheFree, without locking the memory pool. Other requests, and requests the cache cannot serve,
+ * are passed to LOS_MemAlloc on the system memory pool.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>Requests made in interrupt context always go to the memory pool.</li>
+ * <li>The returned block can be freed with LOS_MemTcacheFree or with LOS_MemFree on the system memory pool.</li>
+ * </ul>
+ *
+ * @param  size  [IN] Size of the memory block to be allocated (unit: byte).
+ *
+ * @retval #NULL          The memory fails to be allocated.
+ * @retval #VOID*         The memory is successfully allocated with the starting address of the memory block returned.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemTcacheFree | LOS_MemAlloc
+ */
+extern VOID *LOS_MemTcacheAlloc(UINT32 size);
+
+/**
+ * @ingroup los_memory
+ * @brief Free a memory block of the system memory pool into the cache of the running task.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to keep a small block in the cache of the running task for its next LOS_MemTcacheAlloc.
+ * Each size class keeps at most LOSCFG_MEM_TCACHE_DEPTH blocks; other blocks are passed to LOS_MemFree.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>Cached blocks still count as used in the memory pool. They are given back when the task is deleted, or
+ * when LOS_MemFreeByTaskID is called on the system memory pool for the task by the task itself or while the task
+ * is pended or delayed.</li>
+ * </ul>
+ *
+ * @param  ptr   [IN] Starting address of a memory block allocated from the system memory pool.
+ *
+ * @retval #LOS_NOK          The memory block is already cached, or LOS_MemFree fails to free it.
+ * @retval #LOS_OK           The memory block is successfully freed.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemTcacheAlloc | LOS_MemFree
+ */
+extern UINT32 LOS_MemTcacheFree(VOID *ptr);
+
+extern VOID OsMemTcacheTake(UINT32 taskID, LosMemTcache *cache);
+
+extern VOID OsMemTcacheRelease(LosMemTcache *cache);
+
+extern VOID OsMemTcacheFlush(UINT32 taskID);
+#endif
+
 /**
  * @ingroup los_memory
  * @brief Allocate aligned memory.
@@ -322,6 +578,28 @@ extern VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size);
  */
 extern VOID *LOS_MemAllocAlign(VOID *pool, UINT32 size, UINT32 boundary);
 
+/**
+ * @ingroup los_memory
+ * @brief Allocate aligned memory, preferably from the regions with some attributes.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used as LOS_MemAllocAlign, placing the memory block as LOS_MemAllocHint does.</li>
+ * </ul>
+ *
+ * @param  pool      [IN] Pointer to the memory pool that contains the memory blocks to be allocated.
+ * @param  size      [IN] Size of the memory to be allocated.
+ * @param  boundary  [IN] Boundary on which the memory is aligned.
+ * @param  hint      [IN] Attributes of the memory to allocate from, LOS_MEM_HINT_STRICT to require them.
+ *
+ * @retval #NULL    The memory fails to be allocated.
+ * @retval #VOID*   The memory is successfully allocated with the starting address of the allocated memory returned.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemAllocAlign | LOS_MemAllocHint
+ */
+extern VOID *LOS_MemAllocAlignHint(VOID *pool, UINT32 size, UINT32 boundary, UINT32 hint);
+
 /**
  * @ingroup los_memory
  * @brief Get the size of memory pool's size.
@@ -392,6 +670,59 @@ extern UINT32 LOS_MemTotalUsedGet(VOID *pool);
  */
 extern UINT32 LOS_MemInfoGet(VOID *pool, LOS_MEM_POOL_STATUS *poolStatus);
 
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+/**
+ * @ingroup los_memory
+ * @brief Get the usage of the memory regions with some attributes.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to get the usage of the regions of a memory pool whose attributes, given to
+ *  LOS_MemRegionsAdd, are exactly attr. An attr of 0 covers all the memory without attributes.</li>
+ * </ul>
+ *
+ * @param pool       [IN]  The memory pool address.
+ * @param attr       [IN]  The attributes of the regions, LOS_MEM_HINT_FAST and LOS_MEM_HINT_DMA bits.
+ * @param poolStatus [OUT] The usage of the regions. usageWaterLine is not filled in.
+ *
+ * @retval #LOS_NOK    The usage fails to be got.
+ * @retval #LOS_OK     The usage is successfully got.
+ * @par Dependency:
+ * <ul>
+ * <li>los_memory.h: the header file that contains the API declaration.</li>
+ * </ul>
+ * @see LOS_MemRegionsAdd | LOS_MemInfoGet
+ */
+extern UINT32 LOS_MemTierInfoGet(VOID *pool, UINT32 attr, LOS_MEM_POOL_STATUS *poolStatus);
+#endif
+
+/**
+ * @ingroup los_memory
+ * @brief Get the fragmentation infomation of memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to get how the free memory of a pool is split: the ratio of the largest free node to all
+ * free memory, a histogram of free node sizes, and the largest free nodes with the allocations that separate them.
+ * With LOSCFG_MEM_LEAKCHECK, the call stacks that made those allocations are reported too.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit.</li>
+ * <li>The pool is walked node by node with the pool locked.</li>
+ * </ul>
+ *
+ * @param  pool                 [IN] A pointer pointed to the memory pool.
+ * @param  fragInfo             [OUT] A pointer for storage the fragmentation infomation.
+ *
+ * @retval #LOS_NOK           The incoming parameter pool is NULL or invalid.
+ * @retval #LOS_OK            Success to get the fragmentation infomation.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemInfoGet
+ */
+extern UINT32 LOS_MemFragInfoGet(VOID *pool, LOS_MEM_FRAG_INFO *fragInfo);
+
 /**
  * @ingroup los_memory
  * @brief Get the number of free node in every size.
@@ -441,6 +772,38 @@ extern UINT32 LOS_MemFreeNodeShow(VOID *pool);
  */
 extern UINT32 LOS_MemIntegrityCheck(const VOID *pool);
 
+#if (LOSCFG_MEM_BACKGROUND_CHECK == 1)
+/**
+ * @ingroup los_memory
+ * @brief Check the next part of the memory pool integrity.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to check at most nodeNum nodes of the memory pool, starting after the last node the
+ * previous call checked and wrapping around at the end of the pool, so that the pool is locked for a bounded
+ * time.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit.</li>
+ * <li>Only one position is kept: a call for another pool starts that pool from its first node.</li>
+ * <li>The idle task calls this API for the system memory pool with LOSCFG_MEM_BACKGROUND_CHECK_NODE_NUM.</li>
+ * <li>The first broken node is reported with the node before it, and their call stacks with
+ * LOSCFG_MEM_LEAKCHECK, the same way as LOS_MemIntegrityCheck.</li>
+ * </ul>
+ *
+ * @param  pool              [IN] A pointer pointed to the memory pool.
+ * @param  nodeNum           [IN] Maximum number of nodes to check.
+ *
+ * @retval #LOS_NOK           The memory pool (pool) is impaired, or the parameters are invalid.
+ * @retval #LOS_OK            The nodes checked are integrated.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemIntegrityCheck
+ */
+extern UINT32 LOS_MemIntegrityCheckStep(const VOID *pool, UINT32 nodeNum);
+#endif
+
 /**
  * @ingroup los_memory
  * @brief Enable memory pool to support no internal lock during using interfaces.
@@ -38,6 +38,7 @@
 #define _LOS_MUX_H
 
 #include "los_task.h"
+#include "los_atomic.h"
 
 
 #ifdef __cplusplus
@@ -172,6 +173,43 @@ extern "C" {
  */
 #define LOS_ERRNO_MUX_MAXNUM_ZERO   LOS_ERRNO_OS_ERROR(LOS_MOD_MUX, 0x0C)
 
+/**
+ * @ingroup los_mux
+ * Mutex error code: The priority of the task is higher than the ceiling of a priority-ceiling mutex.
+ *
+ * Value: 0x02001d0D
+ *
+ * Solution: Create the mutex with a ceiling no lower than the priority of every task that locks it.
+ */
+#define LOS_ERRNO_MUX_CEILING       LOS_ERRNO_OS_ERROR(LOS_MOD_MUX, 0x0D)
+
+/**
+ * @ingroup los_mux
+ * Mutex protocol: the priority of the owner is not changed.
+ */
+#define LOS_MUX_PRIO_NONE       0
+
+/**
+ * @ingroup los_mux
+ * Mutex protocol: the owner inherits the priority of a higher-priority waiter. This is the default.
+ */
+#define LOS_MUX_PRIO_INHERIT    1
+
+/**
+ * @ingroup los_mux
+ * Mutex protocol: the owner runs at the ceiling priority of the mutex from the moment it locks it.
+ */
+#define LOS_MUX_PRIO_PROTECT    2
+
+/**
+ * @ingroup los_mux
+ * Mutex attributes.
+ */
+typedef struct {
+    UINT8 protocol;      /**< LOS_MUX_PRIO_NONE, LOS_MUX_PRIO_INHERIT or LOS_MUX_PRIO_PROTECT */
+    UINT16 prioCeiling;  /**< Ceiling priority, used with LOS_MUX_PRIO_PROTECT */
+} LosMuxAttr;
+
 /**
  * @ingroup los_mux
  * @brief Create a mutex.
@@ -196,6 +234,33 @@ extern "C" {
  */
 extern UINT32 LOS_MuxCreate(UINT32 *muxHandle);
 
+/**
+ * @ingroup los_mux
+ * @brief Create a mutex with attributes.
+ *
+ * @par Description:
+ * This API is used to create a mutex with the specified priority protocol. With LOS_MUX_PRIO_PROTECT, the task that
+ * locks the mutex is raised to attr->prioCeiling at once and restored when it unlocks it, so a task that needs the
+ * mutex is never blocked by a lower-priority owner that was preempted.
+ * @attention
+ * <ul>
+ * <li>The total number of mutexes is pre-configured. If there are no available mutexes, the mutex creation fails.</li>
+ * <li>The ceiling must be no lower than the priority of any task that locks the mutex.</li>
+ * </ul>
+ *
+ * @param muxHandle   [OUT] Handle pointer of the successfully created mutex.
+ * @param attr        [IN] Mutex attributes. NULL creates a priority inheritance mutex, like #LOS_MuxCreate.
+ *
+ * @retval #LOS_ERRNO_MUX_PTR_NULL           The muxHandle pointer is NULL.
+ * @retval #LOS_ERRNO_MUX_INVALID            Unknown protocol or ceiling priority out of range.
+ * @retval #LOS_ERRNO_MUX_ALL_BUSY           No available mutex.
+ * @retval #LOS_OK                           The mutex is successfully created.
+ * @par Dependency:
+ * <ul><li>los_mux.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MuxCreate | LOS_MuxDelete
+ */
+extern UINT32 LOS_MuxCreateEx(UINT32 *muxHandle, const LosMuxAttr *attr);
+
 /**
  * @ingroup los_mux
  * @brief Delete a mutex.
@@ -235,6 +300,7 @@ extern UINT32 LOS_MuxDelete(UINT32 muxHandle);
  * <li>Do not wait on a mutex during an interrupt.</li>
  * <li>The priority inheritance protocol is supported. If a higher-priority thread is waiting on a mutex, it changes
  * the priority of the thread that owns the mutex to avoid priority inversion.</li>
+ * <li>A mutex created with LOS_MUX_PRIO_PROTECT raises the thread that locks it to the ceiling priority.</li>
  * <li>A recursive mutex can be locked more than once by the same thread.</li>
  * </ul>
  *
@@ -249,6 +315,7 @@ extern UINT32 LOS_MuxDelete(UINT32 muxHandle);
  * @retval #LOS_ERRNO_MUX_PEND_INTERR        The mutex is being locked during an interrupt.
  * @retval #LOS_ERRNO_MUX_PEND_IN_LOCK       The mutex is waited on when the task scheduling is disabled.
  * @retval #LOS_ERRNO_MUX_TIMEOUT            The mutex waiting times out.
+ * @retval #LOS_ERRNO_MUX_CEILING            The task has a higher priority than the ceiling of the mutex.
  * @retval #LOS_OK                           The mutex is successfully locked.
  * @par Dependency:
  * <ul><li>los_mux.h: the header file that contains the API declaration.</li></ul>
@@ -293,8 +360,86 @@ typedef struct {
     LOS_DL_LIST muxList; /**< Mutex linked list */
     LosTaskCB *owner;    /**< The current thread that is locking a mutex */
     UINT16 priority;     /**< Priority of the thread that is locking a mutex */
+    Atomic lockWord;     /**< Owner word, see OS_MUX_WORD */
+    UINT8 protocol;      /**< Priority protocol, LOS_MUX_PRIO_NONE, LOS_MUX_PRIO_INHERIT or LOS_MUX_PRIO_PROTECT */
+    UINT16 prioCeiling;  /**< Ceiling priority of a LOS_MUX_PRIO_PROTECT mutex */
 } LosMuxCB;
 
+/**
+ * @ingroup los_mux
+ * Owner word of a free mutex.
+ */
+#define OS_MUX_WORD_FREE        0
+
+/**
+ * @ingroup los_mux
+ * Owner word flag: the mutex is recursively locked or contended, and muxCount, owner and priority are valid.
+ * Without it, the mutex was taken once by the fast path and nothing but the owner word is maintained.
+ */
+#define OS_MUX_WORD_SLOW        ((INT32)0x80000000U)
+
+/**
+ * @ingroup los_mux
+ * Owner word of a mutex held by the specified task: its task ID + 1 in the low half and, above it, its priority
+ * when it took the mutex, which is the priority to go back to when it releases a mutex that raised it.
+ */
+#define OS_MUX_WORD(taskCB)     ((INT32)((((UINT32)(taskCB)->priority) << 16) | ((taskCB)->taskID + 1)))
+
+/**
+ * @ingroup los_mux
+ * Task ID of the owner recorded in a non-free owner word.
+ */
+#define OS_MUX_WORD_TID(word)   ((((UINT32)(word)) & 0xFFFFU) - 1)
+
+/**
+ * @ingroup los_mux
+ * Priority of the owner when it took the mutex, recorded in a non-free owner word.
+ */
+#define OS_MUX_WORD_PRIO(word)  ((UINT16)((((UINT32)(word)) & ~((UINT32)OS_MUX_WORD_SLOW)) >> 16))
+
+/**
+ * @ingroup los_mux
+ * @brief Obtain the task that holds a mutex.
+ *
+ * @par Description:
+ * This API reads the owner from the owner word, so it is also valid for a mutex taken by the fast path.
+ *
+ * @param mux     [IN] Mutex object.
+ *
+ * @retval #LosTaskCB*   The owner, or NULL if the mutex is free.
+ * @par Dependency:
+ * <ul><li>los_mux.h: the header file that contains the API declaration.</li></ul>
+ * @see OsMuxCountGet
+ */
+STATIC INLINE LosTaskCB *OsMuxOwnerGet(const LosMuxCB *mux)
+{
+    INT32 word = LOS_AtomicRead(&mux->lockWord);
+    return (word == OS_MUX_WORD_FREE) ? NULL : OS_TCB_FROM_TID(OS_MUX_WORD_TID(word));
+}
+
+/**
+ * @ingroup los_mux
+ * @brief Obtain the number of times a mutex is locked by its owner.
+ *
+ * @par Description:
+ * This API reads the lock count, which is implicitly 1 for a mutex taken by the fast path.
+ *
+ * @param mux     [IN] Mutex object.
+ *
+ * @retval #UINT32   The lock count, 0 if the mutex is free.
+ * @par Dependency:
+ * <ul><li>los_mux.h: the header file that contains the API declaration.</li></ul>
+ * @see OsMuxOwnerGet
+ */
+STATIC INLINE UINT32 OsMuxCountGet(const LosMuxCB *mux)
+{
+    INT32 word = LOS_AtomicRead(&mux->lockWord);
+    if (word == OS_MUX_WORD_FREE) {
+        return 0;
+    }
+    return (word & OS_MUX_WORD_SLOW) ? mux->muxCount : 1;
+}
+
 /**
  * @ingroup los_mux
  * Mutex state: not in use.
@@ -335,6 +480,26 @@ extern LosMuxCB *g_allMux;
  */
 extern UINT32 OsMuxInit(VOID);
 
+/**
+ * @ingroup los_mux
+ * @brief Release a mutex whose lock count has dropped to zero.
+ *
+ * @par Description:
+ * This API hands the mutex to the first waiting task, or marks it free, and restores the priority of the
+ * owner. It must be called with interrupts locked by the task that owns the mutex, after muxCount reached zero
+ * or while the mutex is held once through the fast path.
+ *
+ * @param muxPosted     [IN] Mutex owned by the running task.
+ *
+ * @retval TRUE         A waiting task took over the mutex, or the owner's priority was lowered, and a reschedule
+ *                      is needed.
+ * @retval FALSE        The mutex is free and no reschedule is needed.
+ * @par Dependency:
+ * <ul><li>los_mux.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MuxPost
+ */
+extern BOOL OsMuxRelease(LosMuxCB *muxPosted);
+
 /**
  * @ingroup los_mux
  * Obtain the pointer to the linked list in the mutex pointed to by a specified pointer.
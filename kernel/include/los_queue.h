@@ -331,6 +331,27 @@ extern "C" {
  */
 #define LOS_ERRNO_QUEUE_READ_SIZE_TOO_SMALL LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x1f)
 
+/**
+ * @ingroup los_queue
+ * Queue error code: The message count passed in during batch queue reading or writing is 0.
+ *
+ * Value: 0x02000620
+ *
+ * Solution: Pass in a message count that is greater than 0.
+ */
+#define LOS_ERRNO_QUEUE_BATCH_COUNT_ISZERO  LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x20)
+
+/**
+ * @ingroup los_queue
+ * Queue error code: The operation is not supported by the type of the queue.
+ *
+ * Value: 0x02000621
+ *
+ * Solution: Batch operations are only supported by queues created with LOS_QueueCreate, use the single message
+ * interfaces on message buffer queues.
+ */
+#define LOS_ERRNO_QUEUE_TYPE_UNSUPPORTED    LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x21)
+
 /**
  * @ingroup los_queue
  * In struct QUEUE_INFO_S, the length of each waitReadTask/waitWriteTask/waitMemTask array depends on the value
@@ -393,6 +414,47 @@ extern UINT32 LOS_QueueCreate(CHAR *queueName,
                               UINT32 flags,
                               UINT16 maxMsgSize);
 
+/**
+ * @ingroup los_queue
+ * @brief Create a message buffer queue for variable-length messages.
+ *
+ * @par Description:
+ * This API is used to create a queue whose messages are stored back to back in a byte ring, each one prefixed by
+ * its length, instead of in nodes of a fixed size. A message only occupies its own length plus
+ * #OS_QUEUE_MSGBUF_HEAD_SIZE bytes, so traffic of mixed message sizes needs much less memory than a queue created
+ * by LOS_QueueCreate.
+ * @attention
+ * <ul>
+ * <li>The returned queue ID is used with the same read, write and delete interfaces as other queues, and tasks
+ * block on it with the same semantics.</li>
+ * <li>Writers are served in FIFO order: a writer waits while an earlier writer is still waiting for space.</li>
+ * <li>The writable count reported by LOS_QueueInfoGet is the number of free bytes in the buffer.</li>
+ * <li>Batch read and write interfaces are not supported.</li>
+ * </ul>
+ * @param queueName        [IN]    Message queue name. Reserved parameter, not used for now.
+ * @param bufferSize       [IN]    Size of the message ring in bytes. It must hold at least one message of
+ * maxMsgSize bytes together with its length prefix.
+ * @param queueID          [OUT]   ID of the queue control structure that is successfully created.
+ * @param flags            [IN]    Queue mode. Reserved parameter, not used for now.
+ * @param maxMsgSize       [IN]    Maximum size of a single message. The value range is [1,0xffff-4].
+ *
+ * @retval   #LOS_OK                               The message queue is successfully created.
+ * @retval   #LOS_ERRNO_QUEUE_CB_UNAVAILABLE       The upper limit of the number of created queues is exceeded.
+ * @retval   #LOS_ERRNO_QUEUE_CREATE_NO_MEMORY     Insufficient memory for queue creation.
+ * @retval   #LOS_ERRNO_QUEUE_CREAT_PTR_NULL       Null pointer, queueID is NULL.
+ * @retval   #LOS_ERRNO_QUEUE_PARA_ISZERO          The buffer size or maximum message size is 0.
+ * @retval   #LOS_ERRNO_QUEUE_SIZE_TOO_BIG         The parameter maxMsgSize is larger than 0xffff - 4, or a message
+ * of maxMsgSize bytes does not fit in the buffer.
+ * @par Dependency:
+ * <ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueCreate | LOS_QueueDelete
+ */
+extern UINT32 LOS_QueueCreateMsgBuf(CHAR *queueName,
+                                    UINT16 bufferSize,
+                                    UINT32 *queueID,
+                                    UINT32 flags,
+                                    UINT16 maxMsgSize);
+
 /**
  * @ingroup los_queue
  * @brief Read a queue.
@@ -487,6 +549,110 @@ extern UINT32 LOS_QueueWriteCopy(UINT32 queueID,
                                  UINT32 bufferSize,
                                  UINT32 timeOut);
 
+/**
+ * @ingroup los_queue
+ * @brief Read a batch of messages from a queue.
+ *
+ * @par Description:
+ * This API is used to read up to *msgCount messages from a specified queue within one critical section, and store
+ * them one after another to the address specified by bufferAddr, each message taking msgSize bytes.
+ * @attention
+ * <ul>
+ * <li>The specific queue should be created firstly.</li>
+ * <li>The task is blocked only when the queue is empty. Once at least one message is available, the messages
+ * present in the queue are read without blocking again, so fewer than *msgCount messages may be returned.</li>
+ * <li>Tasks waiting to write the queue are woken once for the whole batch, not once per message.</li>
+ * <li>The real size of each message is not returned, msgSize bytes are reserved in bufferAddr for each of them.</li>
+ * <li>Do not read or write a queue in unblocking modes such as an interrupt.</li>
+ * <li>This API cannot be called before the Huawei LiteOS is initialized.</li>
+ * <li>The argument timeOut is a relative time.</li>
+ * </ul>
+ *
+ * @param queueID        [IN]     Queue ID created by LOS_QueueCreate. The value range is
+ * [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ * @param bufferAddr     [OUT]    Starting address that stores the obtained messages. The starting address must not
+ * be null, and the buffer must hold (*msgCount) * msgSize bytes.
+ * @param msgSize        [IN]     Size reserved for each message in bufferAddr. It must not be less than the
+ * queue size.
+ * @param msgCount       [IN/OUT] Where to maintain the maximum message count before read, and the real count after
+ * read.
+ * @param timeOut        [IN]     Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval   #LOS_OK                              The queue is successfully read.
+ * @retval   #LOS_ERRNO_QUEUE_INVALID             The handle of the queue that is being read is invalid.
+ * @retval   #LOS_ERRNO_QUEUE_READ_PTR_NULL       The pointer passed in during queue reading is null.
+ * @retval   #LOS_ERRNO_QUEUE_READSIZE_ISZERO     The message size passed in during queue reading is 0.
+ * @retval   #LOS_ERRNO_QUEUE_BATCH_COUNT_ISZERO  The message count passed in during queue reading is 0.
+ * @retval   #LOS_ERRNO_QUEUE_READ_IN_INTERRUPT   The queue cannot be read during an interrupt when the time for
+ * waiting to processing the queue expires.
+ * @retval   #LOS_ERRNO_QUEUE_NOT_CREATE          The queue to be read is not created.
+ * @retval   #LOS_ERRNO_QUEUE_ISEMPTY             No resource is in the queue that is being read when the time for
+ * waiting to processing the queue expires.
+ * @retval   #LOS_ERRNO_QUEUE_PEND_IN_LOCK        The task is forbidden to be blocked on a queue when the task is
+ * locked.
+ * @retval   #LOS_ERRNO_QUEUE_TIMEOUT             The time set for waiting to processing the queue expires.
+ * @retval   #LOS_ERRNO_QUEUE_READ_SIZE_TOO_SMALL The message size passed in during queue reading is less than
+ * the queue size.
+ * @par Dependency:
+ * <ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueWriteBatch | LOS_QueueReadCopy
+ */
+extern UINT32 LOS_QueueReadBatch(UINT32 queueID,
+                                 VOID *bufferAddr,
+                                 UINT32 msgSize,
+                                 UINT32 *msgCount,
+                                 UINT32 timeOut);
+
+/**
+ * @ingroup los_queue
+ * @brief Write a batch of messages into a queue.
+ *
+ * @par Description:
+ * This API is used to write up to *msgCount messages, stored one after another at the address specified by
+ * bufferAddr with msgSize bytes each, into a queue within one critical section.
+ * @attention
+ * <ul>
+ * <li>The specific queue should be created firstly.</li>
+ * <li>The task is blocked only when the queue is full. Once at least one free node is available, the messages are
+ * written to the free nodes without blocking again, so fewer than *msgCount messages may be written.</li>
+ * <li>Tasks waiting to read the queue are woken once for the whole batch, not once per message.</li>
+ * <li>Do not read or write a queue in unblocking modes such as interrupt.</li>
+ * <li>This API cannot be called before the Huawei LiteOS is initialized.</li>
+ * <li>The argument timeOut is a relative time.</li>
+ * </ul>
+ *
+ * @param queueID        [IN]     Queue ID created by LOS_QueueCreate. The value range is
+ * [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ * @param bufferAddr     [IN]     Starting address that stores the messages to be written. The starting address must
+ * not be null.
+ * @param msgSize        [IN]     Size of each message. The value range is [1,USHRT_MAX - sizeof(UINT32)].
+ * @param msgCount       [IN/OUT] Where to maintain the message count before write, and the real count after write.
+ * @param timeOut        [IN]     Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval   #LOS_OK                                 The messages are successfully written into the queue.
+ * @retval   #LOS_ERRNO_QUEUE_INVALID                The queue handle passed in during queue writing is invalid.
+ * @retval   #LOS_ERRNO_QUEUE_WRITE_PTR_NULL         The pointer passed in during queue writing is null.
+ * @retval   #LOS_ERRNO_QUEUE_WRITESIZE_ISZERO       The message size passed in during queue writing is 0.
+ * @retval   #LOS_ERRNO_QUEUE_BATCH_COUNT_ISZERO     The message count passed in during queue writing is 0.
+ * @retval   #LOS_ERRNO_QUEUE_WRITE_IN_INTERRUPT     The queue cannot be written during an interrupt when the time
+ * for waiting to processing the queue expires.
+ * @retval   #LOS_ERRNO_QUEUE_NOT_CREATE             The queue into which the data is written is not created.
+ * @retval   #LOS_ERRNO_QUEUE_WRITE_SIZE_TOO_BIG     The message size passed in during queue writing is bigger than
+ * the queue size.
+ * @retval   #LOS_ERRNO_QUEUE_ISFULL                 No free node is available during queue writing.
+ * @retval   #LOS_ERRNO_QUEUE_PEND_IN_LOCK           The task is forbidden to be blocked on a queue when
+ * the task is locked.
+ * @retval   #LOS_ERRNO_QUEUE_TIMEOUT                The time set for waiting to processing the queue expires.
+ * @par Dependency:
+ * <ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueReadBatch | LOS_QueueWriteCopy
+ */
+extern UINT32 LOS_QueueWriteBatch(UINT32 queueID,
+                                  VOID *bufferAddr,
+                                  UINT32 msgSize,
+                                  UINT32 *msgCount,
+                                  UINT32 timeOut);
+
 /**
  * @ingroup los_queue
  * @brief Read a queue.
@@ -766,7 +932,8 @@ typedef enum {
 typedef struct {
     UINT8 *queue;      /**< Pointer to a queue handle */
     UINT16 queueState; /**< Queue state */
-    UINT16 queueLen;   /**< Queue length */
+    UINT16 queueType;  /**< Queue type, fixed-size nodes or message buffer */
+    UINT16 queueLen;   /**< Queue length, in bytes for a message buffer */
     UINT16 queueSize;  /**< Node size */
     UINT16 queueID;    /**< queueID */
     UINT16 queueHead;  /**< Node head */
@@ -775,6 +942,9 @@ typedef struct {
     LOS_DL_LIST readWriteList[OS_READWRITE_LEN]; /**< Pointer to the linked list to be read or written,
                                                       0:readlist, 1:writelist */
     LOS_DL_LIST memList; /**< Pointer to the memory linked list */
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    VOID *queueSet;      /**< Queue set the queue is a member of */
+#endif
 } LosQueueCB;
 
 /* queue state */
@@ -790,6 +960,31 @@ typedef struct {
   */
 #define OS_QUEUE_INUSED        1
 
+/* queue type */
+/**
+  *  @ingroup los_queue
+  *  Queue type: messages are stored in nodes of a fixed size.
+  */
+#define OS_QUEUE_TYPE_FIXED    0
+
+/**
+  *  @ingroup los_queue
+  *  Queue type: variable-length messages are stored in a byte ring, see LOS_QueueCreateMsgBuf.
+  */
+#define OS_QUEUE_TYPE_MSGBUF   1
+
+/**
+  *  @ingroup los_queue
+  *  Size of the length prefix in front of every message of a message buffer queue.
+  */
+#define OS_QUEUE_MSGBUF_HEAD_SIZE          sizeof(UINT16)
+
+/**
+  *  @ingroup los_queue
+  *  Bytes occupied in a message buffer queue by a message of the specified size.
+  */
+#define OS_QUEUE_MSGBUF_NODE_SIZE(msgSize) ((UINT32)(msgSize) + OS_QUEUE_MSGBUF_HEAD_SIZE)
+
 /**
   *  @ingroup los_queue
   *  Not in use.
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_queueset Queue set
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_QUEUESET_H
+#define _LOS_QUEUESET_H
+
+#include "los_list.h"
+#include "los_config.h"
+#include "los_event.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: Null pointer.
+ *
+ * Value: 0x02002200
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_QUEUESET_PTR_NULL             LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x00)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The queue set is not initialized.
+ *
+ * Value: 0x02002201
+ *
+ * Solution: Initialize the queue set with LOS_QueueSetInit before using it.
+ */
+#define LOS_ERRNO_QUEUESET_NOT_INITIALIZED      LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x01)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The member is invalid.
+ *
+ * Value: 0x02002202
+ *
+ * Solution: Pass in a created queue or semaphore or an initialized event, with a valid event mask and mode for an
+ * event.
+ */
+#define LOS_ERRNO_QUEUESET_MEMBER_INVALID       LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x02)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The queue set already holds LOSCFG_BASE_IPC_QUEUESET_MEMBER_LIMIT members.
+ *
+ * Value: 0x02002203
+ *
+ * Solution: Increase LOSCFG_BASE_IPC_QUEUESET_MEMBER_LIMIT, or remove members that are no longer needed.
+ */
+#define LOS_ERRNO_QUEUESET_MEMBER_FULL          LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x03)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The object is already a member of a queue set.
+ *
+ * Value: 0x02002204
+ *
+ * Solution: An object can belong to one queue set only, remove it from the other queue set first.
+ */
+#define LOS_ERRNO_QUEUESET_MEMBER_IN_SET        LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x04)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The object is not a member of the queue set.
+ *
+ * Value: 0x02002205
+ *
+ * Solution: Check the member type and handle passed in.
+ */
+#define LOS_ERRNO_QUEUESET_MEMBER_NOT_FOUND     LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x05)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The queue set is waited on in an interrupt.
+ *
+ * Value: 0x02002206
+ *
+ * Solution: Select with LOS_NO_WAIT in an interrupt.
+ */
+#define LOS_ERRNO_QUEUESET_PEND_INTERR          LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x06)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The task is waiting on a queue set while the task scheduling is locked.
+ *
+ * Value: 0x02002207
+ *
+ * Solution: Do not wait on a queue set while the task scheduling is locked.
+ */
+#define LOS_ERRNO_QUEUESET_PEND_IN_LOCK         LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x07)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: The time set for waiting on the queue set expires.
+ *
+ * Value: 0x02002208
+ *
+ * Solution: Increase the timeout.
+ */
+#define LOS_ERRNO_QUEUESET_TIMEOUT              LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x08)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: No member of the queue set is ready.
+ *
+ * Value: 0x02002209
+ *
+ * Solution: Select with a timeout to wait for a member to become ready.
+ */
+#define LOS_ERRNO_QUEUESET_NOT_READY            LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x09)
+
+/**
+ * @ingroup los_queueset
+ * Queue set error code: A task is waiting on the queue set.
+ *
+ * Value: 0x0200220a
+ *
+ * Solution: Do not destroy a queue set while a task is waiting on it.
+ */
+#define LOS_ERRNO_QUEUESET_IN_USE               LOS_ERRNO_OS_ERROR(LOS_MOD_QUEUESET, 0x0a)
+
+/**
+ * @ingroup los_queueset
+ * Member type: a queue, ready when it holds a message. The handle is the queue ID.
+ */
+#define LOS_QUEUESET_TYPE_QUEUE                 0
+
+/**
+ * @ingroup los_queueset
+ * Member type: a semaphore, ready when its count is not 0. The handle is the semaphore ID.
+ */
+#define LOS_QUEUESET_TYPE_SEM                   1
+
+/**
+ * @ingroup los_queueset
+ * Member type: an event, ready when its events satisfy eventMask and eventMode. The handle is the address of the
+ * EVENT_CB_S.
+ */
+#define LOS_QUEUESET_TYPE_EVENT                 2
+
+/**
+ * @ingroup los_queueset
+ * Queue set member descriptor.
+ */
+typedef struct {
+    UINT32 type;                 /**< LOS_QUEUESET_TYPE_QUEUE, LOS_QUEUESET_TYPE_SEM or LOS_QUEUESET_TYPE_EVENT */
+    UINTPTR handle;              /**< Queue ID, semaphore ID or event control block address */
+    UINT32 eventMask;            /**< Events an event member waits for, not used by other types */
+    UINT32 eventMode;            /**< LOS_WAITMODE_AND or LOS_WAITMODE_OR for an event member */
+} QUEUESET_MEMBER_S;
+
+/**
+ * @ingroup los_queueset
+ * Queue set control structure.
+ */
+typedef struct {
+    UINT32 memberCount;          /**< Number of members */
+    UINT32 scanIndex;            /**< Member the next readiness scan starts at */
+    QUEUESET_MEMBER_S member[LOSCFG_BASE_IPC_QUEUESET_MEMBER_LIMIT]; /**< Members */
+    LOS_DL_LIST waitList;        /**< Tasks waiting for a member to become ready */
+} QUEUESET_CB_S;
+
+/**
+ * @ingroup los_queueset
+ * @brief Initialize a queue set.
+ *
+ * @par Description:
+ * This API is used to initialize an empty queue set. Queues, semaphores and events added to it can then be waited
+ * on together with LOS_QueueSetSelect.
+ *
+ * @param queueSet     [OUT] Pointer to the queue set control block.
+ *
+ * @retval #LOS_ERRNO_QUEUESET_PTR_NULL         The passed-in pointer is null.
+ * @retval #LOS_OK                              The queue set is successfully initialized.
+ * @par Dependency:
+ * <ul><li>los_queueset.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueSetDestroy
+ */
+extern UINT32 LOS_QueueSetInit(QUEUESET_CB_S *queueSet);
+
+/**
+ * @ingroup los_queueset
+ * @brief Add a member to a queue set.
+ *
+ * @par Description:
+ * This API is used to add the queue, semaphore or event described by member to a queue set.
+ * @attention
+ * <ul>
+ * <li>An object can be a member of one queue set only.</li>
+ * <li>A queue, semaphore or event can not be deleted or destroyed while it is a member of a queue set.</li>
+ * <li>Selecting a member does not consume anything, the caller still reads the queue, pends the semaphore or reads
+ * the event, normally with LOS_NO_WAIT.</li>
+ * </ul>
+ *
+ * @param queueSet     [IN/OUT] Pointer to the queue set control block.
+ * @param member       [IN]     Descriptor of the member to add.
+ *
+ * @retval #LOS_ERRNO_QUEUESET_PTR_NULL         The passed-in pointer is null.
+ * @retval #LOS_ERRNO_QUEUESET_NOT_INITIALIZED  The queue set is not initialized.
+ * @retval #LOS_ERRNO_QUEUESET_MEMBER_INVALID   The member is invalid.
+ * @retval #LOS_ERRNO_QUEUESET_MEMBER_FULL      The queue set is full.
+ * @retval #LOS_ERRNO_QUEUESET_MEMBER_IN_SET    The object already belongs to a queue set.
+ * @retval #LOS_OK                              The member is successfully added.
+ * @par Dependency:
+ * <ul><li>los_queueset.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueSetRemove
+ */
+extern UINT32 LOS_QueueSetAdd(QUEUESET_CB_S *queueSet, const QUEUESET_MEMBER_S *member);
+
+/**
+ * @ingroup los_queueset
+ * @brief Remove a member from a queue set.
+ *
+ * @param queueSet     [IN/OUT] Pointer to the queue set control block.
+ * @param type         [IN]     Member type, LOS_QUEUESET_TYPE_QUEUE, LOS_QUEUESET_TYPE_SEM or LOS_QUEUESET_TYPE_EVENT.
+ * @param handle       [IN]     Queue ID, semaphore ID or event control block address.
+ *
+ * @retval #LOS_ERRNO_QUEUESET_PTR_NULL         The passed-in pointer is null.
+ * @retval #LOS_ERRNO_QUEUESET_NOT_INITIALIZED  The queue set is not initialized.
+ * @retval #LOS_ERRNO_QUEUESET_MEMBER_NOT_FOUND The object is not a member of the queue set.
+ * @retval #LOS_OK                              The member is successfully removed.
+ * @par Dependency:
+ * <ul><li>los_queueset.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueSetAdd
+ */
+extern UINT32 LOS_QueueSetRemove(QUEUESET_CB_S *queueSet, UINT32 type, UINTPTR handle);
+
+/**
+ * @ingroup los_queueset
+ * @brief Wait until a member of a queue set is ready.
+ *
+ * @par Description:
+ * This API is used to return a member of the queue set that is ready. If none is ready, the task waits on the
+ * queue set until a queue receives a message, a semaphore is posted or an event is written that makes a member
+ * ready, or until the timeout expires.
+ * @attention
+ * <ul>
+ * <li>Members are scanned round robin, starting after the member returned last time, so that a busy member does
+ * not starve the others.</li>
+ * <li>A message or semaphore that is handed directly to a task pending on the queue or semaphore itself does not
+ * make the member ready.</li>
+ * <li>If another task takes the ready resource before the woken task runs, the task waits again for the rest of
+ * the timeout.</li>
+ * </ul>
+ *
+ * @param queueSet     [IN/OUT] Pointer to the queue set control block.
+ * @param ready        [OUT]    Descriptor of the member that is ready.
+ * @param timeOut      [IN]     Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval #LOS_ERRNO_QUEUESET_PTR_NULL         The passed-in pointer is null.
+ * @retval #LOS_ERRNO_QUEUESET_NOT_INITIALIZED  The queue set is not initialized.
+ * @retval #LOS_ERRNO_QUEUESET_PEND_INTERR      The queue set is waited on in an interrupt.
+ * @retval #LOS_ERRNO_QUEUESET_PEND_IN_LOCK     The task scheduling is locked.
+ * @retval #LOS_ERRNO_QUEUESET_NOT_READY        No member is ready and timeOut is LOS_NO_WAIT.
+ * @retval #LOS_ERRNO_QUEUESET_TIMEOUT          The time set for waiting expires.
+ * @retval #LOS_OK                              A ready member is returned in ready.
+ * @par Dependency:
+ * <ul><li>los_queueset.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueSetAdd
+ */
+extern UINT32 LOS_QueueSetSelect(QUEUESET_CB_S *queueSet, QUEUESET_MEMBER_S *ready, UINT32 timeOut);
+
+/**
+ * @ingroup los_queueset
+ * @brief Destroy a queue set.
+ *
+ * @par Description:
+ * This API is used to destroy a queue set. All members are removed from it.
+ *
+ * @param queueSet     [IN/OUT] Pointer to the queue set control block.
+ *
+ * @retval #LOS_ERRNO_QUEUESET_PTR_NULL         The passed-in pointer is null.
+ * @retval #LOS_ERRNO_QUEUESET_NOT_INITIALIZED  The queue set is not initialized.
+ * @retval #LOS_ERRNO_QUEUESET_IN_USE           A task is waiting on the queue set.
+ * @retval #LOS_OK                              The queue set is successfully destroyed.
+ * @par Dependency:
+ * <ul><li>los_queueset.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueSetInit
+ */
+extern UINT32 LOS_QueueSetDestroy(QUEUESET_CB_S *queueSet);
+
+/**
+ * @ingroup los_queueset
+ * @brief Notify a queue set that one of its members became ready.
+ *
+ * @par Description:
+ * Called by the queue, semaphore and event modules with interrupts locked. The first task waiting on the queue
+ * set is woken up, the caller has to schedule if TRUE is returned.
+ */
+extern BOOL OsQueueSetNotify(VOID *queueSet);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_QUEUESET_H */
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_rwlock Reader-writer lock
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_RWLOCK_H
+#define _LOS_RWLOCK_H
+
+#include "los_task.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The memory request fails.
+ *
+ * Value: 0x02002300
+ *
+ * Solution: Decrease the number of reader-writer locks defined by LOSCFG_BASE_IPC_RWLOCK_LIMIT.
+ */
+#define LOS_ERRNO_RWLOCK_NO_MEMORY          LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x00)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The reader-writer lock is not usable.
+ *
+ * Value: 0x02002301
+ *
+ * Solution: Check whether the lock ID and the lock state are applicable for the current operation.
+ */
+#define LOS_ERRNO_RWLOCK_INVALID            LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x01)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: Null pointer.
+ *
+ * Value: 0x02002302
+ *
+ * Solution: Check whether the input parameter is usable.
+ */
+#define LOS_ERRNO_RWLOCK_PTR_NULL           LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x02)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: No reader-writer lock is available and the creation fails.
+ *
+ * Value: 0x02002303
+ *
+ * Solution: Increase the number of reader-writer locks defined by LOSCFG_BASE_IPC_RWLOCK_LIMIT.
+ */
+#define LOS_ERRNO_RWLOCK_ALL_BUSY           LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x03)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The lock cannot be taken in non-blocking mode.
+ *
+ * Value: 0x02002304
+ *
+ * Solution: Take the lock after it is released, or set a waiting time.
+ */
+#define LOS_ERRNO_RWLOCK_UNAVAILABLE        LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x04)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The lock is being taken during an interrupt.
+ *
+ * Value: 0x02002305
+ *
+ * Solution: Do not take a reader-writer lock during an interrupt.
+ */
+#define LOS_ERRNO_RWLOCK_PEND_INTERR        LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x05)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The task would wait for the lock while task scheduling is disabled.
+ *
+ * Value: 0x02002306
+ *
+ * Solution: Enable task scheduling, or set the waiting time to 0.
+ */
+#define LOS_ERRNO_RWLOCK_PEND_IN_LOCK       LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x06)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: Waiting for the lock times out.
+ *
+ * Value: 0x02002307
+ *
+ * Solution: Increase the waiting time or set the waiting time to LOS_WAIT_FOREVER.
+ */
+#define LOS_ERRNO_RWLOCK_TIMEOUT            LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x07)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The lock to be deleted is held or waited on.
+ *
+ * Value: 0x02002308
+ *
+ * Solution: Delete the lock after it is released and no task waits on it.
+ */
+#define LOS_ERRNO_RWLOCK_PENDED             LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x08)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: LOSCFG_BASE_IPC_RWLOCK_LIMIT is zero.
+ *
+ * Value: 0x02002309
+ *
+ * Solution: LOSCFG_BASE_IPC_RWLOCK_LIMIT should not be zero.
+ */
+#define LOS_ERRNO_RWLOCK_MAXNUM_ZERO        LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x09)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The calling task already holds the lock for writing.
+ *
+ * Value: 0x0200230a
+ *
+ * Solution: Do not take a write-locked lock again from the task that holds it.
+ */
+#define LOS_ERRNO_RWLOCK_DEADLOCK           LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x0a)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock error code: The calling task already holds LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT other locks for
+ * reading.
+ *
+ * Value: 0x0200230b
+ *
+ * Solution: Release a read lock first, or increase LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT.
+ */
+#define LOS_ERRNO_RWLOCK_READ_FULL          LOS_ERRNO_OS_ERROR(LOS_MOD_RWLOCK, 0x0b)
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock creation flag: readers are admitted while the lock is read-held even if writers wait.
+ * This gives the best read throughput but writers may starve under a steady stream of readers.
+ */
+#define LOS_RWLOCK_PREFER_READER            0x0U
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock creation flag: new readers wait while a writer waits, and a released write lock is handed
+ * to the next writer before the waiting readers.
+ */
+#define LOS_RWLOCK_PREFER_WRITER            0x1U
+
+/**
+ * @ingroup los_rwlock
+ * @brief Create a reader-writer lock.
+ *
+ * @par Description:
+ * This API is used to create a reader-writer lock. A handle is assigned to rwlockID when the lock is created
+ * successfully.
+ * @attention
+ * <ul>
+ * <li>The total number of reader-writer locks is pre-configured by LOSCFG_BASE_IPC_RWLOCK_LIMIT.</li>
+ * </ul>
+ *
+ * @param rwlockID    [OUT] Handle of the successfully created lock, in [0, LOSCFG_BASE_IPC_RWLOCK_LIMIT - 1].
+ * @param flags       [IN] LOS_RWLOCK_PREFER_READER or LOS_RWLOCK_PREFER_WRITER.
+ *
+ * @retval #LOS_ERRNO_RWLOCK_PTR_NULL        The rwlockID pointer is NULL.
+ * @retval #LOS_ERRNO_RWLOCK_INVALID         The flags are invalid.
+ * @retval #LOS_ERRNO_RWLOCK_ALL_BUSY        No available reader-writer lock.
+ * @retval #LOS_OK                           The lock is successfully created.
+ * @par Dependency:
+ * <ul><li>los_rwlock.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RwLockDelete
+ */
+extern UINT32 LOS_RwLockCreate(UINT32 *rwlockID, UINT32 flags);
+
+/**
+ * @ingroup los_rwlock
+ * @brief Delete a reader-writer lock.
+ *
+ * @par Description:
+ * This API is used to delete a reader-writer lock that is neither held nor waited on.
+ *
+ * @param rwlockID    [IN] Handle of the lock to be deleted.
+ *
+ * @retval #LOS_ERRNO_RWLOCK_INVALID         Invalid handle or lock not in use.
+ * @retval #LOS_ERRNO_RWLOCK_PENDED          The lock is held or tasks wait on it.
+ * @retval #LOS_OK                           The lock is successfully deleted.
+ * @par Dependency:
+ * <ul><li>los_rwlock.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RwLockCreate
+ */
+extern UINT32 LOS_RwLockDelete(UINT32 rwlockID);
+
+/**
+ * @ingroup los_rwlock
+ * @brief Take a reader-writer lock for reading.
+ *
+ * @par Description:
+ * This API is used to take a lock for reading, waiting at most timeout ticks. Any number of tasks can hold the
+ * lock for reading at the same time.
+ * @attention
+ * <ul>
+ * <li>Do not wait on a reader-writer lock during an interrupt.</li>
+ * <li>If a writer holds the lock, its priority is raised to that of the waiting task.</li>
+ * <li>A task can hold read locks on at most LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT locks at the same time.</li>
+ * <li>With LOS_RWLOCK_PREFER_WRITER a task that already holds the lock for reading must not take it again for
+ * reading while a writer waits, or it waits for itself.</li>
+ * </ul>
+ *
+ * @param rwlockID    [IN] Handle of the lock.
+ * @param timeout     [IN] Waiting time. The value range is [0, LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval #LOS_ERRNO_RWLOCK_INVALID         The lock is not in use.
+ * @retval #LOS_ERRNO_RWLOCK_DEADLOCK        The calling task holds the lock for writing.
+ * @retval #LOS_ERRNO_RWLOCK_READ_FULL       The calling task holds too many other locks for reading.
+ * @retval #LOS_ERRNO_RWLOCK_UNAVAILABLE     The lock is not available and timeout is 0.
+ * @retval #LOS_ERRNO_RWLOCK_PEND_INTERR     Called during an interrupt.
+ * @retval #LOS_ERRNO_RWLOCK_PEND_IN_LOCK    The task would wait while task scheduling is disabled.
+ * @retval #LOS_ERRNO_RWLOCK_TIMEOUT         Waiting for the lock timed out.
+ * @retval #LOS_OK                           The lock is held for reading.
+ * @par Dependency:
+ * <ul><li>los_rwlock.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RwLockUnlock
+ */
+extern UINT32 LOS_RwLockRdLock(UINT32 rwlockID, UINT32 timeout);
+
+/**
+ * @ingroup los_rwlock
+ * @brief Take a reader-writer lock for writing.
+ *
+ * @par Description:
+ * This API is used to take a lock exclusively, waiting at most timeout ticks.
+ * @attention
+ * <ul>
+ * <li>Do not wait on a reader-writer lock during an interrupt.</li>
+ * <li>If a writer holds the lock, its priority is raised to that of the waiting task. Readers are not raised, so
+ * a writer waiting for the readers to leave waits at their priorities: keep read sections short, or give the
+ * readers at least the priority of the writers.</li>
+ * <li>The write lock is not recursive.</li>
+ * </ul>
+ *
+ * @param rwlockID    [IN] Handle of the lock.
+ * @param timeout     [IN] Waiting time. The value range is [0, LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval #LOS_ERRNO_RWLOCK_INVALID         The lock is not in use.
+ * @retval #LOS_ERRNO_RWLOCK_DEADLOCK        The calling task already holds the lock for writing.
+ * @retval #LOS_ERRNO_RWLOCK_UNAVAILABLE     The lock is not available and timeout is 0.
+ * @retval #LOS_ERRNO_RWLOCK_PEND_INTERR     Called during an interrupt.
+ * @retval #LOS_ERRNO_RWLOCK_PEND_IN_LOCK    The task would wait while task scheduling is disabled.
+ * @retval #LOS_ERRNO_RWLOCK_TIMEOUT         Waiting for the lock timed out.
+ * @retval #LOS_OK                           The lock is held for writing.
+ * @par Dependency:
+ * <ul><li>los_rwlock.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RwLockUnlock
+ */
+extern UINT32 LOS_RwLockWrLock(UINT32 rwlockID, UINT32 timeout);
+
+/**
+ * @ingroup los_rwlock
+ * @brief Release a reader-writer lock.
+ *
+ * @par Description:
+ * This API releases the write lock if the calling task holds it, and one read lock otherwise. Waiting tasks the
+ * release makes eligible are handed the lock directly.
+ *
+ * @param rwlockID    [IN] Handle of the lock.
+ *
+ * @retval #LOS_ERRNO_RWLOCK_INVALID         The lock is not in use, or the calling task holds neither its write
+ *                                           lock nor a read lock on it.
+ * @retval #LOS_ERRNO_RWLOCK_PEND_INTERR     Called during an interrupt.
+ * @retval #LOS_OK                           The lock is released.
+ * @par Dependency:
+ * <ul><li>los_rwlock.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RwLockRdLock | LOS_RwLockWrLock
+ */
+extern UINT32 LOS_RwLockUnlock(UINT32 rwlockID);
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock object.
+ */
+typedef struct {
+    UINT8 rwlockStat;          /**< State OS_RWLOCK_UNUSED, OS_RWLOCK_USED */
+    UINT8 flags;               /**< LOS_RWLOCK_PREFER_READER or LOS_RWLOCK_PREFER_WRITER */
+    UINT16 readCount;          /**< Number of read locks held */
+    UINT32 rwlockID;           /**< Handle ID */
+    LOS_DL_LIST readList;      /**< Tasks waiting to read, the free list node while unused */
+    LOS_DL_LIST writeList;     /**< Tasks waiting to write */
+    LosTaskCB *writer;         /**< Task holding the lock for writing */
+    UINT16 priority;           /**< Priority of the writer when it took the lock */
+} LosRwLockCB;
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock state: not in use.
+ */
+#define OS_RWLOCK_UNUSED 0
+
+/**
+ * @ingroup los_rwlock
+ * Reader-writer lock state: in use.
+ */
+#define OS_RWLOCK_USED   1
+
+extern LosRwLockCB *g_allRwLock;
+
+/**
+ * @ingroup los_rwlock
+ * Obtain the pointer to the reader-writer lock object that has a specified handle.
+ */
+#define GET_RWLOCK(rwlockID) (((LosRwLockCB *)g_allRwLock) + (rwlockID))
+
+/**
+ * @ingroup los_rwlock
+ * Obtain the reader-writer lock object from its read wait list node.
+ */
+#define GET_RWLOCK_LIST(ptr) LOS_DL_LIST_ENTRY(ptr, LosRwLockCB, readList)
+
+/**
+ * @ingroup los_rwlock
+ * @brief Initializes the reader-writer locks.
+ *
+ * @par Description:
+ * This API is used to allocate the reader-writer lock control blocks during kernel initialization.
+ *
+ * @retval UINT32     Initialization result.
+ * @par Dependency:
+ * <ul><li>los_rwlock.h: the header file that contains the API declaration.</li></ul>
+ */
+extern UINT32 OsRwLockInit(VOID);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* __cplusplus */
+
+#endif /* _LOS_RWLOCK_H */
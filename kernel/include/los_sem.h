@@ -156,6 +156,16 @@ extern "C" {
  */
 #define LOS_ERRNO_SEM_MAXNUM_ZERO  LOS_ERRNO_OS_ERROR(LOS_MOD_SEM, 0x0A)
 
+/**
+ * @ingroup los_sem
+ * Semaphore error code: The number of units to take or give is invalid.
+ *
+ * Value: 0x0200070B
+ *
+ * Solution: Pass a count that is not zero and not greater than the maximum count of the semaphore.
+ */
+#define LOS_ERRNO_SEM_COUNT_INVALID LOS_ERRNO_OS_ERROR(LOS_MOD_SEM, 0x0B)
+
 /**
  * @ingroup los_sem
  * @brief Create a Counting semaphore.
@@ -285,6 +295,62 @@ extern UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout);
  */
 extern UINT32 LOS_SemPost(UINT32 semHandle);
 
+/**
+ * @ingroup los_sem
+ * @brief Request several units of a semaphore at once.
+ *
+ * @par Description:
+ * This API is used to take count units of the semaphore specified by semHandle in one call. Either all units are
+ * taken or the task waits until they can be; no units are held while waiting.
+ * @attention
+ * <ul>
+ * <li>The specified sem id must be created first. </li>
+ * <li>Waiters are served in FIFO order: while a task is waiting, later requests queue behind it even if enough
+ * units are available for them.</li>
+ * </ul>
+ *
+ * @param semHandle   [IN] ID of the semaphore control structure to be requested.
+ * @param count       [IN] Number of units to take. The value range is [1, maximum count of the semaphore].
+ * @param timeout     [IN] Timeout interval for waiting on the semaphore(unit: Tick), as for LOS_SemPend.
+ *
+ * @retval #LOS_ERRNO_SEM_INVALID          The passed-in semHandle value is invalid.
+ * @retval #LOS_ERRNO_SEM_COUNT_INVALID    The passed-in count value is invalid.
+ * @retval #LOS_ERRNO_SEM_UNAVAILABLE      There are not enough semaphore units available.
+ * @retval #LOS_ERRNO_SEM_PEND_INTERR      The API is called during an interrupt, which is forbidden.
+ * @retval #LOS_ERRNO_SEM_PEND_IN_LOCK     The task is unable to request a semaphore because task scheduling is locked.
+ * @retval #LOS_ERRNO_SEM_TIMEOUT          The request for the semaphore times out.
+ * @retval #LOS_OK   The semaphore request succeeds.
+ * @par Dependency:
+ * <ul><li>los_sem.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SemPostN | LOS_SemPend
+ */
+extern UINT32 LOS_SemPendN(UINT32 semHandle, UINT16 count, UINT32 timeout);
+
+/**
+ * @ingroup los_sem
+ * @brief Release several units of a semaphore at once.
+ *
+ * @par Description:
+ * This API is used to give count units back to the semaphore specified by semHandle and wake up as many waiting
+ * tasks, in FIFO order, as the available units can satisfy.
+ * @attention
+ * <ul>
+ * <li>The specified sem id must be created first. </li>
+ * </ul>
+ *
+ * @param semHandle   [IN] ID of the semaphore control structure to be released.
+ * @param count       [IN] Number of units to give. It must not be zero.
+ *
+ * @retval #LOS_ERRNO_SEM_INVALID          The passed-in semHandle value is invalid.
+ * @retval #LOS_ERRNO_SEM_COUNT_INVALID    The passed-in count value is zero.
+ * @retval #LOS_ERRNO_SEM_OVERFLOW         The release would exceed the maximum count of the semaphore.
+ * @retval #LOS_OK                         The semaphore units are successfully released.
+ * @par Dependency:
+ * <ul><li>los_sem.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SemPendN | LOS_SemPost
+ */
+extern UINT32 LOS_SemPostN(UINT32 semHandle, UINT16 count);
+
 extern UINT32 LOS_SemGetValue(UINT32 semHandle, INT32 *currVal);
 
 /**
@@ -297,6 +363,9 @@ typedef struct {
     UINT16 maxSemCount;  /**< Max number of available semaphores */
     UINT16 semID;        /**< Semaphore control structure ID */
     LOS_DL_LIST semList; /**< Queue of tasks that are waiting on a semaphore */
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    VOID *queueSet;      /**< Queue set the semaphore is a member of */
+#endif
 } LosSemCB;
 
 /**
@@ -373,6 +442,28 @@ extern UINT32 OsSemInit(VOID);
  */
 UINT32 OsSemCreate(UINT16 count, UINT16 maxCount, UINT32 *semHandle);
 
+/**
+ * @ingroup los_sem
+ * @brief Hand on the units reserved for a waiter that left the queue.
+ *
+ * @par Description:
+ * This API is used after a task waiting on the semaphore was taken off its queue other than by being woken up, e.g.
+ * when the task was deleted. Units held back for that task as the head of the queue go to the waiters behind it.
+ * @attention
+ * <ul>
+ * <li>It must be called with interrupts locked.</li>
+ * </ul>
+ *
+ * @param  semCB      [IN]Type  #LosSemCB * Semaphore the task waited on.
+ *
+ * @retval TRUE       A waiter has been woken up and a reschedule is needed.
+ * @retval FALSE      No waiter has been woken up.
+ * @par Dependency:
+ * <ul><li>los_sem.h: the header file that contains the API declaration.</li></ul>
+ * @see None.
+ */
+extern BOOL OsSemWaiterLeft(LosSemCB *semCB);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_streambuf Stream buffer
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_STREAMBUF_H
+#define _LOS_STREAMBUF_H
+
+#include "los_list.h"
+#include "los_config.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: Null pointer.
+ *
+ * Value: 0x02002100
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_STREAMBUF_PTR_NULL            LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x00)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The stream buffer is not initialized.
+ *
+ * Value: 0x02002101
+ *
+ * Solution: Initialize the stream buffer with LOS_StreamBufInit before using it.
+ */
+#define LOS_ERRNO_STREAMBUF_NOT_INITIALIZED     LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x01)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The size of the storage area is too small.
+ *
+ * Value: 0x02002102
+ *
+ * Solution: Pass in a storage area of at least two bytes.
+ */
+#define LOS_ERRNO_STREAMBUF_SIZE_INVALID        LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x02)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The trigger level is 0 or bigger than the capacity of the stream buffer.
+ *
+ * Value: 0x02002103
+ *
+ * Solution: Pass in a trigger level in the range of [1, size - 1].
+ */
+#define LOS_ERRNO_STREAMBUF_TRIGGER_INVALID     LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x03)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The length passed in during reading or writing is 0.
+ *
+ * Value: 0x02002104
+ *
+ * Solution: Pass in a length that is greater than 0.
+ */
+#define LOS_ERRNO_STREAMBUF_LEN_ISZERO          LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x04)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The length of a blocking write is bigger than the capacity of the stream buffer.
+ *
+ * Value: 0x02002105
+ *
+ * Solution: Split the data, or write it without waiting.
+ */
+#define LOS_ERRNO_STREAMBUF_LEN_TOO_BIG         LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x05)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The stream buffer is waited on in an interrupt.
+ *
+ * Value: 0x02002106
+ *
+ * Solution: Read or write the stream buffer with LOS_NO_WAIT in an interrupt.
+ */
+#define LOS_ERRNO_STREAMBUF_PEND_INTERR         LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x06)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The task is waiting on a stream buffer while the task scheduling is locked.
+ *
+ * Value: 0x02002107
+ *
+ * Solution: Do not wait on a stream buffer while the task scheduling is locked.
+ */
+#define LOS_ERRNO_STREAMBUF_PEND_IN_LOCK        LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x07)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The time set for waiting on the stream buffer expires.
+ *
+ * Value: 0x02002108
+ *
+ * Solution: Increase the timeout.
+ */
+#define LOS_ERRNO_STREAMBUF_TIMEOUT             LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x08)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The stream buffer is empty.
+ *
+ * Value: 0x02002109
+ *
+ * Solution: Write data into the stream buffer before reading it, or read it with a timeout.
+ */
+#define LOS_ERRNO_STREAMBUF_ISEMPTY             LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x09)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: The stream buffer is full.
+ *
+ * Value: 0x0200210a
+ *
+ * Solution: Read data from the stream buffer before writing it, or write it with a timeout.
+ */
+#define LOS_ERRNO_STREAMBUF_ISFULL              LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x0a)
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer error code: A task is already waiting on the same side of the stream buffer.
+ *
+ * Value: 0x0200210b
+ *
+ * Solution: Use a stream buffer from a single reader and a single writer only, and do not reset or destroy it
+ * while a task is waiting on it.
+ */
+#define LOS_ERRNO_STREAMBUF_IN_USE              LOS_ERRNO_OS_ERROR(LOS_MOD_STREAMBUF, 0x0b)
+
+/**
+ * @ingroup los_streambuf
+ * Index of the reading side of a stream buffer.
+ */
+#define OS_STREAMBUF_READ                       0
+
+/**
+ * @ingroup los_streambuf
+ * Index of the writing side of a stream buffer.
+ */
+#define OS_STREAMBUF_WRITE                      1
+
+/**
+ * @ingroup los_streambuf
+ * Stream buffer control structure.
+ */
+typedef struct {
+    UINT8 *buffer;                    /**< Storage area, one byte of it is kept free to tell full from empty */
+    UINT32 size;                      /**< Size of the storage area in bytes */
+    volatile UINT32 head;             /**< Write offset, only updated by the writer */
+    volatile UINT32 tail;             /**< Read offset, only updated by the reader */
+    UINT32 triggerLevel;              /**< Bytes to be present before a waiting reader is woken up */
+    UINT32 waitSize[2];               /**< Bytes the waiting reader or free bytes the waiting writer needs */
+    LOS_DL_LIST waitList[2];          /**< Waiting reader and writer */
+} STREAMBUF_CB_S;
+
+/**
+ * @ingroup los_streambuf
+ * @brief Initialize a stream buffer.
+ *
+ * @par Description:
+ * This API is used to initialize a single-reader single-writer byte stream buffer on the storage area specified by
+ * buffer.
+ * @attention
+ * <ul>
+ * <li>The capacity of the stream buffer is size - 1 bytes.</li>
+ * <li>Reading and writing use acquire/release updates of the offsets only, interrupts are masked only when a task
+ * has to wait or has to be woken up.</li>
+ * <li>Only one task or interrupt may read and only one may write the stream buffer at the same time.</li>
+ * </ul>
+ *
+ * @param streamBuf    [OUT] Pointer to the stream buffer control block.
+ * @param buffer       [IN]  Storage area of the stream buffer.
+ * @param size         [IN]  Size of the storage area in bytes. The value must not be less than 2.
+ * @param triggerLevel [IN]  Number of bytes that must be present before a reader waiting on the stream buffer is
+ * woken up. The value range is [1, size - 1].
+ *
+ * @retval #LOS_ERRNO_STREAMBUF_PTR_NULL        The passed-in pointer is null.
+ * @retval #LOS_ERRNO_STREAMBUF_SIZE_INVALID    The storage area is too small.
+ * @retval #LOS_ERRNO_STREAMBUF_TRIGGER_INVALID The trigger level is invalid.
+ * @retval #LOS_OK                              The stream buffer is successfully initialized.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufDestroy
+ */
+extern UINT32 LOS_StreamBufInit(STREAMBUF_CB_S *streamBuf, VOID *buffer, UINT32 size, UINT32 triggerLevel);
+
+/**
+ * @ingroup los_streambuf
+ * @brief Write data into a stream buffer.
+ *
+ * @par Description:
+ * This API is used to write up to *len bytes stored at the address specified by data into a stream buffer.
+ * @attention
+ * <ul>
+ * <li>With LOS_NO_WAIT, as many bytes as fit are written and the count is returned in *len. This is the way to
+ * write in an interrupt.</li>
+ * <li>Otherwise the task waits until there is free space for all of the data, *len must not exceed the capacity of
+ * the stream buffer.</li>
+ * <li>A reader waiting on the stream buffer is woken up once the trigger level is reached.</li>
+ * </ul>
+ *
+ * @param streamBuf    [IN/OUT] Pointer to the stream buffer control block.
+ * @param data         [IN]     Data to be written.
+ * @param len          [IN/OUT] Where to maintain the length of the data before write, and the written length after
+ * write.
+ * @param timeOut      [IN]     Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval #LOS_ERRNO_STREAMBUF_PTR_NULL        The passed-in pointer is null.
+ * @retval #LOS_ERRNO_STREAMBUF_NOT_INITIALIZED The stream buffer is not initialized.
+ * @retval #LOS_ERRNO_STREAMBUF_LEN_ISZERO      The passed-in length is 0.
+ * @retval #LOS_ERRNO_STREAMBUF_LEN_TOO_BIG     The length of a blocking write exceeds the capacity.
+ * @retval #LOS_ERRNO_STREAMBUF_PEND_INTERR     The stream buffer is waited on in an interrupt.
+ * @retval #LOS_ERRNO_STREAMBUF_PEND_IN_LOCK    The task scheduling is locked.
+ * @retval #LOS_ERRNO_STREAMBUF_IN_USE          Another writer is waiting on the stream buffer.
+ * @retval #LOS_ERRNO_STREAMBUF_ISFULL          No byte is written because the stream buffer is full.
+ * @retval #LOS_ERRNO_STREAMBUF_TIMEOUT         The time set for waiting expires, *len bytes were written.
+ * @retval #LOS_OK                              The data is successfully written.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufRead
+ */
+extern UINT32 LOS_StreamBufWrite(STREAMBUF_CB_S *streamBuf, const VOID *data, UINT32 *len, UINT32 timeOut);
+
+/**
+ * @ingroup los_streambuf
+ * @brief Read data from a stream buffer.
+ *
+ * @par Description:
+ * This API is used to read up to *len bytes from a stream buffer into the address specified by data.
+ * @attention
+ * <ul>
+ * <li>With LOS_NO_WAIT, the bytes that are present are read and the count is returned in *len. This is the way to
+ * read in an interrupt.</li>
+ * <li>Otherwise the task waits until the smaller of *len and the trigger level bytes are present.</li>
+ * <li>A writer waiting on the stream buffer is woken up once there is enough free space for its data.</li>
+ * </ul>
+ *
+ * @param streamBuf    [IN/OUT] Pointer to the stream buffer control block.
+ * @param data         [OUT]    Buffer that stores the read data.
+ * @param len          [IN/OUT] Where to maintain the size of the buffer before read, and the read length after read.
+ * @param timeOut      [IN]     Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ * @retval #LOS_ERRNO_STREAMBUF_PTR_NULL        The passed-in pointer is null.
+ * @retval #LOS_ERRNO_STREAMBUF_NOT_INITIALIZED The stream buffer is not initialized.
+ * @retval #LOS_ERRNO_STREAMBUF_LEN_ISZERO      The passed-in length is 0.
+ * @retval #LOS_ERRNO_STREAMBUF_PEND_INTERR     The stream buffer is waited on in an interrupt.
+ * @retval #LOS_ERRNO_STREAMBUF_PEND_IN_LOCK    The task scheduling is locked.
+ * @retval #LOS_ERRNO_STREAMBUF_IN_USE          Another reader is waiting on the stream buffer.
+ * @retval #LOS_ERRNO_STREAMBUF_ISEMPTY         No byte is read because the stream buffer is empty.
+ * @retval #LOS_ERRNO_STREAMBUF_TIMEOUT         The time set for waiting expires, nothing is read.
+ * @retval #LOS_OK                              The data is successfully read.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufWrite
+ */
+extern UINT32 LOS_StreamBufRead(STREAMBUF_CB_S *streamBuf, VOID *data, UINT32 *len, UINT32 timeOut);
+
+/**
+ * @ingroup los_streambuf
+ * @brief Set the trigger level of a stream buffer.
+ *
+ * @par Description:
+ * This API is used to change the number of bytes that must be present before a waiting reader is woken up.
+ *
+ * @param streamBuf    [IN/OUT] Pointer to the stream buffer control block.
+ * @param triggerLevel [IN]     New trigger level. The value range is [1, size - 1].
+ *
+ * @retval #LOS_ERRNO_STREAMBUF_PTR_NULL        The passed-in pointer is null.
+ * @retval #LOS_ERRNO_STREAMBUF_NOT_INITIALIZED The stream buffer is not initialized.
+ * @retval #LOS_ERRNO_STREAMBUF_TRIGGER_INVALID The trigger level is invalid.
+ * @retval #LOS_OK                              The trigger level is successfully set.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufInit
+ */
+extern UINT32 LOS_StreamBufTriggerLevelSet(STREAMBUF_CB_S *streamBuf, UINT32 triggerLevel);
+
+/**
+ * @ingroup los_streambuf
+ * @brief Get the number of bytes present in a stream buffer.
+ *
+ * @param streamBuf    [IN] Pointer to the stream buffer control block.
+ *
+ * @retval #UINT32     Number of bytes that can be read, 0 if streamBuf is invalid.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufSpaceGet
+ */
+extern UINT32 LOS_StreamBufUsedGet(const STREAMBUF_CB_S *streamBuf);
+
+/**
+ * @ingroup los_streambuf
+ * @brief Get the free space of a stream buffer.
+ *
+ * @param streamBuf    [IN] Pointer to the stream buffer control block.
+ *
+ * @retval #UINT32     Number of bytes that can be written, 0 if streamBuf is invalid.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufUsedGet
+ */
+extern UINT32 LOS_StreamBufSpaceGet(const STREAMBUF_CB_S *streamBuf);
+
+/**
+ * @ingroup los_streambuf
+ * @brief Discard all data in a stream buffer.
+ *
+ * @attention
+ * <ul>
+ * <li>The reader and the writer must not access the stream buffer while it is being reset.</li>
+ * </ul>
+ *
+ * @param streamBuf    [IN/OUT] Pointer to the stream buffer control block.
+ *
+ * @retval #LOS_ERRNO_STREAMBUF_PTR_NULL        The passed-in pointer is null.
+ * @retval #LOS_ERRNO_STREAMBUF_NOT_INITIALIZED The stream buffer is not initialized.
+ * @retval #LOS_ERRNO_STREAMBUF_IN_USE          A task is waiting on the stream buffer.
+ * @retval #LOS_OK                              The stream buffer is successfully reset.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufInit
+ */
+extern UINT32 LOS_StreamBufReset(STREAMBUF_CB_S *streamBuf);
+
+/**
+ * @ingroup los_streambuf
+ * @brief Destroy a stream buffer.
+ *
+ * @param streamBuf    [IN/OUT] Pointer to the stream buffer control block.
+ *
+ * @retval #LOS_ERRNO_STREAMBUF_PTR_NULL        The passed-in pointer is null.
+ * @retval #LOS_ERRNO_STREAMBUF_IN_USE          A task is waiting on the stream buffer.
+ * @retval #LOS_OK                              The stream buffer is successfully destroyed.
+ * @par Dependency:
+ * <ul><li>los_streambuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_StreamBufInit
+ */
+extern UINT32 LOS_StreamBufDestroy(STREAMBUF_CB_S *streamBuf);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_STREAMBUF_H */
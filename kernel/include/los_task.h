@@ -42,6 +42,7 @@
 #include "los_event.h"
 #include "los_tick.h"
 #include "los_sortlink.h"
+#include "los_memory.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -1323,6 +1324,16 @@ extern VOID LOS_UDelay(UINT64 microseconds);
 #define OS_TCB_FROM_TID(taskID)                         (((LosTaskCB *)g_taskCBArray) + (taskID))
 #define OS_IDLE_TASK_ENTRY                              ((TSK_ENTRY_FUNC)OsIdleTask)
 
+#if (LOSCFG_BASE_IPC_RWLOCK == 1)
+/**
+ * @ingroup los_task
+ * Read locks a task holds on one reader-writer lock.
+ */
+typedef struct {
+    UINT16 rwlockID;           /**< Handle of the lock */
+    UINT16 count;              /**< Read locks held on it, 0 for a free slot */
+} LosRwLockRead;
+#endif
 
 /**
  * @ingroup los_task
@@ -1342,6 +1353,14 @@ typedef struct {
     TSK_ENTRY_FUNC              taskEntry;                /**< Task entrance function */
     VOID                        *taskSem;                 /**< Task-held semaphore */
     VOID                        *taskMux;                 /**< Task-held mutex */
+    UINT32                      semPendCount;             /**< Semaphore units requested while pending */
+#if (LOSCFG_BASE_IPC_RWLOCK == 1)
+    LosRwLockRead               rwlockRead[LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT]; /**< Locks held for reading */
+#endif
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+    VOID                        *taskBarrier;             /**< Barrier the task has arrived at */
+    UINT16                      barrierRound;             /**< Round of the barrier the task arrived in */
+#endif
     UINT32                      arg;                      /**< Parameter */
     CHAR                        *taskName;                /**< Task name */
     LOS_DL_LIST                 pendList;
@@ -1351,6 +1370,9 @@ typedef struct {
     UINT32                      eventMode;                /**< Event mode */
     VOID                        *msg;                     /**< Memory allocated to queues */
     INT32                       errorNo;
+#if (LOSCFG_MEM_TCACHE == 1)
+    LosMemTcache                memCache;                 /**< Small blocks cached for the task */
+#endif
 } LosTaskCB;
 
 typedef struct {
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_barrier.h"
+#include "los_config.h"
+#include "los_debug.h"
+#include "los_interrupt.h"
+#include "los_memory.h"
+#include "los_sched.h"
+
+
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+
+LITE_OS_SEC_BSS       LosBarrierCB *g_allBarrier = NULL;
+LITE_OS_SEC_DATA_INIT LOS_DL_LIST g_unusedBarrierList;
+
+/*****************************************************************************
+ Function     : OsBarrierInit
+ Description  : Initializes the barriers
+ Input        : None
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 OsBarrierInit(VOID)
+{
+    LosBarrierCB *barrierNode = NULL;
+    UINT32 index;
+
+    LOS_ListInit(&g_unusedBarrierList);
+
+    if (LOSCFG_BASE_IPC_BARRIER_LIMIT == 0) {
+        return LOS_ERRNO_BARRIER_MAXNUM_ZERO;
+    }
+
+    g_allBarrier = (LosBarrierCB *)LOS_MemAlloc(m_aucSysMem0, (LOSCFG_BASE_IPC_BARRIER_LIMIT * sizeof(LosBarrierCB)));
+    if (g_allBarrier == NULL) {
+        return LOS_ERRNO_BARRIER_NO_MEMORY;
+    }
+
+    for (index = 0; index < LOSCFG_BASE_IPC_BARRIER_LIMIT; index++) {
+        barrierNode = ((LosBarrierCB *)g_allBarrier) + index;
+        barrierNode->barrierID = index;
+        barrierNode->barrierStat = OS_BARRIER_UNUSED;
+        LOS_ListTailInsert(&g_unusedBarrierList, &barrierNode->barrierList);
+    }
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function     : LOS_BarrierCreate
+ Description  : Create a barrier
+ Input        : count ------ Number of tasks that release the barrier
+ Output       : barrierID ------ Barrier handle
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_BarrierCreate(UINT16 count, UINT32 *barrierID)
+{
+    UINT32 intSave;
+    LosBarrierCB *barrierCreated = NULL;
+    LOS_DL_LIST *unusedBarrier = NULL;
+    UINT32 errNo;
+    UINT32 errLine;
+
+    if (barrierID == NULL) {
+        return LOS_ERRNO_BARRIER_PTR_NULL;
+    }
+
+    if (count == 0) {
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_BARRIER_COUNT_INVALID);
+    }
+
+    intSave = LOS_IntLock();
+    if (LOS_ListEmpty(&g_unusedBarrierList)) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_BARRIER_ALL_BUSY);
+    }
+
+    unusedBarrier = LOS_DL_LIST_FIRST(&g_unusedBarrierList);
+    LOS_ListDelete(unusedBarrier);
+    barrierCreated = GET_BARRIER_LIST(unusedBarrier);
+    barrierCreated->barrierStat = OS_BARRIER_USED;
+    barrierCreated->count = count;
+    barrierCreated->arrived = 0;
+    barrierCreated->round = 0;
+    LOS_ListInit(&barrierCreated->barrierList);
+    *barrierID = barrierCreated->barrierID;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+ERR_HANDLER:
+    OS_RETURN_ERROR_P2(errLine, errNo);
+}
+
+/*****************************************************************************
+ Function     : LOS_BarrierDelete
+ Description  : Delete a barrier
+ Input        : barrierID ------ Barrier handle
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_BarrierDelete(UINT32 barrierID)
+{
+    UINT32 intSave;
+    LosBarrierCB *barrierDeleted = NULL;
+    UINT32 errNo;
+    UINT32 errLine;
+
+    if (barrierID >= (UINT32)LOSCFG_BASE_IPC_BARRIER_LIMIT) {
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_BARRIER_INVALID);
+    }
+
+    barrierDeleted = GET_BARRIER(barrierID);
+    intSave = LOS_IntLock();
+    if (barrierDeleted->barrierStat == OS_BARRIER_UNUSED) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_BARRIER_INVALID);
+    }
+
+    if (barrierDeleted->arrived != 0) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_BARRIER_PENDED);
+    }
+
+    LOS_ListAdd(&g_unusedBarrierList, &barrierDeleted->barrierList);
+    barrierDeleted->barrierStat = OS_BARRIER_UNUSED;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+ERR_HANDLER:
+    OS_RETURN_ERROR_P2(errLine, errNo);
+}
+
+STATIC_INLINE UINT32 OsBarrierWaitCheck(const LosBarrierCB *barrier)
+{
+    if (barrier->barrierStat == OS_BARRIER_UNUSED) {
+        return LOS_ERRNO_BARRIER_INVALID;
+    }
+
+    if (OS_INT_ACTIVE) {
+        return LOS_ERRNO_BARRIER_PEND_INTERR;
+    }
+
+    if (g_losTaskLock) {
+        PRINT_ERR("!!!LOS_ERRNO_BARRIER_PEND_IN_LOCK!!!\n");
+        return LOS_ERRNO_BARRIER_PEND_IN_LOCK;
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function     : LOS_BarrierWait
+ Description  : Wait until the configured number of tasks arrive at a barrier
+ Input        : barrierID ------ Barrier handle
+              : timeout   ------ Waiting time
+ Output       : isLast    ------ Whether the caller released the barrier
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_BarrierWait(UINT32 barrierID, UINT32 timeout, BOOL *isLast)
+{
+    UINT32 intSave;
+    LosBarrierCB *barrier = NULL;
+    LosTaskCB *runningTask = NULL;
+    LosTaskCB *resumedTask = NULL;
+    UINT16 round;
+    UINT32 retErr;
+
+    if (barrierID >= (UINT32)LOSCFG_BASE_IPC_BARRIER_LIMIT) {
+        OS_RETURN_ERROR(LOS_ERRNO_BARRIER_INVALID);
+    }
+
+    if (isLast != NULL) {
+        *isLast = FALSE;
+    }
+
+    barrier = GET_BARRIER(barrierID);
+    intSave = LOS_IntLock();
+    retErr = OsBarrierWaitCheck(barrier);
+    if (retErr != LOS_OK) {
+        LOS_IntRestore(intSave);
+        OS_RETURN_ERROR(retErr);
+    }
+
+    if ((barrier->arrived + 1) >= barrier->count) {
+        /* Release the round as one step, so every waiter sees the same round and no arrival is counted twice. */
+        while (!LOS_ListEmpty(&barrier->barrierList)) {
+            resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&barrier->barrierList));
+            OsSchedTaskWake(resumedTask);
+        }
+        barrier->arrived = 0;
+        barrier->round++;
+        LOS_IntRestore(intSave);
+        if (isLast != NULL) {
+            *isLast = TRUE;
+        }
+        if (resumedTask != NULL) {
+            LOS_Schedule();
+        }
+        return LOS_OK;
+    }
+
+    if (timeout == 0) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_BARRIER_TIMEOUT;
+    }
+
+    runningTask = g_losTask.runTask;
+    round = barrier->round;
+    barrier->arrived++;
+    runningTask->taskBarrier = (VOID *)barrier;
+    runningTask->barrierRound = round;
+    OsSchedTaskWait(&barrier->barrierList, timeout);
+    LOS_IntRestore(intSave);
+    LOS_Schedule();
+
+    intSave = LOS_IntLock();
+    runningTask->taskBarrier = NULL;
+    if (runningTask->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+        runningTask->taskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+        /* The barrier may have been released after the timeout fired but before this task ran again. */
+        if (barrier->round == round) {
+            barrier->arrived--;
+            retErr = LOS_ERRNO_BARRIER_TIMEOUT;
+        }
+    }
+    LOS_IntRestore(intSave);
+    return retErr;
+}
+
+/*****************************************************************************
+ Function     : OsBarrierWaiterLeft
+ Description  : Take back the arrival of a waiter that has left the barrier
+                without returning from LOS_BarrierWait, e.g. because it was deleted
+ Input        : barrier ------ Barrier the task arrived at, interrupts locked
+              : round   ------ Round the task arrived in
+ Output       : None
+ Return       : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID OsBarrierWaiterLeft(LosBarrierCB *barrier, UINT16 round)
+{
+    /* Once the round has been released, its arrivals have already been reset. */
+    if ((barrier->barrierStat == OS_BARRIER_USED) && (barrier->round == round) && (barrier->arrived != 0)) {
+        barrier->arrived--;
+    }
+}
+#endif /* (LOSCFG_BASE_IPC_BARRIER == 1) */
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_condvar.h"
+#include "los_config.h"
+#include "los_debug.h"
+#include "los_interrupt.h"
+#include "los_memory.h"
+#include "los_sched.h"
+
+
+#if (LOSCFG_BASE_IPC_CONDVAR == 1)
+
+LITE_OS_SEC_BSS       LosCondCB *g_allCondVar = NULL;
+LITE_OS_SEC_DATA_INIT LOS_DL_LIST g_unusedCondVarList;
+
+/*****************************************************************************
+ Function     : OsCondVarInit
+ Description  : Initializes the condition variables
+ Input        : None
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 OsCondVarInit(VOID)
+{
+    LosCondCB *condNode = NULL;
+    UINT32 index;
+
+    LOS_ListInit(&g_unusedCondVarList);
+
+    if (LOSCFG_BASE_IPC_CONDVAR_LIMIT == 0) {
+        return LOS_ERRNO_CONDVAR_MAXNUM_ZERO;
+    }
+
+    g_allCondVar = (LosCondCB *)LOS_MemAlloc(m_aucSysMem0, (LOSCFG_BASE_IPC_CONDVAR_LIMIT * sizeof(LosCondCB)));
+    if (g_allCondVar == NULL) {
+        return LOS_ERRNO_CONDVAR_NO_MEMORY;
+    }
+
+    for (index = 0; index < LOSCFG_BASE_IPC_CONDVAR_LIMIT; index++) {
+        condNode = ((LosCondCB *)g_allCondVar) + index;
+        condNode->condID = index;
+        condNode->condStat = OS_CONDVAR_UNUSED;
+        LOS_ListTailInsert(&g_unusedCondVarList, &condNode->condList);
+    }
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function     : LOS_CondCreate
+ Description  : Create a condition variable
+ Input        : None
+ Output       : condID ------ Condition variable handle
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_CondCreate(UINT32 *condID)
+{
+    UINT32 intSave;
+    LosCondCB *condCreated = NULL;
+    LOS_DL_LIST *unusedCond = NULL;
+    UINT32 errNo;
+    UINT32 errLine;
+
+    if (condID == NULL) {
+        return LOS_ERRNO_CONDVAR_PTR_NULL;
+    }
+
+    intSave = LOS_IntLock();
+    if (LOS_ListEmpty(&g_unusedCondVarList)) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_CONDVAR_ALL_BUSY);
+    }
+
+    unusedCond = LOS_DL_LIST_FIRST(&g_unusedCondVarList);
+    LOS_ListDelete(unusedCond);
+    condCreated = GET_CONDVAR_LIST(unusedCond);
+    condCreated->condStat = OS_CONDVAR_USED;
+    LOS_ListInit(&condCreated->condList);
+    *condID = condCreated->condID;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+ERR_HANDLER:
+    OS_RETURN_ERROR_P2(errLine, errNo);
+}
+
+/*****************************************************************************
+ Function     : LOS_CondDelete
+ Description  : Delete a condition variable
+ Input        : condID ------ Condition variable handle
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_CondDelete(UINT32 condID)
+{
+    UINT32 intSave;
+    LosCondCB *condDeleted = NULL;
+    UINT32 errNo;
+    UINT32 errLine;
+
+    if (condID >= (UINT32)LOSCFG_BASE_IPC_CONDVAR_LIMIT) {
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_CONDVAR_INVALID);
+    }
+
+    condDeleted = GET_CONDVAR(condID);
+    intSave = LOS_IntLock();
+    if (condDeleted->condStat == OS_CONDVAR_UNUSED) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_CONDVAR_INVALID);
+    }
+
+    if (!LOS_ListEmpty(&condDeleted->condList)) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_CONDVAR_PENDED);
+    }
+
+    LOS_ListAdd(&g_unusedCondVarList, &condDeleted->condList);
+    condDeleted->condStat = OS_CONDVAR_UNUSED;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+ERR_HANDLER:
+    OS_RETURN_ERROR_P2(errLine, errNo);
+}
+
+STATIC_INLINE UINT32 OsCondWaitCheck(const LosCondCB *cond, const LosMuxCB *mux)
+{
+    if (cond->condStat == OS_CONDVAR_UNUSED) {
+        return LOS_ERRNO_CONDVAR_INVALID;
+    }
+
+    if (OS_INT_ACTIVE) {
+        return LOS_ERRNO_CONDVAR_PEND_INTERR;
+    }
+
+    if (g_losTaskLock) {
+        PRINT_ERR("!!!LOS_ERRNO_CONDVAR_PEND_IN_LOCK!!!\n");
+        return LOS_ERRNO_CONDVAR_PEND_IN_LOCK;
+    }
+
+    if ((mux->muxStat == OS_MUX_UNUSED) || (OsMuxOwnerGet(mux) != g_losTask.runTask) || (OsMuxCountGet(mux) != 1)) {
+        return LOS_ERRNO_CONDVAR_MUX_INVALID;
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function     : LOS_CondWait
+ Description  : Unlock a mutex and wait on a condition variable as one step
+ Input        : condID    ------ Condition variable handle
+              : muxHandle ------ Mutex handle
+              : timeout   ------ Waiting time
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_CondWait(UINT32 condID, UINT32 muxHandle, UINT32 timeout)
+{
+    UINT32 intSave;
+    LosCondCB *cond = NULL;
+    LosMuxCB *mux = NULL;
+    LosTaskCB *runningTask = NULL;
+    UINT32 retErr;
+    UINT32 muxErr;
+
+    if ((condID >= (UINT32)LOSCFG_BASE_IPC_CONDVAR_LIMIT) || (muxHandle >= (UINT32)LOSCFG_BASE_IPC_MUX_LIMIT)) {
+        OS_RETURN_ERROR(LOS_ERRNO_CONDVAR_INVALID);
+    }
+
+    cond = GET_CONDVAR(condID);
+    mux = GET_MUX(muxHandle);
+    intSave = LOS_IntLock();
+    retErr = OsCondWaitCheck(cond, mux);
+    if (retErr != LOS_OK) {
+        LOS_IntRestore(intSave);
+        OS_RETURN_ERROR(retErr);
+    }
+
+    if (timeout == 0) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_CONDVAR_TIMEOUT;
+    }
+
+    /* Release the mutex and queue on the condition before interrupts are enabled again. */
+    runningTask = g_losTask.runTask;
+    mux->muxCount = 0;
+    (VOID)OsMuxRelease(mux);
+    OsSchedTaskWait(&cond->condList, timeout);
+    LOS_IntRestore(intSave);
+    LOS_Schedule();
+
+    intSave = LOS_IntLock();
+    if (runningTask->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+        runningTask->taskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+        retErr = LOS_ERRNO_CONDVAR_TIMEOUT;
+    }
+    LOS_IntRestore(intSave);
+
+    /* The caller must not go on as the owner of a mutex it failed to take back, e.g. one deleted meanwhile. */
+    muxErr = LOS_MuxPend(muxHandle, LOS_WAIT_FOREVER);
+    if (muxErr != LOS_OK) {
+        return muxErr;
+    }
+    return retErr;
+}
+
+STATIC UINT32 OsCondWake(UINT32 condID, BOOL wakeAll)
+{
+    UINT32 intSave;
+    LosCondCB *cond = NULL;
+    LosTaskCB *resumedTask = NULL;
+    BOOL needSched = FALSE;
+
+    if (condID >= (UINT32)LOSCFG_BASE_IPC_CONDVAR_LIMIT) {
+        OS_RETURN_ERROR(LOS_ERRNO_CONDVAR_INVALID);
+    }
+
+    cond = GET_CONDVAR(condID);
+    intSave = LOS_IntLock();
+    if (cond->condStat == OS_CONDVAR_UNUSED) {
+        LOS_IntRestore(intSave);
+        OS_RETURN_ERROR(LOS_ERRNO_CONDVAR_INVALID);
+    }
+
+    while (!LOS_ListEmpty(&cond->condList)) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&cond->condList));
+        OsSchedTaskWake(resumedTask);
+        needSched = TRUE;
+        if (!wakeAll) {
+            break;
+        }
+    }
+
+    LOS_IntRestore(intSave);
+    if (needSched) {
+        LOS_Schedule();
+    }
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function     : LOS_CondSignal
+ Description  : Wake the task that has waited longest on a condition variable
+ Input        : condID ------ Condition variable handle
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_CondSignal(UINT32 condID)
+{
+    return OsCondWake(condID, FALSE);
+}
+
+/*****************************************************************************
+ Function     : LOS_CondBroadcast
+ Description  : Wake all tasks waiting on a condition variable
+ Input        : condID ------ Condition variable handle
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_CondBroadcast(UINT32 condID)
+{
+    return OsCondWake(condID, TRUE);
+}
+#endif /* (LOSCFG_BASE_IPC_CONDVAR == 1) */
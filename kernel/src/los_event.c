@@ -34,15 +34,84 @@
 #include "los_interrupt.h"
 #include "los_task.h"
 #include "los_sched.h"
+#include "los_queueset.h"
+
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+#define OS_EVENT_BIT_WIDTH 32
+
+/* Fold an event mask onto the wait buckets, bucket n collects the event bits congruent to n. */
+STATIC INLINE UINT32 OsEventBucketMap(UINT32 events)
+{
+    UINT32 map = events;
+    UINT32 width;
+
+    for (width = OS_EVENT_BIT_WIDTH >> 1; width >= LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS; width >>= 1) {
+        map = (map | (map >> width)) & ((1U << width) - 1);
+    }
+    return map;
+}
+
+STATIC INLINE UINT32 OsEventBucketIndex(UINT32 map)
+{
+    return (OS_EVENT_BIT_WIDTH - 1) - CLZ(map);
+}
+#endif
+
+/* A task waiting for bits that all fold onto one bucket waits there, any other task on stEventList. */
+STATIC INLINE LOS_DL_LIST *OsEventWaitList(PEVENT_CB_S eventCB, UINT32 eventMask)
+{
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    UINT32 map = OsEventBucketMap(eventMask);
+    if ((map & (map - 1)) == 0) {
+        return &eventCB->waitBucket[OsEventBucketIndex(map)];
+    }
+#endif
+    return &eventCB->stEventList;
+}
+
+/* Wake the waiters on list that the write of events satisfies. Returns TRUE if any task was woken. */
+STATIC BOOL OsEventWakeList(PEVENT_CB_S eventCB, LOS_DL_LIST *list, UINT32 events)
+{
+    LosTaskCB *resumedTask = NULL;
+    LosTaskCB *nextTask = NULL;
+    BOOL woken = FALSE;
+
+    for (resumedTask = LOS_DL_LIST_ENTRY(list->pstNext, LosTaskCB, pendList);
+         &resumedTask->pendList != list;) {
+        nextTask = LOS_DL_LIST_ENTRY(resumedTask->pendList.pstNext, LosTaskCB, pendList);
+
+        if (((resumedTask->eventMode & LOS_WAITMODE_OR) && (resumedTask->eventMask & events) != 0) ||
+            ((resumedTask->eventMode & LOS_WAITMODE_AND) &&
+             ((resumedTask->eventMask & eventCB->uwEventID) == resumedTask->eventMask))) {
+            woken = TRUE;
+
+            OsSchedTaskWake(resumedTask);
+        }
+        resumedTask = nextTask;
+    }
+    return woken;
+}
 
 
 LITE_OS_SEC_TEXT_INIT UINT32 LOS_EventInit(PEVENT_CB_S eventCB)
 {
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    UINT32 index;
+#endif
+
     if (eventCB == NULL) {
         return LOS_ERRNO_EVENT_PTR_NULL;
     }
     eventCB->uwEventID = 0;
     LOS_ListInit(&eventCB->stEventList);
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    for (index = 0; index < LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS; index++) {
+        LOS_ListInit(&eventCB->waitBucket[index]);
+    }
+#endif
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    eventCB->queueSet = NULL;
+#endif
     OsHookCall(LOS_HOOK_TYPE_EVENT_INIT, eventCB);
     return LOS_OK;
 }
@@ -124,7 +193,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UIN
         runTsk = g_losTask.runTask;
         runTsk->eventMask = eventMask;
         runTsk->eventMode = mode;
-        OsSchedTaskWait(&eventCB->stEventList, timeOut);
+        OsSchedTaskWait(OsEventWaitList(eventCB, eventMask), timeOut);
         LOS_IntRestore(intSave);
         LOS_Schedule();
 
@@ -144,10 +213,12 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UIN
 
 LITE_OS_SEC_TEXT UINT32 LOS_EventWrite(PEVENT_CB_S eventCB, UINT32 events)
 {
-    LosTaskCB *resumedTask = NULL;
-    LosTaskCB *nextTask = (LosTaskCB *)NULL;
     UINT32 intSave;
     UINT8 exitFlag = 0;
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    UINT32 buckets;
+    UINT32 index;
+#endif
     if (eventCB == NULL) {
         return LOS_ERRNO_EVENT_PTR_NULL;
     }
@@ -160,27 +231,36 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventWrite(PEVENT_CB_S eventCB, UINT32 events)
     intSave = LOS_IntLock();
     OsHookCall(LOS_HOOK_TYPE_EVENT_WRITE, eventCB, events);
     eventCB->uwEventID |= events;
-    if (!LOS_ListEmpty(&eventCB->stEventList)) {
-        for (resumedTask = LOS_DL_LIST_ENTRY((&eventCB->stEventList)->pstNext, LosTaskCB, pendList);
-             &resumedTask->pendList != (&eventCB->stEventList);) {
-            nextTask = LOS_DL_LIST_ENTRY(resumedTask->pendList.pstNext, LosTaskCB, pendList);
-
-            if (((resumedTask->eventMode & LOS_WAITMODE_OR) && (resumedTask->eventMask & events) != 0) ||
-                ((resumedTask->eventMode & LOS_WAITMODE_AND) &&
-                 ((resumedTask->eventMask & eventCB->uwEventID) == resumedTask->eventMask))) {
-                exitFlag = 1;
-
-                OsSchedTaskWake(resumedTask);
-            }
-            resumedTask = nextTask;
-        }
+    if (!LOS_ListEmpty(&eventCB->stEventList) && OsEventWakeList(eventCB, &eventCB->stEventList, events)) {
+        exitFlag = 1;
+    }
 
-        if (exitFlag == 1) {
-            LOS_IntRestore(intSave);
-            LOS_Schedule();
-            return LOS_OK;
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    /*
+     * A bucket waiter was not satisfied before this write, so it can only be satisfied now if the write set one of
+     * its bits. Buckets none of the written bits fold onto are skipped.
+     */
+    buckets = OsEventBucketMap(events);
+    while (buckets != 0) {
+        index = OsEventBucketIndex(buckets);
+        buckets &= ~(1U << index);
+        if (OsEventWakeList(eventCB, &eventCB->waitBucket[index], events)) {
+            exitFlag = 1;
         }
     }
+#endif
+
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    if (OsQueueSetNotify(eventCB->queueSet)) {
+        exitFlag = 1;
+    }
+#endif
+
+    if (exitFlag == 1) {
+        LOS_IntRestore(intSave);
+        LOS_Schedule();
+        return LOS_OK;
+    }
 
     LOS_IntRestore(intSave);
     return LOS_OK;
@@ -189,6 +269,10 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventWrite(PEVENT_CB_S eventCB, UINT32 events)
 LITE_OS_SEC_TEXT_INIT UINT32 LOS_EventDestroy(PEVENT_CB_S eventCB)
 {
     UINT32 intSave;
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    UINT32 index;
+#endif
+
     if (eventCB == NULL) {
         return LOS_ERRNO_EVENT_PTR_NULL;
     }
@@ -198,6 +282,22 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_EventDestroy(PEVENT_CB_S eventCB)
         LOS_IntRestore(intSave);
         return LOS_ERRNO_EVENT_SHOULD_NOT_DESTROYED;
     }
+
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    for (index = 0; index < LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS; index++) {
+        if (!LOS_ListEmpty(&eventCB->waitBucket[index])) {
+            LOS_IntRestore(intSave);
+            return LOS_ERRNO_EVENT_SHOULD_NOT_DESTROYED;
+        }
+    }
+#endif
+
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    if (eventCB->queueSet != NULL) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_EVENT_SHOULD_NOT_DESTROYED;
+    }
+#endif
     eventCB->stEventList.pstNext = (LOS_DL_LIST *)NULL;
     eventCB->stEventList.pstPrev = (LOS_DL_LIST *)NULL;
     LOS_IntRestore(intSave);
@@ -31,11 +31,14 @@
 
 #include "stdarg.h"
 #include "los_arch.h"
+#include "los_barrier.h"
+#include "los_condvar.h"
 #include "los_config.h"
 #include "los_debug.h"
 #include "los_memory.h"
 #include "los_mux.h"
 #include "los_queue.h"
+#include "los_rwlock.h"
 #include "los_sem.h"
 
 #if (LOSCFG_PLATFORM_HWI == 1)
@@ -165,6 +168,27 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
     }
 #endif
 
+#if (LOSCFG_BASE_IPC_CONDVAR == 1)
+    ret = OsCondVarInit();
+    if (ret != LOS_OK) {
+        return ret;
+    }
+#endif
+
+#if (LOSCFG_BASE_IPC_RWLOCK == 1)
+    ret = OsRwLockInit();
+    if (ret != LOS_OK) {
+        return ret;
+    }
+#endif
+
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+    ret = OsBarrierInit();
+    if (ret != LOS_OK) {
+        return ret;
+    }
+#endif
+
 #if (LOSCFG_BASE_IPC_QUEUE == 1)
     ret = OsQueueInit();
     if (ret != LOS_OK) {
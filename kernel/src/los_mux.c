@@ -83,6 +83,18 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsMuxInit(VOID)
  Return       : LOS_OK on success, or error code on failure
  *****************************************************************************/
 LITE_OS_SEC_TEXT_INIT UINT32 LOS_MuxCreate(UINT32 *muxHandle)
+{
+    return LOS_MuxCreateEx(muxHandle, NULL);
+}
+
+/*****************************************************************************
+ Function     : LOS_MuxCreateEx
+ Description  : Create a mutex with a priority protocol
+ Input        : attr      ------ Mutex attributes, NULL for priority inheritance
+ Output       : muxHandle ------ Mutex operation handle
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_MuxCreateEx(UINT32 *muxHandle, const LosMuxAttr *attr)
 {
     UINT32 intSave;
     LosMuxCB *muxCreated = NULL;
@@ -94,6 +106,11 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_MuxCreate(UINT32 *muxHandle)
         return LOS_ERRNO_MUX_PTR_NULL;
     }
 
+    if ((attr != NULL) && ((attr->protocol > LOS_MUX_PRIO_PROTECT) ||
+        ((attr->protocol == LOS_MUX_PRIO_PROTECT) && (attr->prioCeiling > OS_TASK_PRIORITY_LOWEST)))) {
+        return LOS_ERRNO_MUX_INVALID;
+    }
+
     intSave = LOS_IntLock();
     if (LOS_ListEmpty(&g_unusedMuxList)) {
         LOS_IntRestore(intSave);
@@ -107,6 +124,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_MuxCreate(UINT32 *muxHandle)
     muxCreated->muxStat = OS_MUX_USED;
     muxCreated->priority = 0;
     muxCreated->owner = (LosTaskCB *)NULL;
+    muxCreated->protocol = (attr != NULL) ? attr->protocol : LOS_MUX_PRIO_INHERIT;
+    muxCreated->prioCeiling = (attr != NULL) ? attr->prioCeiling : OS_TASK_PRIORITY_HIGHEST;
+    LOS_AtomicSet(&muxCreated->lockWord, OS_MUX_WORD_FREE);
     LOS_ListInit(&muxCreated->muxList);
     *muxHandle = (UINT32)muxCreated->muxID;
     LOS_IntRestore(intSave);
@@ -141,7 +161,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_MuxDelete(UINT32 muxHandle)
         OS_GOTO_ERR_HANDLER(LOS_ERRNO_MUX_INVALID);
     }
 
-    if ((!LOS_ListEmpty(&muxDeleted->muxList)) || muxDeleted->muxCount) {
+    if ((!LOS_ListEmpty(&muxDeleted->muxList)) || (muxDeleted->lockWord != OS_MUX_WORD_FREE)) {
         LOS_IntRestore(intSave);
         OS_GOTO_ERR_HANDLER(LOS_ERRNO_MUX_PENDED);
     }
@@ -175,6 +195,43 @@ STATIC_INLINE UINT32 OsMuxValidCheck(LosMuxCB *muxPended)
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function     : OsMuxSlowPathEnter
+ Description  : Publish muxCount, owner and priority from the owner word of a mutex held
+                once, so that the pend-list logic can work on it, with interrupts locked
+ Input        : mux ------ Mutex that is not free
+ Output       : None
+ Return       : None
+ *****************************************************************************/
+STATIC VOID OsMuxSlowPathEnter(LosMuxCB *mux)
+{
+    INT32 word = mux->lockWord;
+
+    if (word & OS_MUX_WORD_SLOW) {
+        return;
+    }
+
+    mux->owner = OS_TCB_FROM_TID(OS_MUX_WORD_TID(word));
+    mux->muxCount = 1;
+    /* The owner may be raised through another mutex by now, so use its priority from when it took this one. */
+    mux->priority = OS_MUX_WORD_PRIO(word);
+    mux->lockWord = word | OS_MUX_WORD_SLOW;
+}
+
+/*****************************************************************************
+ Function     : OsMuxCeilingRaise
+ Description  : Raise the owner of a priority-ceiling mutex to the ceiling, with interrupts locked
+ Input        : mux ------ Mutex that has just got a new owner
+ Output       : None
+ Return       : None
+ *****************************************************************************/
+STATIC INLINE VOID OsMuxCeilingRaise(const LosMuxCB *mux)
+{
+    if ((mux->protocol == LOS_MUX_PRIO_PROTECT) && (mux->owner->priority > mux->prioCeiling)) {
+        (VOID)OsSchedModifyTaskSchedParam(mux->owner, mux->prioCeiling);
+    }
+}
+
 /*****************************************************************************
  Function     : LOS_MuxPend
  Description  : Specify the mutex P operation
@@ -195,23 +252,49 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 muxHandle, UINT32 timeout)
     }
 
     muxPended = GET_MUX(muxHandle);
-    intSave = LOS_IntLock();
+    runningTask = (LosTaskCB *)g_losTask.runTask;
     retErr = OsMuxValidCheck(muxPended);
     if (retErr) {
+        OS_RETURN_ERROR(retErr);
+    }
+
+    /* Free mutex: take it with the owner word alone. A ceiling mutex must raise its owner, so it never does. */
+    if ((muxPended->protocol != LOS_MUX_PRIO_PROTECT) &&
+        !LOS_AtomicCmpXchg32bits(&muxPended->lockWord, OS_MUX_WORD(runningTask), OS_MUX_WORD_FREE)) {
+        /* The mutex was checked unlocked, it may have been deleted before the swap. */
+        if (muxPended->muxStat == OS_MUX_USED) {
+            goto HOOK;
+        }
+        /* Give the word back and let the slow path report the deleted mutex. */
+        (VOID)LOS_AtomicCmpXchg32bits(&muxPended->lockWord, OS_MUX_WORD_FREE, OS_MUX_WORD(runningTask));
+    }
+
+    intSave = LOS_IntLock();
+    if (muxPended->muxStat == OS_MUX_UNUSED) {
+        retErr = LOS_ERRNO_MUX_INVALID;
         goto ERROR_MUX_PEND;
     }
 
-    runningTask = (LosTaskCB *)g_losTask.runTask;
-    if (muxPended->muxCount == 0) {
-        muxPended->muxCount++;
-        muxPended->owner = runningTask;
-        muxPended->priority = runningTask->priority;
-        LOS_IntRestore(intSave);
-        goto HOOK;
+    if (muxPended->lockWord != OS_MUX_WORD_FREE) {
+        OsMuxSlowPathEnter(muxPended);
+        if (muxPended->owner == runningTask) {
+            muxPended->muxCount++;
+            LOS_IntRestore(intSave);
+            goto HOOK;
+        }
     }
 
-    if (muxPended->owner == runningTask) {
-        muxPended->muxCount++;
+    if ((muxPended->protocol == LOS_MUX_PRIO_PROTECT) && (runningTask->priority < muxPended->prioCeiling)) {
+        retErr = LOS_ERRNO_MUX_CEILING;
+        goto ERROR_MUX_PEND;
+    }
+
+    if (muxPended->lockWord == OS_MUX_WORD_FREE) {
+        muxPended->lockWord = OS_MUX_WORD(runningTask);
+        if (muxPended->protocol == LOS_MUX_PRIO_PROTECT) {
+            OsMuxSlowPathEnter(muxPended);
+            OsMuxCeilingRaise(muxPended);
+        }
         LOS_IntRestore(intSave);
         goto HOOK;
     }
@@ -223,7 +306,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 muxHandle, UINT32 timeout)
 
     runningTask->taskMux = (VOID *)muxPended;
 
-    if (muxPended->owner->priority > runningTask->priority) {
+    if ((muxPended->protocol == LOS_MUX_PRIO_INHERIT) && (muxPended->owner->priority > runningTask->priority)) {
         (VOID)OsSchedModifyTaskSchedParam(muxPended->owner, runningTask->priority);
     }
 
@@ -252,6 +335,102 @@ ERROR_MUX_PEND:
     OS_RETURN_ERROR(retErr);
 }
 
+/*****************************************************************************
+ Function     : OsMuxReleasePriGet
+ Description  : Work out the priority the owner of a mutex goes back to when releasing it, from the ceilings
+                of the mutexes it still holds, which may have been taken after this one, with interrupts locked
+ Input        : muxPosted ------ Mutex being released by its owner
+ Output       : None
+ Return       : The priority to go back to
+ *****************************************************************************/
+STATIC UINT16 OsMuxReleasePriGet(const LosMuxCB *muxPosted)
+{
+    const LosTaskCB *owner = muxPosted->owner;
+    LosMuxCB *mux = NULL;
+    UINT16 base = muxPosted->priority;
+    UINT16 priority;
+    UINT32 index;
+    INT32 word;
+
+    /* Taking a mutex can only raise the owner, so the one taken first saved the lowest priority of all. */
+    for (index = 0; index < LOSCFG_BASE_IPC_MUX_LIMIT; index++) {
+        mux = GET_MUX(index);
+        word = mux->lockWord;
+        if ((mux == muxPosted) || (mux->muxStat == OS_MUX_UNUSED) || (OsMuxOwnerGet(mux) != owner)) {
+            continue;
+        }
+        priority = (word & OS_MUX_WORD_SLOW) ? mux->priority : OS_MUX_WORD_PRIO(word);
+        base = (priority > base) ? priority : base;
+    }
+
+    /* The mutexes still held keep that priority to go back to, and their ceilings still apply. */
+    priority = base;
+    for (index = 0; index < LOSCFG_BASE_IPC_MUX_LIMIT; index++) {
+        mux = GET_MUX(index);
+        word = mux->lockWord;
+        if ((mux == muxPosted) || (mux->muxStat == OS_MUX_UNUSED) || (OsMuxOwnerGet(mux) != owner)) {
+            continue;
+        }
+        if (!(word & OS_MUX_WORD_SLOW)) {
+            mux->lockWord = (INT32)((((UINT32)base) << 16) | ((UINT32)word & 0xFFFFU)); /* 16: priority bits */
+            continue;
+        }
+        mux->priority = base;
+        if ((mux->protocol == LOS_MUX_PRIO_PROTECT) && (mux->prioCeiling < priority)) {
+            priority = mux->prioCeiling;
+        }
+    }
+    return priority;
+}
+
+/*****************************************************************************
+ Function     : OsMuxRelease
+ Description  : Give up a mutex whose lock count has dropped to zero, with interrupts locked
+ Input        : muxPosted ------ Mutex owned by the running task
+ Output       : None
+ Return       : TRUE if a waiting task took over the mutex or the owner's priority was lowered
+ *****************************************************************************/
+LITE_OS_SEC_TEXT BOOL OsMuxRelease(LosMuxCB *muxPosted)
+{
+    LosTaskCB *resumedTask = NULL;
+    BOOL needSched = FALSE;
+    UINT16 priority;
+
+    if (!(muxPosted->lockWord & OS_MUX_WORD_SLOW)) {
+        muxPosted->lockWord = OS_MUX_WORD_FREE;
+        return FALSE;
+    }
+
+    /*
+     * A lowered owner may now be below a ready task, e.g. after leaving a priority ceiling. Mutexes may be released
+     * in any order, so the owner goes back to what the ceilings it still holds allow.
+     */
+    if ((muxPosted->owner->priority) != muxPosted->priority) {
+        priority = OsMuxReleasePriGet(muxPosted);
+        if (muxPosted->owner->priority != priority) {
+            needSched = OsSchedModifyTaskSchedParam(muxPosted->owner, priority);
+        }
+    }
+
+    if (!LOS_ListEmpty(&muxPosted->muxList)) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&(muxPosted->muxList)));
+
+        muxPosted->muxCount = 1;
+        muxPosted->owner = resumedTask;
+        muxPosted->priority = resumedTask->priority;
+        muxPosted->lockWord = (INT32)((UINT32)OS_MUX_WORD(resumedTask) | (UINT32)OS_MUX_WORD_SLOW);
+        resumedTask->taskMux = NULL;
+        OsMuxCeilingRaise(muxPosted);
+
+        OsSchedTaskWake(resumedTask);
+        return TRUE;
+    }
+
+    muxPosted->owner = NULL;
+    muxPosted->lockWord = OS_MUX_WORD_FREE;
+    return needSched;
+}
+
 /*****************************************************************************
  Function     : LOS_MuxPost
  Description  : Specify the mutex V operation,
@@ -263,48 +442,50 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPost(UINT32 muxHandle)
 {
     UINT32 intSave;
     LosMuxCB *muxPosted = GET_MUX(muxHandle);
-    LosTaskCB *resumedTask = NULL;
-    LosTaskCB *runningTask = NULL;
+    LosTaskCB *runningTask = (LosTaskCB *)g_losTask.runTask;
+    INT32 word;
+
+    if (muxHandle >= (UINT32)LOSCFG_BASE_IPC_MUX_LIMIT) {
+        OS_RETURN_ERROR(LOS_ERRNO_MUX_INVALID);
+    }
+
+    /*
+     * Held once and uncontended: the owner word alone says so. The priority in the word is not compared, the
+     * owner may have been raised through another mutex meanwhile and must keep that.
+     */
+    word = LOS_AtomicRead(&muxPosted->lockWord);
+    if ((word != OS_MUX_WORD_FREE) && !(word & OS_MUX_WORD_SLOW) &&
+        (OS_MUX_WORD_TID(word) == runningTask->taskID) &&
+        !LOS_AtomicCmpXchg32bits(&muxPosted->lockWord, OS_MUX_WORD_FREE, word)) {
+        return LOS_OK;
+    }
 
     intSave = LOS_IntLock();
 
-    if ((muxHandle >= (UINT32)LOSCFG_BASE_IPC_MUX_LIMIT) ||
-        (muxPosted->muxStat == OS_MUX_UNUSED)) {
+    if (muxPosted->muxStat == OS_MUX_UNUSED) {
         LOS_IntRestore(intSave);
         OS_RETURN_ERROR(LOS_ERRNO_MUX_INVALID);
     }
 
-    runningTask = (LosTaskCB *)g_losTask.runTask;
-    if ((muxPosted->muxCount == 0) || (muxPosted->owner != runningTask)) {
+    if ((muxPosted->lockWord == OS_MUX_WORD_FREE) ||
+        (OS_MUX_WORD_TID(muxPosted->lockWord) != runningTask->taskID)) {
         LOS_IntRestore(intSave);
         OS_RETURN_ERROR(LOS_ERRNO_MUX_INVALID);
     }
 
+    OsMuxSlowPathEnter(muxPosted);
+
     if (--(muxPosted->muxCount) != 0) {
         LOS_IntRestore(intSave);
         OsHookCall(LOS_HOOK_TYPE_MUX_POST, muxPosted);
         return LOS_OK;
     }
 
-    if ((muxPosted->owner->priority) != muxPosted->priority) {
-        (VOID)OsSchedModifyTaskSchedParam(muxPosted->owner, muxPosted->priority);
-    }
-
-    if (!LOS_ListEmpty(&muxPosted->muxList)) {
-        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&(muxPosted->muxList)));
-
-        muxPosted->muxCount = 1;
-        muxPosted->owner = resumedTask;
-        muxPosted->priority = resumedTask->priority;
-        resumedTask->taskMux = NULL;
-
-        OsSchedTaskWake(resumedTask);
-
+    if (OsMuxRelease(muxPosted)) {
         LOS_IntRestore(intSave);
         OsHookCall(LOS_HOOK_TYPE_MUX_POST, muxPosted);
         LOS_Schedule();
     } else {
-        muxPosted->owner = NULL;
         LOS_IntRestore(intSave);
     }
 
@@ -39,6 +39,7 @@
 #include "los_memory.h"
 #include "los_task.h"
 #include "los_sched.h"
+#include "los_queueset.h"
 
 
 #if (LOSCFG_BASE_IPC_QUEUE == 1)
@@ -80,47 +81,21 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsQueueInit(VOID)
     return LOS_OK;
 }
 
-/*****************************************************************************
- Function    : LOS_QueueCreate
- Description : Create a queue
- Input       : queueName  --- Queue name, less than 4 characters
-             : len        --- Queue length
-             : flags      --- Queue type, FIFO or PRIO
-             : maxMsgSize --- Maximum message size in byte
- Output      : queueID    --- Queue ID
- Return      : LOS_OK on success or error code on failure
- *****************************************************************************/
-LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *queueName,
-                                             UINT16 len,
-                                             UINT32 *queueID,
-                                             UINT32 flags,
-                                             UINT16 maxMsgSize)
+/*
+ * Take a free control block and set it up for a queue of the specified type. For a fixed-size queue len is the
+ * number of nodes and memSize is len * msgSize, for a message buffer both len and memSize are the ring size in
+ * bytes. In both cases all of len is writable initially.
+ */
+STATIC UINT32 OsQueueCreate(UINT32 *queueID, UINT16 queueType, UINT16 len, UINT16 msgSize, UINT32 memSize)
 {
     LosQueueCB *queueCB = NULL;
     UINT32 intSave;
     LOS_DL_LIST *unusedQueue = NULL;
     UINT8 *queue = NULL;
-    UINT16 msgSize;
-
-    (VOID)queueName;
-    (VOID)flags;
-
-    if (queueID == NULL) {
-        return LOS_ERRNO_QUEUE_CREAT_PTR_NULL;
-    }
-
-    if (maxMsgSize > (OS_NULL_SHORT - sizeof(UINT32))) {
-        return LOS_ERRNO_QUEUE_SIZE_TOO_BIG;
-    }
-
-    if ((len == 0) || (maxMsgSize == 0)) {
-        return LOS_ERRNO_QUEUE_PARA_ISZERO;
-    }
-    msgSize = maxMsgSize + sizeof(UINT32);
 
     /* Memory allocation is time-consuming, to shorten the time of disable interrupt,
        move the memory allocation to here. */
-    queue = (UINT8 *)LOS_MemAlloc(m_aucSysMem0, len * msgSize);
+    queue = (UINT8 *)LOS_MemAllocHint(m_aucSysMem0, memSize, LOSCFG_QUEUE_MEM_HINT);
     if (queue == NULL) {
         return LOS_ERRNO_QUEUE_CREATE_NO_MEMORY;
     }
@@ -135,6 +110,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *queueName,
     unusedQueue = LOS_DL_LIST_FIRST(&(g_freeQueueList));
     LOS_ListDelete(unusedQueue);
     queueCB = (GET_QUEUE_LIST(unusedQueue));
+    queueCB->queueType = queueType;
     queueCB->queueLen = len;
     queueCB->queueSize = msgSize;
     queueCB->queue = queue;
@@ -146,6 +122,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *queueName,
     LOS_ListInit(&queueCB->readWriteList[OS_QUEUE_READ]);
     LOS_ListInit(&queueCB->readWriteList[OS_QUEUE_WRITE]);
     LOS_ListInit(&queueCB->memList);
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    queueCB->queueSet = NULL;
+#endif
     LOS_IntRestore(intSave);
 
     *queueID = queueCB->queueID;
@@ -155,6 +134,79 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *queueName,
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function    : LOS_QueueCreate
+ Description : Create a queue
+ Input       : queueName  --- Queue name, less than 4 characters
+             : len        --- Queue length
+             : flags      --- Queue type, FIFO or PRIO
+             : maxMsgSize --- Maximum message size in byte
+ Output      : queueID    --- Queue ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *queueName,
+                                             UINT16 len,
+                                             UINT32 *queueID,
+                                             UINT32 flags,
+                                             UINT16 maxMsgSize)
+{
+    UINT16 msgSize;
+
+    (VOID)queueName;
+    (VOID)flags;
+
+    if (queueID == NULL) {
+        return LOS_ERRNO_QUEUE_CREAT_PTR_NULL;
+    }
+
+    if (maxMsgSize > (OS_NULL_SHORT - sizeof(UINT32))) {
+        return LOS_ERRNO_QUEUE_SIZE_TOO_BIG;
+    }
+
+    if ((len == 0) || (maxMsgSize == 0)) {
+        return LOS_ERRNO_QUEUE_PARA_ISZERO;
+    }
+    msgSize = maxMsgSize + sizeof(UINT32);
+
+    return OsQueueCreate(queueID, OS_QUEUE_TYPE_FIXED, len, msgSize, (UINT32)len * msgSize);
+}
+
+/*****************************************************************************
+ Function    : LOS_QueueCreateMsgBuf
+ Description : Create a message buffer queue for variable-length messages
+ Input       : queueName  --- Queue name, less than 4 characters
+             : bufferSize --- Size of the message ring in byte
+             : flags      --- Queue type, FIFO or PRIO
+             : maxMsgSize --- Maximum message size in byte
+ Output      : queueID    --- Queue ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreateMsgBuf(CHAR *queueName,
+                                                   UINT16 bufferSize,
+                                                   UINT32 *queueID,
+                                                   UINT32 flags,
+                                                   UINT16 maxMsgSize)
+{
+    (VOID)queueName;
+    (VOID)flags;
+
+    if (queueID == NULL) {
+        return LOS_ERRNO_QUEUE_CREAT_PTR_NULL;
+    }
+
+    if ((bufferSize == 0) || (maxMsgSize == 0)) {
+        return LOS_ERRNO_QUEUE_PARA_ISZERO;
+    }
+
+    /* Every message must fit on its own, otherwise a writer of a big message could wait forever. */
+    if ((maxMsgSize > (OS_NULL_SHORT - sizeof(UINT32))) || (OS_QUEUE_MSGBUF_NODE_SIZE(maxMsgSize) > bufferSize)) {
+        return LOS_ERRNO_QUEUE_SIZE_TOO_BIG;
+    }
+
+    /* queueSize keeps the layout of fixed-size queues so that the maximum message size is derived the same way. */
+    return OsQueueCreate(queueID, OS_QUEUE_TYPE_MSGBUF, bufferSize, maxMsgSize + sizeof(UINT32), bufferSize);
+}
+
 static INLINE LITE_OS_SEC_TEXT UINT32 OsQueueReadParameterCheck(UINT32 queueID, VOID *bufferAddr,
                                                                 UINT32 *bufferSize, UINT32 timeOut)
 {
@@ -274,6 +326,205 @@ static INLINE UINT32 OsQueueOperateParamCheck(const LosQueueCB *queueCB, UINT32
     return LOS_OK;
 }
 
+STATIC INLINE UINT16 OsQueueMsgBufPos(const LosQueueCB *queueCB, UINT32 pos, UINT32 offset)
+{
+    pos += offset;
+    return (UINT16)((pos >= queueCB->queueLen) ? (pos - queueCB->queueLen) : pos);
+}
+
+STATIC VOID OsQueueMsgBufCopyIn(LosQueueCB *queueCB, UINT16 pos, const VOID *data, UINT32 size)
+{
+    UINT32 first = queueCB->queueLen - pos;
+
+    if (first > size) {
+        first = size;
+    }
+    (VOID)memcpy_s(queueCB->queue + pos, first, data, first);
+    if (size > first) {
+        (VOID)memcpy_s(queueCB->queue, size - first, (const UINT8 *)data + first, size - first);
+    }
+}
+
+STATIC VOID OsQueueMsgBufCopyOut(const LosQueueCB *queueCB, UINT16 pos, VOID *data, UINT32 size)
+{
+    UINT32 first = queueCB->queueLen - pos;
+
+    if (first > size) {
+        first = size;
+    }
+    (VOID)memcpy_s(data, first, queueCB->queue + pos, first);
+    if (size > first) {
+        (VOID)memcpy_s((UINT8 *)data + first, size - first, queueCB->queue, size - first);
+    }
+}
+
+/* Remove the message at the head of the ring and return the number of bytes it released. */
+STATIC UINT32 OsQueueMsgBufRead(LosQueueCB *queueCB, VOID *bufferAddr, UINT32 *bufferSize)
+{
+    UINT16 msgSize;
+
+    OsQueueMsgBufCopyOut(queueCB, queueCB->queueHead, &msgSize, OS_QUEUE_MSGBUF_HEAD_SIZE);
+    OsQueueMsgBufCopyOut(queueCB, OsQueueMsgBufPos(queueCB, queueCB->queueHead, OS_QUEUE_MSGBUF_HEAD_SIZE),
+                         bufferAddr, msgSize);
+    queueCB->queueHead = OsQueueMsgBufPos(queueCB, queueCB->queueHead, OS_QUEUE_MSGBUF_NODE_SIZE(msgSize));
+    *bufferSize = msgSize;
+
+    return OS_QUEUE_MSGBUF_NODE_SIZE(msgSize);
+}
+
+STATIC VOID OsQueueMsgBufWrite(LosQueueCB *queueCB, UINT32 operateType, const VOID *bufferAddr, UINT32 bufferSize)
+{
+    UINT16 msgSize = (UINT16)bufferSize;
+    UINT16 pos;
+
+    if (OS_QUEUE_OPERATE_GET(operateType) == OS_QUEUE_WRITE_HEAD) {
+        queueCB->queueHead = OsQueueMsgBufPos(queueCB, queueCB->queueHead,
+                                              queueCB->queueLen - OS_QUEUE_MSGBUF_NODE_SIZE(msgSize));
+        pos = queueCB->queueHead;
+    } else {
+        pos = queueCB->queueTail;
+        queueCB->queueTail = OsQueueMsgBufPos(queueCB, queueCB->queueTail, OS_QUEUE_MSGBUF_NODE_SIZE(msgSize));
+    }
+
+    OsQueueMsgBufCopyIn(queueCB, pos, &msgSize, OS_QUEUE_MSGBUF_HEAD_SIZE);
+    OsQueueMsgBufCopyIn(queueCB, OsQueueMsgBufPos(queueCB, pos, OS_QUEUE_MSGBUF_HEAD_SIZE), bufferAddr, msgSize);
+}
+
+/* Bytes held by the messages that are readable right now, walked from the head of the ring. */
+STATIC UINT32 OsQueueMsgBufUsedGet(const LosQueueCB *queueCB)
+{
+    UINT16 pos = queueCB->queueHead;
+    UINT16 msgSize;
+    UINT32 used = 0;
+    UINT32 index;
+
+    for (index = 0; index < queueCB->readWriteableCnt[OS_QUEUE_READ]; index++) {
+        OsQueueMsgBufCopyOut(queueCB, pos, &msgSize, OS_QUEUE_MSGBUF_HEAD_SIZE);
+        used += OS_QUEUE_MSGBUF_NODE_SIZE(msgSize);
+        pos = OsQueueMsgBufPos(queueCB, pos, OS_QUEUE_MSGBUF_NODE_SIZE(msgSize));
+    }
+
+    return used;
+}
+
+/* Publish a message just written to the ring: hand it to the first pending reader or count it as readable. */
+STATIC BOOL OsQueueMsgBufPost(LosQueueCB *queueCB)
+{
+    LosTaskCB *resumedTask = NULL;
+
+    if (!LOS_ListEmpty(&queueCB->readWriteList[OS_QUEUE_READ])) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&queueCB->readWriteList[OS_QUEUE_READ]));
+        OsSchedTaskWake(resumedTask);
+        return TRUE;
+    }
+
+    queueCB->readWriteableCnt[OS_QUEUE_READ]++;
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    return OsQueueSetNotify(queueCB->queueSet);
+#else
+    return FALSE;
+#endif
+}
+
+/*
+ * Hand free bytes over to the pending writers in FIFO order. A writer records in eventMask how many bytes its
+ * message needs, in eventMode its operate type and in msg its buffer. The message is copied into the ring here,
+ * while interrupts are still locked, so that the messages land in the order the writers queued up no matter in
+ * which order the woken writers run. The first writer that does not fit yet stops the hand-over.
+ */
+STATIC BOOL OsQueueMsgBufWakeWriters(LosQueueCB *queueCB)
+{
+    LosTaskCB *resumedTask = NULL;
+    BOOL needSched = FALSE;
+
+    while (!LOS_ListEmpty(&queueCB->readWriteList[OS_QUEUE_WRITE])) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&queueCB->readWriteList[OS_QUEUE_WRITE]));
+        if (resumedTask->eventMask > queueCB->readWriteableCnt[OS_QUEUE_WRITE]) {
+            break;
+        }
+        queueCB->readWriteableCnt[OS_QUEUE_WRITE] -= resumedTask->eventMask;
+        OsQueueMsgBufWrite(queueCB, resumedTask->eventMode, resumedTask->msg,
+                           resumedTask->eventMask - OS_QUEUE_MSGBUF_HEAD_SIZE);
+        resumedTask->msg = NULL;
+        OsSchedTaskWake(resumedTask);
+        (VOID)OsQueueMsgBufPost(queueCB);
+        needSched = TRUE;
+    }
+
+    return needSched;
+}
+
+/*
+ * Message buffer counterpart of OsQueueOperate, entered with interrupts locked by intSave.
+ * readWriteableCnt[OS_QUEUE_READ] counts the stored messages like for fixed-size queues, while
+ * readWriteableCnt[OS_QUEUE_WRITE] counts the free bytes of the ring. A reader that frees space passes it on to
+ * the writers waiting for it, a writer hands its message directly to the first waiting reader.
+ */
+STATIC UINT32 OsQueueMsgBufOperate(LosQueueCB *queueCB, UINT32 operateType, VOID *bufferAddr, UINT32 *bufferSize,
+                                   UINT32 timeOut, UINT32 intSave)
+{
+    UINT32 readWrite = OS_QUEUE_READ_WRITE_GET(operateType);
+    UINT32 need = OS_QUEUE_IS_READ(operateType) ? 1 : OS_QUEUE_MSGBUF_NODE_SIZE(*bufferSize);
+    UINT32 ret = LOS_OK;
+    BOOL needSched = FALSE;
+
+    if ((queueCB->readWriteableCnt[readWrite] < need) || !LOS_ListEmpty(&queueCB->readWriteList[readWrite])) {
+        if (timeOut == LOS_NO_WAIT) {
+            ret = OS_QUEUE_IS_READ(operateType) ? LOS_ERRNO_QUEUE_ISEMPTY : LOS_ERRNO_QUEUE_ISFULL;
+            goto QUEUE_END;
+        }
+
+        if (g_losTaskLock) {
+            ret = LOS_ERRNO_QUEUE_PEND_IN_LOCK;
+            goto QUEUE_END;
+        }
+
+        LosTaskCB *runTsk = (LosTaskCB *)g_losTask.runTask;
+        runTsk->eventMask = need;
+        if (OS_QUEUE_IS_WRITE(operateType)) {
+            runTsk->eventMode = operateType;
+            runTsk->msg = bufferAddr;
+        }
+        OsSchedTaskWait(&queueCB->readWriteList[readWrite], timeOut);
+        LOS_IntRestore(intSave);
+        LOS_Schedule();
+
+        intSave = LOS_IntLock();
+        if (runTsk->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+            runTsk->taskStatus &= ~OS_TASK_STATUS_TIMEOUT;
+            ret = LOS_ERRNO_QUEUE_TIMEOUT;
+            /* A writer that gives up may have held back smaller messages queued behind it. */
+            if (OS_QUEUE_IS_WRITE(operateType)) {
+                runTsk->msg = NULL;
+                needSched = OsQueueMsgBufWakeWriters(queueCB);
+            }
+            goto QUEUE_END;
+        }
+
+        /* The message of a woken writer was already copied in when its bytes were handed over. */
+        if (OS_QUEUE_IS_WRITE(operateType)) {
+            goto QUEUE_END;
+        }
+    } else {
+        queueCB->readWriteableCnt[readWrite] -= need;
+    }
+
+    if (OS_QUEUE_IS_READ(operateType)) {
+        queueCB->readWriteableCnt[OS_QUEUE_WRITE] += OsQueueMsgBufRead(queueCB, bufferAddr, bufferSize);
+        needSched = OsQueueMsgBufWakeWriters(queueCB);
+    } else {
+        OsQueueMsgBufWrite(queueCB, operateType, bufferAddr, *bufferSize);
+        needSched = OsQueueMsgBufPost(queueCB);
+    }
+
+QUEUE_END:
+    LOS_IntRestore(intSave);
+    if (needSched) {
+        LOS_Schedule();
+    }
+    return ret;
+}
+
 UINT32 OsQueueOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT32 *bufferSize, UINT32 timeOut)
 {
     LosQueueCB *queueCB = NULL;
@@ -290,6 +541,10 @@ UINT32 OsQueueOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT
         goto QUEUE_END;
     }
 
+    if (queueCB->queueType == OS_QUEUE_TYPE_MSGBUF) {
+        return OsQueueMsgBufOperate(queueCB, operateType, bufferAddr, bufferSize, timeOut, intSave);
+    }
+
     if (queueCB->readWriteableCnt[readWrite] == 0) {
         if (timeOut == LOS_NO_WAIT) {
             ret = OS_QUEUE_IS_READ(operateType) ? LOS_ERRNO_QUEUE_ISEMPTY : LOS_ERRNO_QUEUE_ISFULL;
@@ -327,6 +582,13 @@ UINT32 OsQueueOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT
         return LOS_OK;
     } else {
         queueCB->readWriteableCnt[readWriteTmp]++;
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+        if ((readWriteTmp == OS_QUEUE_READ) && OsQueueSetNotify(queueCB->queueSet)) {
+            LOS_IntRestore(intSave);
+            LOS_Schedule();
+            return LOS_OK;
+        }
+#endif
     }
 
 QUEUE_END:
@@ -334,6 +596,165 @@ QUEUE_END:
     return ret;
 }
 
+static INLINE LITE_OS_SEC_TEXT UINT32 OsQueueBatchParameterCheck(UINT32 queueID, const VOID *bufferAddr,
+                                                                 UINT32 msgSize, const UINT32 *msgCount,
+                                                                 UINT32 operateType, UINT32 timeOut)
+{
+    if (queueID >= LOSCFG_BASE_IPC_QUEUE_LIMIT) {
+        return LOS_ERRNO_QUEUE_INVALID;
+    }
+
+    if ((bufferAddr == NULL) || (msgCount == NULL)) {
+        return OS_QUEUE_IS_READ(operateType) ? LOS_ERRNO_QUEUE_READ_PTR_NULL : LOS_ERRNO_QUEUE_WRITE_PTR_NULL;
+    }
+
+    if (msgSize == 0) {
+        return OS_QUEUE_IS_READ(operateType) ? LOS_ERRNO_QUEUE_READSIZE_ISZERO : LOS_ERRNO_QUEUE_WRITESIZE_ISZERO;
+    }
+
+    if (*msgCount == 0) {
+        return LOS_ERRNO_QUEUE_BATCH_COUNT_ISZERO;
+    }
+
+    if ((timeOut != LOS_NO_WAIT) && OS_INT_ACTIVE) {
+        return OS_QUEUE_IS_READ(operateType) ? LOS_ERRNO_QUEUE_READ_IN_INTERRUPT : LOS_ERRNO_QUEUE_WRITE_IN_INTERRUPT;
+    }
+
+    return LOS_OK;
+}
+
+/*
+ * Move up to *msgCount messages of msgSize bytes between bufferAddr and the queue within a single critical
+ * section. The caller blocks only until the first message can be transferred, every other message is
+ * moved only if it is available right now. Tasks pending on the opposite side are woken once per batch:
+ * each moved message hands its node directly to one waiter, the rest is credited to readWriteableCnt.
+ */
+STATIC UINT32 OsQueueBatchOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT32 msgSize,
+                                  UINT32 *msgCount, UINT32 timeOut)
+{
+    LosQueueCB *queueCB = NULL;
+    LosTaskCB *resumedTask = NULL;
+    UINT32 ret;
+    UINT32 readWrite = OS_QUEUE_READ_WRITE_GET(operateType);
+    UINT32 readWriteTmp = !readWrite;
+    UINT32 count;
+    UINT32 avail;
+    UINT32 index;
+    UINT32 bufferSize;
+    BOOL needSched = FALSE;
+
+    UINT32 intSave = LOS_IntLock();
+
+    queueCB = (LosQueueCB *)GET_QUEUE_HANDLE(queueID);
+    ret = OsQueueOperateParamCheck(queueCB, operateType, &msgSize);
+    if (ret != LOS_OK) {
+        goto QUEUE_END;
+    }
+
+    if (queueCB->queueType == OS_QUEUE_TYPE_MSGBUF) {
+        ret = LOS_ERRNO_QUEUE_TYPE_UNSUPPORTED;
+        goto QUEUE_END;
+    }
+
+    if (queueCB->readWriteableCnt[readWrite] == 0) {
+        if (timeOut == LOS_NO_WAIT) {
+            ret = OS_QUEUE_IS_READ(operateType) ? LOS_ERRNO_QUEUE_ISEMPTY : LOS_ERRNO_QUEUE_ISFULL;
+            goto QUEUE_END;
+        }
+
+        if (g_losTaskLock) {
+            ret = LOS_ERRNO_QUEUE_PEND_IN_LOCK;
+            goto QUEUE_END;
+        }
+
+        LosTaskCB *runTsk = (LosTaskCB *)g_losTask.runTask;
+        OsSchedTaskWait(&queueCB->readWriteList[readWrite], timeOut);
+        LOS_IntRestore(intSave);
+        LOS_Schedule();
+
+        intSave = LOS_IntLock();
+        if (runTsk->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+            runTsk->taskStatus &= ~OS_TASK_STATUS_TIMEOUT;
+            ret = LOS_ERRNO_QUEUE_TIMEOUT;
+            goto QUEUE_END;
+        }
+        /* The waker has handed one node over to this task, the rest must be available now. */
+        count = 1;
+    } else {
+        count = 0;
+    }
+
+    avail = queueCB->readWriteableCnt[readWrite];
+    if (avail > (*msgCount - count)) {
+        avail = *msgCount - count;
+    }
+    queueCB->readWriteableCnt[readWrite] -= avail;
+    count += avail;
+
+    for (index = 0; index < count; index++) {
+        bufferSize = msgSize;
+        OsQueueBufferOperate(queueCB, operateType, (UINT8 *)bufferAddr + (index * msgSize), &bufferSize);
+    }
+    *msgCount = count;
+
+    while ((count > 0) && !LOS_ListEmpty(&queueCB->readWriteList[readWriteTmp])) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&queueCB->readWriteList[readWriteTmp]));
+        OsSchedTaskWake(resumedTask);
+        needSched = TRUE;
+        count--;
+    }
+    queueCB->readWriteableCnt[readWriteTmp] += count;
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    if ((readWriteTmp == OS_QUEUE_READ) && (count > 0) && OsQueueSetNotify(queueCB->queueSet)) {
+        needSched = TRUE;
+    }
+#endif
+
+    LOS_IntRestore(intSave);
+    if (needSched) {
+        LOS_Schedule();
+    }
+    return LOS_OK;
+
+QUEUE_END:
+    LOS_IntRestore(intSave);
+    return ret;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_QueueReadBatch(UINT32 queueID,
+                                           VOID *bufferAddr,
+                                           UINT32 msgSize,
+                                           UINT32 *msgCount,
+                                           UINT32 timeOut)
+{
+    UINT32 ret;
+    UINT32 operateType = OS_QUEUE_OPERATE_TYPE(OS_QUEUE_READ, OS_QUEUE_HEAD, OS_QUEUE_NOT_POINT);
+
+    ret = OsQueueBatchParameterCheck(queueID, bufferAddr, msgSize, msgCount, operateType, timeOut);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    return OsQueueBatchOperate(queueID, operateType, bufferAddr, msgSize, msgCount, timeOut);
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteBatch(UINT32 queueID,
+                                            VOID *bufferAddr,
+                                            UINT32 msgSize,
+                                            UINT32 *msgCount,
+                                            UINT32 timeOut)
+{
+    UINT32 ret;
+    UINT32 operateType = OS_QUEUE_OPERATE_TYPE(OS_QUEUE_WRITE, OS_QUEUE_TAIL, OS_QUEUE_NOT_POINT);
+
+    ret = OsQueueBatchParameterCheck(queueID, bufferAddr, msgSize, msgCount, operateType, timeOut);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    return OsQueueBatchOperate(queueID, operateType, bufferAddr, msgSize, msgCount, timeOut);
+}
+
 LITE_OS_SEC_TEXT UINT32 LOS_QueueReadCopy(UINT32 queueID,
                                           VOID *bufferAddr,
                                           UINT32 *bufferSize,
@@ -595,7 +1016,19 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueDelete(UINT32 queueID)
         goto QUEUE_END;
     }
 
-    if ((queueCB->readWriteableCnt[OS_QUEUE_WRITE] + queueCB->readWriteableCnt[OS_QUEUE_READ]) !=
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    if (queueCB->queueSet != NULL) {
+        ret = LOS_ERRNO_QUEUE_IN_TSKUSE;
+        goto QUEUE_END;
+    }
+#endif
+
+    if (queueCB->queueType == OS_QUEUE_TYPE_MSGBUF) {
+        if ((queueCB->readWriteableCnt[OS_QUEUE_WRITE] + OsQueueMsgBufUsedGet(queueCB)) != queueCB->queueLen) {
+            ret = LOS_ERRNO_QUEUE_IN_TSKWRITE;
+            goto QUEUE_END;
+        }
+    } else if ((queueCB->readWriteableCnt[OS_QUEUE_WRITE] + queueCB->readWriteableCnt[OS_QUEUE_READ]) !=
         queueCB->queueLen) {
         ret = LOS_ERRNO_QUEUE_IN_TSKWRITE;
         goto QUEUE_END;
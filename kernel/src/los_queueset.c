@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "los_queueset.h"
+#include "securec.h"
+#include "los_interrupt.h"
+#include "los_queue.h"
+#include "los_sem.h"
+#include "los_task.h"
+#include "los_tick.h"
+#include "los_sched.h"
+
+
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+
+/*
+ * Each member object points back to the queue set it belongs to. Whenever a member becomes ready without a task
+ * pending on the member itself taking the resource, its module calls OsQueueSetNotify, which wakes one task
+ * waiting on the set. The woken task scans the members again to find out which one is ready, so nothing is
+ * queued per notification and a member that is selected does not lose its message, count or events.
+ */
+
+#define OS_QUEUESET_NONE    0xFFFFFFFF
+
+/* Return the back pointer of the object described by type and handle, or NULL if the object is invalid. */
+STATIC VOID **OsQueueSetMemberLink(UINT32 type, UINTPTR handle)
+{
+    switch (type) {
+#if (LOSCFG_BASE_IPC_QUEUE == 1)
+        case LOS_QUEUESET_TYPE_QUEUE: {
+            LosQueueCB *queueCB = NULL;
+            if (handle >= LOSCFG_BASE_IPC_QUEUE_LIMIT) {
+                return NULL;
+            }
+            queueCB = GET_QUEUE_HANDLE(handle);
+            return (queueCB->queueState == OS_QUEUE_UNUSED) ? NULL : &queueCB->queueSet;
+        }
+#endif
+#if (LOSCFG_BASE_IPC_SEM == 1)
+        case LOS_QUEUESET_TYPE_SEM: {
+            LosSemCB *semCB = NULL;
+            if (handle >= LOSCFG_BASE_IPC_SEM_LIMIT) {
+                return NULL;
+            }
+            semCB = GET_SEM(handle);
+            return (semCB->semStat == OS_SEM_UNUSED) ? NULL : &semCB->queueSet;
+        }
+#endif
+        case LOS_QUEUESET_TYPE_EVENT: {
+            PEVENT_CB_S eventCB = (PEVENT_CB_S)handle;
+            if ((eventCB == NULL) || (eventCB->stEventList.pstNext == NULL)) {
+                return NULL;
+            }
+            return &eventCB->queueSet;
+        }
+        default:
+            return NULL;
+    }
+}
+
+STATIC BOOL OsQueueSetMemberReady(const QUEUESET_MEMBER_S *member)
+{
+    UINT32 events;
+
+    switch (member->type) {
+#if (LOSCFG_BASE_IPC_QUEUE == 1)
+        case LOS_QUEUESET_TYPE_QUEUE:
+            return (GET_QUEUE_HANDLE(member->handle)->readWriteableCnt[OS_QUEUE_READ] != 0);
+#endif
+#if (LOSCFG_BASE_IPC_SEM == 1)
+        case LOS_QUEUESET_TYPE_SEM:
+            return (GET_SEM(member->handle)->semCount != 0);
+#endif
+        case LOS_QUEUESET_TYPE_EVENT:
+            events = ((PEVENT_CB_S)member->handle)->uwEventID & member->eventMask;
+            if (member->eventMode & LOS_WAITMODE_OR) {
+                return (events != 0);
+            }
+            return (events == member->eventMask);
+        default:
+            return FALSE;
+    }
+}
+
+STATIC UINT32 OsQueueSetScan(QUEUESET_CB_S *queueSet)
+{
+    UINT32 count;
+    UINT32 index = queueSet->scanIndex;
+
+    for (count = 0; count < queueSet->memberCount; count++) {
+        if (index >= queueSet->memberCount) {
+            index = 0;
+        }
+        if (OsQueueSetMemberReady(&queueSet->member[index])) {
+            queueSet->scanIndex = index + 1;
+            return index;
+        }
+        index++;
+    }
+
+    return OS_QUEUESET_NONE;
+}
+
+STATIC UINT32 OsQueueSetFind(const QUEUESET_CB_S *queueSet, UINT32 type, UINTPTR handle)
+{
+    UINT32 index;
+
+    for (index = 0; index < queueSet->memberCount; index++) {
+        if ((queueSet->member[index].type == type) && (queueSet->member[index].handle == handle)) {
+            return index;
+        }
+    }
+
+    return OS_QUEUESET_NONE;
+}
+
+STATIC INLINE UINT32 OsQueueSetCheck(const QUEUESET_CB_S *queueSet)
+{
+    if (queueSet == NULL) {
+        return LOS_ERRNO_QUEUESET_PTR_NULL;
+    }
+
+    if ((queueSet->waitList.pstNext == NULL) || (queueSet->waitList.pstPrev == NULL)) {
+        return LOS_ERRNO_QUEUESET_NOT_INITIALIZED;
+    }
+
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueSetInit(QUEUESET_CB_S *queueSet)
+{
+    if (queueSet == NULL) {
+        return LOS_ERRNO_QUEUESET_PTR_NULL;
+    }
+
+    (VOID)memset_s(queueSet->member, sizeof(queueSet->member), 0, sizeof(queueSet->member));
+    queueSet->memberCount = 0;
+    queueSet->scanIndex = 0;
+    LOS_ListInit(&queueSet->waitList);
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueSetAdd(QUEUESET_CB_S *queueSet, const QUEUESET_MEMBER_S *member)
+{
+    VOID **link = NULL;
+    UINT32 intSave;
+    UINT32 ret;
+
+    ret = OsQueueSetCheck(queueSet);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    if (member == NULL) {
+        return LOS_ERRNO_QUEUESET_PTR_NULL;
+    }
+
+    if ((member->type == LOS_QUEUESET_TYPE_EVENT) &&
+        ((member->eventMask == 0) || (member->eventMask & LOS_ERRTYPE_ERROR) ||
+         !(member->eventMode & (LOS_WAITMODE_OR | LOS_WAITMODE_AND)) ||
+         ((member->eventMode & LOS_WAITMODE_OR) && (member->eventMode & LOS_WAITMODE_AND)))) {
+        return LOS_ERRNO_QUEUESET_MEMBER_INVALID;
+    }
+
+    intSave = LOS_IntLock();
+    link = OsQueueSetMemberLink(member->type, member->handle);
+    if (link == NULL) {
+        ret = LOS_ERRNO_QUEUESET_MEMBER_INVALID;
+    } else if (*link != NULL) {
+        ret = LOS_ERRNO_QUEUESET_MEMBER_IN_SET;
+    } else if (queueSet->memberCount >= LOSCFG_BASE_IPC_QUEUESET_MEMBER_LIMIT) {
+        ret = LOS_ERRNO_QUEUESET_MEMBER_FULL;
+    } else {
+        queueSet->member[queueSet->memberCount] = *member;
+        queueSet->memberCount++;
+        *link = (VOID *)queueSet;
+    }
+    LOS_IntRestore(intSave);
+
+    return ret;
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueSetRemove(QUEUESET_CB_S *queueSet, UINT32 type, UINTPTR handle)
+{
+    VOID **link = NULL;
+    UINT32 intSave;
+    UINT32 index;
+    UINT32 ret;
+
+    ret = OsQueueSetCheck(queueSet);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    intSave = LOS_IntLock();
+    index = OsQueueSetFind(queueSet, type, handle);
+    if (index == OS_QUEUESET_NONE) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_QUEUESET_MEMBER_NOT_FOUND;
+    }
+
+    link = OsQueueSetMemberLink(type, handle);
+    if ((link != NULL) && (*link == (VOID *)queueSet)) {
+        *link = NULL;
+    }
+
+    /* Keep the member array dense, the order only matters for the round robin scan. */
+    queueSet->memberCount--;
+    queueSet->member[index] = queueSet->member[queueSet->memberCount];
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_QueueSetSelect(QUEUESET_CB_S *queueSet, QUEUESET_MEMBER_S *ready, UINT32 timeOut)
+{
+    LosTaskCB *runTsk = NULL;
+    UINT64 endTick = 0;
+    UINT64 tick;
+    UINT32 intSave;
+    UINT32 index;
+    UINT32 ret;
+
+    ret = OsQueueSetCheck(queueSet);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    if (ready == NULL) {
+        return LOS_ERRNO_QUEUESET_PTR_NULL;
+    }
+
+    if ((timeOut != LOS_NO_WAIT) && OS_INT_ACTIVE) {
+        return LOS_ERRNO_QUEUESET_PEND_INTERR;
+    }
+
+    if ((timeOut != LOS_NO_WAIT) && (timeOut != LOS_WAIT_FOREVER)) {
+        endTick = LOS_TickCountGet() + timeOut;
+    }
+
+    intSave = LOS_IntLock();
+    while ((index = OsQueueSetScan(queueSet)) == OS_QUEUESET_NONE) {
+        if (timeOut == LOS_NO_WAIT) {
+            ret = LOS_ERRNO_QUEUESET_NOT_READY;
+            goto QUEUESET_END;
+        }
+
+        if (g_losTaskLock) {
+            ret = LOS_ERRNO_QUEUESET_PEND_IN_LOCK;
+            goto QUEUESET_END;
+        }
+
+        runTsk = (LosTaskCB *)g_losTask.runTask;
+        OsSchedTaskWait(&queueSet->waitList, timeOut);
+        LOS_IntRestore(intSave);
+        LOS_Schedule();
+
+        intSave = LOS_IntLock();
+        if (runTsk->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+            runTsk->taskStatus &= ~OS_TASK_STATUS_TIMEOUT;
+            ret = LOS_ERRNO_QUEUESET_TIMEOUT;
+            goto QUEUESET_END;
+        }
+
+        /* The ready member may have been taken by another task in the meantime, wait for what is left. */
+        if (timeOut != LOS_WAIT_FOREVER) {
+            tick = LOS_TickCountGet();
+            timeOut = (tick < endTick) ? (UINT32)(endTick - tick) : 1;
+        }
+    }
+
+    *ready = queueSet->member[index];
+
+QUEUESET_END:
+    LOS_IntRestore(intSave);
+    return ret;
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueSetDestroy(QUEUESET_CB_S *queueSet)
+{
+    VOID **link = NULL;
+    UINT32 intSave;
+    UINT32 index;
+    UINT32 ret;
+
+    ret = OsQueueSetCheck(queueSet);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    intSave = LOS_IntLock();
+    if (!LOS_ListEmpty(&queueSet->waitList)) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_QUEUESET_IN_USE;
+    }
+
+    for (index = 0; index < queueSet->memberCount; index++) {
+        link = OsQueueSetMemberLink(queueSet->member[index].type, queueSet->member[index].handle);
+        if ((link != NULL) && (*link == (VOID *)queueSet)) {
+            *link = NULL;
+        }
+    }
+    queueSet->memberCount = 0;
+    queueSet->waitList.pstNext = (LOS_DL_LIST *)NULL;
+    queueSet->waitList.pstPrev = (LOS_DL_LIST *)NULL;
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+BOOL OsQueueSetNotify(VOID *queueSet)
+{
+    QUEUESET_CB_S *set = (QUEUESET_CB_S *)queueSet;
+    LosTaskCB *resumedTask = NULL;
+
+    if ((set == NULL) || LOS_ListEmpty(&set->waitList)) {
+        return FALSE;
+    }
+
+    resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&set->waitList));
+    OsSchedTaskWake(resumedTask);
+    return TRUE;
+}
+
+#endif /* (LOSCFG_BASE_IPC_QUEUESET == 1) */
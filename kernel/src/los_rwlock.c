@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_rwlock.h"
+#include "los_config.h"
+#include "los_debug.h"
+#include "los_interrupt.h"
+#include "los_memory.h"
+#include "los_sched.h"
+
+
+#if (LOSCFG_BASE_IPC_RWLOCK == 1)
+
+LITE_OS_SEC_BSS       LosRwLockCB *g_allRwLock = NULL;
+LITE_OS_SEC_DATA_INIT LOS_DL_LIST g_unusedRwLockList;
+
+/*****************************************************************************
+ Function     : OsRwLockInit
+ Description  : Initializes the reader-writer locks
+ Input        : None
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 OsRwLockInit(VOID)
+{
+    LosRwLockCB *rwlockNode = NULL;
+    UINT32 index;
+
+    LOS_ListInit(&g_unusedRwLockList);
+
+    if (LOSCFG_BASE_IPC_RWLOCK_LIMIT == 0) {
+        return LOS_ERRNO_RWLOCK_MAXNUM_ZERO;
+    }
+
+    g_allRwLock = (LosRwLockCB *)LOS_MemAlloc(m_aucSysMem0, (LOSCFG_BASE_IPC_RWLOCK_LIMIT * sizeof(LosRwLockCB)));
+    if (g_allRwLock == NULL) {
+        return LOS_ERRNO_RWLOCK_NO_MEMORY;
+    }
+
+    for (index = 0; index < LOSCFG_BASE_IPC_RWLOCK_LIMIT; index++) {
+        rwlockNode = ((LosRwLockCB *)g_allRwLock) + index;
+        rwlockNode->rwlockID = index;
+        rwlockNode->rwlockStat = OS_RWLOCK_UNUSED;
+        LOS_ListTailInsert(&g_unusedRwLockList, &rwlockNode->readList);
+    }
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function     : LOS_RwLockCreate
+ Description  : Create a reader-writer lock
+ Input        : flags    ------ LOS_RWLOCK_PREFER_READER or LOS_RWLOCK_PREFER_WRITER
+ Output       : rwlockID ------ Reader-writer lock handle
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_RwLockCreate(UINT32 *rwlockID, UINT32 flags)
+{
+    UINT32 intSave;
+    LosRwLockCB *rwlockCreated = NULL;
+    LOS_DL_LIST *unusedRwLock = NULL;
+    UINT32 errNo;
+    UINT32 errLine;
+
+    if (rwlockID == NULL) {
+        return LOS_ERRNO_RWLOCK_PTR_NULL;
+    }
+
+    if ((flags & ~LOS_RWLOCK_PREFER_WRITER) != 0) {
+        return LOS_ERRNO_RWLOCK_INVALID;
+    }
+
+    intSave = LOS_IntLock();
+    if (LOS_ListEmpty(&g_unusedRwLockList)) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_RWLOCK_ALL_BUSY);
+    }
+
+    unusedRwLock = LOS_DL_LIST_FIRST(&g_unusedRwLockList);
+    LOS_ListDelete(unusedRwLock);
+    rwlockCreated = GET_RWLOCK_LIST(unusedRwLock);
+    rwlockCreated->rwlockStat = OS_RWLOCK_USED;
+    rwlockCreated->flags = (UINT8)flags;
+    rwlockCreated->readCount = 0;
+    rwlockCreated->writer = NULL;
+    rwlockCreated->priority = 0;
+    LOS_ListInit(&rwlockCreated->readList);
+    LOS_ListInit(&rwlockCreated->writeList);
+    *rwlockID = rwlockCreated->rwlockID;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+ERR_HANDLER:
+    OS_RETURN_ERROR_P2(errLine, errNo);
+}
+
+/*****************************************************************************
+ Function     : LOS_RwLockDelete
+ Description  : Delete a reader-writer lock
+ Input        : rwlockID ------ Reader-writer lock handle
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_RwLockDelete(UINT32 rwlockID)
+{
+    UINT32 intSave;
+    LosRwLockCB *rwlockDeleted = NULL;
+    UINT32 errNo;
+    UINT32 errLine;
+
+    if (rwlockID >= (UINT32)LOSCFG_BASE_IPC_RWLOCK_LIMIT) {
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_RWLOCK_INVALID);
+    }
+
+    rwlockDeleted = GET_RWLOCK(rwlockID);
+    intSave = LOS_IntLock();
+    if (rwlockDeleted->rwlockStat == OS_RWLOCK_UNUSED) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_RWLOCK_INVALID);
+    }
+
+    if ((rwlockDeleted->writer != NULL) || (rwlockDeleted->readCount != 0) ||
+        !LOS_ListEmpty(&rwlockDeleted->readList) || !LOS_ListEmpty(&rwlockDeleted->writeList)) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_RWLOCK_PENDED);
+    }
+
+    LOS_ListAdd(&g_unusedRwLockList, &rwlockDeleted->readList);
+    rwlockDeleted->rwlockStat = OS_RWLOCK_UNUSED;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+ERR_HANDLER:
+    OS_RETURN_ERROR_P2(errLine, errNo);
+}
+
+STATIC_INLINE UINT32 OsRwLockValidCheck(const LosRwLockCB *rwlock)
+{
+    if (rwlock->rwlockStat == OS_RWLOCK_UNUSED) {
+        return LOS_ERRNO_RWLOCK_INVALID;
+    }
+
+    if (OS_INT_ACTIVE) {
+        return LOS_ERRNO_RWLOCK_PEND_INTERR;
+    }
+
+    return LOS_OK;
+}
+
+/* The slot holding the read locks of task on rwlock, else a free slot, else NULL. */
+STATIC LosRwLockRead *OsRwLockReadSlotGet(LosTaskCB *task, const LosRwLockCB *rwlock)
+{
+    LosRwLockRead *freeSlot = NULL;
+    UINT32 index;
+
+    for (index = 0; index < LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT; index++) {
+        if (task->rwlockRead[index].count == 0) {
+            freeSlot = (freeSlot == NULL) ? &task->rwlockRead[index] : freeSlot;
+        } else if (task->rwlockRead[index].rwlockID == rwlock->rwlockID) {
+            return &task->rwlockRead[index];
+        }
+    }
+    return freeSlot;
+}
+
+/* The caller has checked there is a slot, and a waiting reader cannot take other locks before it is woken. */
+STATIC VOID OsRwLockReadTake(LosRwLockCB *rwlock, LosTaskCB *task)
+{
+    LosRwLockRead *slot = OsRwLockReadSlotGet(task, rwlock);
+
+    slot->rwlockID = (UINT16)rwlock->rwlockID;
+    slot->count++;
+    rwlock->readCount++;
+}
+
+STATIC BOOL OsRwLockWakeReaders(LosRwLockCB *rwlock)
+{
+    LosTaskCB *resumedTask = NULL;
+
+    if (LOS_ListEmpty(&rwlock->readList)) {
+        return FALSE;
+    }
+
+    while (!LOS_ListEmpty(&rwlock->readList)) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&rwlock->readList));
+        OsRwLockReadTake(rwlock, resumedTask);
+        OsSchedTaskWake(resumedTask);
+    }
+    return TRUE;
+}
+
+STATIC BOOL OsRwLockWakeWriter(LosRwLockCB *rwlock)
+{
+    LosTaskCB *resumedTask = NULL;
+
+    if (LOS_ListEmpty(&rwlock->writeList)) {
+        return FALSE;
+    }
+
+    resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&rwlock->writeList));
+    rwlock->writer = resumedTask;
+    rwlock->priority = resumedTask->priority;
+    OsSchedTaskWake(resumedTask);
+    return TRUE;
+}
+
+/*
+ * Hand the lock to the waiting tasks that may take it now. The woken tasks own the lock when they resume.
+ * Returns TRUE if any task was woken.
+ */
+STATIC BOOL OsRwLockHandOff(LosRwLockCB *rwlock)
+{
+    if (rwlock->writer != NULL) {
+        return FALSE;
+    }
+
+    if (rwlock->readCount != 0) {
+        /* Readers only queue behind a read-held lock for a waiting writer, which may have timed out. */
+        if (LOS_ListEmpty(&rwlock->writeList)) {
+            return OsRwLockWakeReaders(rwlock);
+        }
+        return FALSE;
+    }
+
+    if (((rwlock->flags & LOS_RWLOCK_PREFER_WRITER) || LOS_ListEmpty(&rwlock->readList)) &&
+        OsRwLockWakeWriter(rwlock)) {
+        return TRUE;
+    }
+    return OsRwLockWakeReaders(rwlock);
+}
+
+/* Take back the boost a waiter that gave up gave the writer, keeping the boost of the tasks still waiting. */
+STATIC VOID OsRwLockWriterPriRestore(const LosRwLockCB *rwlock, const LosTaskCB *waiter)
+{
+    LosTaskCB *pendedTask = NULL;
+    UINT16 priority = rwlock->priority;
+
+    if ((rwlock->writer == NULL) || (rwlock->writer->priority != waiter->priority) ||
+        (rwlock->writer->priority == rwlock->priority)) {
+        return;
+    }
+
+    LOS_DL_LIST_FOR_EACH_ENTRY(pendedTask, &rwlock->readList, LosTaskCB, pendList) {
+        if (pendedTask->priority < priority) {
+            priority = pendedTask->priority;
+        }
+    }
+    LOS_DL_LIST_FOR_EACH_ENTRY(pendedTask, &rwlock->writeList, LosTaskCB, pendList) {
+        if (pendedTask->priority < priority) {
+            priority = pendedTask->priority;
+        }
+    }
+    (VOID)OsSchedModifyTaskSchedParam(rwlock->writer, priority);
+}
+
+STATIC UINT32 OsRwLockWait(LosRwLockCB *rwlock, LOS_DL_LIST *list, UINT32 timeout, UINT32 intSave)
+{
+    LosTaskCB *runningTask = g_losTask.runTask;
+
+    if (timeout == 0) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_RWLOCK_UNAVAILABLE;
+    }
+
+    if (g_losTaskLock) {
+        LOS_IntRestore(intSave);
+        PRINT_ERR("!!!LOS_ERRNO_RWLOCK_PEND_IN_LOCK!!!\n");
+        return LOS_ERRNO_RWLOCK_PEND_IN_LOCK;
+    }
+
+    /* Readers are only known to their own tasks, so priority inheritance only raises a writer holding the lock. */
+    if ((rwlock->writer != NULL) && (rwlock->writer->priority > runningTask->priority)) {
+        (VOID)OsSchedModifyTaskSchedParam(rwlock->writer, runningTask->priority);
+    }
+
+    OsSchedTaskWait(list, timeout);
+    LOS_IntRestore(intSave);
+    LOS_Schedule();
+
+    intSave = LOS_IntLock();
+    if (runningTask->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+        runningTask->taskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+        OsRwLockWriterPriRestore(rwlock, runningTask);
+        if (OsRwLockHandOff(rwlock)) {
+            LOS_IntRestore(intSave);
+            LOS_Schedule();
+        } else {
+            LOS_IntRestore(intSave);
+        }
+        return LOS_ERRNO_RWLOCK_TIMEOUT;
+    }
+
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function     : LOS_RwLockRdLock
+ Description  : Take a reader-writer lock for reading
+ Input        : rwlockID ------ Reader-writer lock handle
+              : timeout  ------ Waiting time
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_RwLockRdLock(UINT32 rwlockID, UINT32 timeout)
+{
+    UINT32 intSave;
+    LosRwLockCB *rwlock = NULL;
+    UINT32 retErr;
+
+    if (rwlockID >= (UINT32)LOSCFG_BASE_IPC_RWLOCK_LIMIT) {
+        OS_RETURN_ERROR(LOS_ERRNO_RWLOCK_INVALID);
+    }
+
+    rwlock = GET_RWLOCK(rwlockID);
+    intSave = LOS_IntLock();
+    retErr = OsRwLockValidCheck(rwlock);
+    if (retErr != LOS_OK) {
+        goto ERROR_RWLOCK_PEND;
+    }
+
+    if (rwlock->writer == g_losTask.runTask) {
+        retErr = LOS_ERRNO_RWLOCK_DEADLOCK;
+        goto ERROR_RWLOCK_PEND;
+    }
+
+    if (OsRwLockReadSlotGet(g_losTask.runTask, rwlock) == NULL) {
+        retErr = LOS_ERRNO_RWLOCK_READ_FULL;
+        goto ERROR_RWLOCK_PEND;
+    }
+
+    /* With writer preference, a waiting writer holds back new readers. */
+    if ((rwlock->writer == NULL) && (rwlock->readCount < OS_NULL_SHORT) &&
+        (!(rwlock->flags & LOS_RWLOCK_PREFER_WRITER) || LOS_ListEmpty(&rwlock->writeList))) {
+        OsRwLockReadTake(rwlock, g_losTask.runTask);
+        LOS_IntRestore(intSave);
+        return LOS_OK;
+    }
+
+    retErr = OsRwLockWait(rwlock, &rwlock->readList, timeout, intSave);
+    if (retErr != LOS_OK) {
+        OS_RETURN_ERROR(retErr);
+    }
+    return LOS_OK;
+
+ERROR_RWLOCK_PEND:
+    LOS_IntRestore(intSave);
+    OS_RETURN_ERROR(retErr);
+}
+
+/*****************************************************************************
+ Function     : LOS_RwLockWrLock
+ Description  : Take a reader-writer lock for writing
+ Input        : rwlockID ------ Reader-writer lock handle
+              : timeout  ------ Waiting time
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_RwLockWrLock(UINT32 rwlockID, UINT32 timeout)
+{
+    UINT32 intSave;
+    LosRwLockCB *rwlock = NULL;
+    LosTaskCB *runningTask = NULL;
+    UINT32 retErr;
+
+    if (rwlockID >= (UINT32)LOSCFG_BASE_IPC_RWLOCK_LIMIT) {
+        OS_RETURN_ERROR(LOS_ERRNO_RWLOCK_INVALID);
+    }
+
+    rwlock = GET_RWLOCK(rwlockID);
+    intSave = LOS_IntLock();
+    retErr = OsRwLockValidCheck(rwlock);
+    if (retErr != LOS_OK) {
+        goto ERROR_RWLOCK_PEND;
+    }
+
+    runningTask = g_losTask.runTask;
+    if (rwlock->writer == runningTask) {
+        retErr = LOS_ERRNO_RWLOCK_DEADLOCK;
+        goto ERROR_RWLOCK_PEND;
+    }
+
+    if ((rwlock->writer == NULL) && (rwlock->readCount == 0)) {
+        rwlock->writer = runningTask;
+        rwlock->priority = runningTask->priority;
+        LOS_IntRestore(intSave);
+        return LOS_OK;
+    }
+
+    retErr = OsRwLockWait(rwlock, &rwlock->writeList, timeout, intSave);
+    if (retErr != LOS_OK) {
+        OS_RETURN_ERROR(retErr);
+    }
+    return LOS_OK;
+
+ERROR_RWLOCK_PEND:
+    LOS_IntRestore(intSave);
+    OS_RETURN_ERROR(retErr);
+}
+
+/*****************************************************************************
+ Function     : LOS_RwLockUnlock
+ Description  : Release a reader-writer lock
+ Input        : rwlockID ------ Reader-writer lock handle
+ Output       : None
+ Return       : LOS_OK on success, or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_RwLockUnlock(UINT32 rwlockID)
+{
+    UINT32 intSave;
+    LosRwLockCB *rwlock = NULL;
+    LosTaskCB *runningTask = NULL;
+    LosRwLockRead *slot = NULL;
+
+    if (rwlockID >= (UINT32)LOSCFG_BASE_IPC_RWLOCK_LIMIT) {
+        OS_RETURN_ERROR(LOS_ERRNO_RWLOCK_INVALID);
+    }
+
+    if (OS_INT_ACTIVE) {
+        OS_RETURN_ERROR(LOS_ERRNO_RWLOCK_PEND_INTERR);
+    }
+
+    rwlock = GET_RWLOCK(rwlockID);
+    intSave = LOS_IntLock();
+    if (rwlock->rwlockStat == OS_RWLOCK_UNUSED) {
+        LOS_IntRestore(intSave);
+        OS_RETURN_ERROR(LOS_ERRNO_RWLOCK_INVALID);
+    }
+
+    runningTask = g_losTask.runTask;
+    slot = OsRwLockReadSlotGet(runningTask, rwlock);
+    if (rwlock->writer == runningTask) {
+        if (runningTask->priority != rwlock->priority) {
+            (VOID)OsSchedModifyTaskSchedParam(runningTask, rwlock->priority);
+        }
+        rwlock->writer = NULL;
+    } else if ((rwlock->writer == NULL) && (slot != NULL) && (slot->count != 0)) {
+        rwlock->readCount--;
+        slot->count--;
+    } else {
+        LOS_IntRestore(intSave);
+        OS_RETURN_ERROR(LOS_ERRNO_RWLOCK_INVALID);
+    }
+
+    if (OsRwLockHandOff(rwlock)) {
+        LOS_IntRestore(intSave);
+        LOS_Schedule();
+        return LOS_OK;
+    }
+
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+#endif /* (LOSCFG_BASE_IPC_RWLOCK == 1) */
@@ -36,6 +36,7 @@
 #include "los_interrupt.h"
 #include "los_memory.h"
 #include "los_sched.h"
+#include "los_queueset.h"
 
 
 #if (LOSCFG_BASE_IPC_SEM == 1)
@@ -114,6 +115,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsSemCreate(UINT16 count, UINT16 maxCount, UINT32 *
     semCreated->semStat = OS_SEM_USED;
     semCreated->maxSemCount = maxCount;
     LOS_ListInit(&semCreated->semList);
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    semCreated->queueSet = NULL;
+#endif
     *semHandle = (UINT32)semCreated->semID;
     LOS_IntRestore(intSave);
     OsHookCall(LOS_HOOK_TYPE_SEM_CREATE, semCreated);
@@ -177,6 +181,13 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_SemDelete(UINT32 semHandle)
         OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_PENDED);
     }
 
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    if (semDeleted->queueSet != NULL) {
+        LOS_IntRestore(intSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_PENDED);
+    }
+#endif
+
     LOS_ListAdd(&g_unusedSemList, &semDeleted->semList);
     semDeleted->semStat = OS_SEM_UNUSED;
     LOS_IntRestore(intSave);
@@ -206,19 +217,62 @@ STATIC_INLINE UINT32 OsSemValidCheck(LosSemCB *semPended)
 }
 
 /*****************************************************************************
- Function     : LOS_SemPend
- Description  : Specified semaphore P operation
+ Function     : OsSemWakePending
+ Description  : Hand the available units to the waiters at the head of the queue,
+                in FIFO order, until the first one that cannot be satisfied
+ Input        : semCB --------- semaphore control block, interrupts locked
+ Output       : None
+ Return       : The last task that has been woken up, or NULL if none
+ *****************************************************************************/
+STATIC LosTaskCB *OsSemWakePending(LosSemCB *semCB)
+{
+    LosTaskCB *resumedTask = NULL;
+    LosTaskCB *lastTask = NULL;
+
+    while (!LOS_ListEmpty(&semCB->semList)) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&(semCB->semList)));
+        if (resumedTask->semPendCount > semCB->semCount) {
+            break;
+        }
+
+        semCB->semCount -= (UINT16)resumedTask->semPendCount;
+        resumedTask->taskSem = NULL;
+        OsSchedTaskWake(resumedTask);
+        lastTask = resumedTask;
+    }
+
+    return lastTask;
+}
+
+/*****************************************************************************
+ Function     : OsSemWaiterLeft
+ Description  : Hand on the units reserved for a waiter that has left the queue
+                without being woken up, e.g. because it was deleted
+ Input        : semCB --------- semaphore control block, interrupts locked
+ Output       : None
+ Return       : TRUE if a waiter has been woken up
+ *****************************************************************************/
+LITE_OS_SEC_TEXT BOOL OsSemWaiterLeft(LosSemCB *semCB)
+{
+    return (OsSemWakePending(semCB) != NULL);
+}
+
+/*****************************************************************************
+ Function     : LOS_SemPendN
+ Description  : Specified semaphore P operation taking several units at once
  Input        : semHandle --------- semaphore operation handle
+              : count     --------- number of units to take
               : timeout   --------- waitting time
  Output       : None
  Return       : LOS_OK on success or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
+LITE_OS_SEC_TEXT UINT32 LOS_SemPendN(UINT32 semHandle, UINT16 count, UINT32 timeout)
 {
     UINT32 intSave;
     LosSemCB *semPended = NULL;
     UINT32 retErr;
     LosTaskCB *runningTask = NULL;
+    LosTaskCB *resumedTask = NULL;
 
     if (semHandle >= (UINT32)LOSCFG_BASE_IPC_SEM_LIMIT) {
         OS_RETURN_ERROR(LOS_ERRNO_SEM_INVALID);
@@ -232,8 +286,14 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
         goto ERROR_SEM_PEND;
     }
 
-    if (semPended->semCount > 0) {
-        semPended->semCount--;
+    if ((count == 0) || (count > semPended->maxSemCount)) {
+        retErr = LOS_ERRNO_SEM_COUNT_INVALID;
+        goto ERROR_SEM_PEND;
+    }
+
+    /* Units left over while others wait are reserved for the head of the queue. */
+    if ((semPended->semCount >= count) && LOS_ListEmpty(&semPended->semList)) {
+        semPended->semCount -= count;
         LOS_IntRestore(intSave);
         OsHookCall(LOS_HOOK_TYPE_SEM_PEND, semPended, runningTask, timeout);
         return LOS_OK;
@@ -246,6 +306,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
 
     runningTask = (LosTaskCB *)g_losTask.runTask;
     runningTask->taskSem = (VOID *)semPended;
+    runningTask->semPendCount = count;
     OsSchedTaskWait(&semPended->semList, timeout);
     LOS_IntRestore(intSave);
     OsHookCall(LOS_HOOK_TYPE_SEM_PEND, semPended, runningTask, timeout);
@@ -254,8 +315,14 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
     intSave = LOS_IntLock();
     if (runningTask->taskStatus & OS_TASK_STATUS_TIMEOUT) {
         runningTask->taskStatus &= (~OS_TASK_STATUS_TIMEOUT);
-        retErr = LOS_ERRNO_SEM_TIMEOUT;
-        goto ERROR_SEM_PEND;
+        runningTask->taskSem = NULL;
+        /* A large request timing out at the head may unblock the smaller ones behind it. */
+        resumedTask = OsSemWakePending(semPended);
+        LOS_IntRestore(intSave);
+        if (resumedTask != NULL) {
+            LOS_Schedule();
+        }
+        OS_RETURN_ERROR(LOS_ERRNO_SEM_TIMEOUT);
     }
 
     LOS_IntRestore(intSave);
@@ -267,13 +334,27 @@ ERROR_SEM_PEND:
 }
 
 /*****************************************************************************
- Function     : LOS_SemPost
- Description  : Specified semaphore V operation
+ Function     : LOS_SemPend
+ Description  : Specified semaphore P operation
+ Input        : semHandle --------- semaphore operation handle
+              : timeout   --------- waitting time
+ Output       : None
+ Return       : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
+{
+    return LOS_SemPendN(semHandle, 1, timeout);
+}
+
+/*****************************************************************************
+ Function     : LOS_SemPostN
+ Description  : Specified semaphore V operation giving several units at once
  Input        : semHandle--------- semaphore operation handle
+              : count    --------- number of units to give
  Output       : None
  Return       : LOS_OK on success or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT UINT32 LOS_SemPost(UINT32 semHandle)
+LITE_OS_SEC_TEXT UINT32 LOS_SemPostN(UINT32 semHandle, UINT16 count)
 {
     UINT32 intSave;
     LosSemCB *semPosted = GET_SEM(semHandle);
@@ -283,6 +364,10 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPost(UINT32 semHandle)
         return LOS_ERRNO_SEM_INVALID;
     }
 
+    if (count == 0) {
+        OS_RETURN_ERROR(LOS_ERRNO_SEM_COUNT_INVALID);
+    }
+
     intSave = LOS_IntLock();
 
     if (semPosted->semStat == OS_SEM_UNUSED) {
@@ -290,27 +375,45 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPost(UINT32 semHandle)
         OS_RETURN_ERROR(LOS_ERRNO_SEM_INVALID);
     }
 
-    if (semPosted->maxSemCount == semPosted->semCount) {
+    if (count > (semPosted->maxSemCount - semPosted->semCount)) {
         LOS_IntRestore(intSave);
         OS_RETURN_ERROR(LOS_ERRNO_SEM_OVERFLOW);
     }
-    if (!LOS_ListEmpty(&semPosted->semList)) {
-        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&(semPosted->semList)));
-        resumedTask->taskSem = NULL;
-        OsSchedTaskWake(resumedTask);
 
+    semPosted->semCount += count;
+    resumedTask = OsSemWakePending(semPosted);
+    if (resumedTask != NULL) {
         LOS_IntRestore(intSave);
         OsHookCall(LOS_HOOK_TYPE_SEM_POST, semPosted, resumedTask);
         LOS_Schedule();
-    } else {
-        semPosted->semCount++;
+        return LOS_OK;
+    }
+
+#if (LOSCFG_BASE_IPC_QUEUESET == 1)
+    if (LOS_ListEmpty(&semPosted->semList) && OsQueueSetNotify(semPosted->queueSet)) {
         LOS_IntRestore(intSave);
         OsHookCall(LOS_HOOK_TYPE_SEM_POST, semPosted, resumedTask);
+        LOS_Schedule();
+        return LOS_OK;
     }
-
+#endif
+    LOS_IntRestore(intSave);
+    OsHookCall(LOS_HOOK_TYPE_SEM_POST, semPosted, resumedTask);
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function     : LOS_SemPost
+ Description  : Specified semaphore V operation
+ Input        : semHandle--------- semaphore operation handle
+ Output       : None
+ Return       : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_SemPost(UINT32 semHandle)
+{
+    return LOS_SemPostN(semHandle, 1);
+}
+
 LITE_OS_SEC_TEXT UINT32 LOS_SemGetValue(UINT32 semHandle, INT32 *currVal)
 {
     LosSemCB *sem = GET_SEM(semHandle);
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "los_streambuf.h"
+#include "securec.h"
+#include "los_interrupt.h"
+#include "los_atomic.h"
+#include "los_task.h"
+#include "los_sched.h"
+
+
+#if (LOSCFG_BASE_IPC_STREAMBUF == 1)
+
+/*
+ * The reader owns tail and the writer owns head. Each side publishes its own offset with a release store and
+ * observes the other one with an acquire load, so the data copied before an offset update is visible once the
+ * peer sees the new offset. Interrupts are only masked to wait or to wake a waiting peer.
+ */
+#define OS_STREAMBUF_LOAD_ACQUIRE(ptr)          ((UINT32)LOS_AtomicLoadAcquire((const Atomic *)(ptr)))
+#define OS_STREAMBUF_STORE_RELEASE(ptr, val)    LOS_AtomicStoreRelease((Atomic *)(ptr), (INT32)(val))
+
+STATIC INLINE UINT32 OsStreamBufUsed(const STREAMBUF_CB_S *streamBuf, UINT32 head, UINT32 tail)
+{
+    return (head >= tail) ? (head - tail) : ((streamBuf->size - tail) + head);
+}
+
+STATIC INLINE BOOL OsStreamBufReady(const STREAMBUF_CB_S *streamBuf, UINT32 type, UINT32 size)
+{
+    UINT32 used = OsStreamBufUsed(streamBuf, streamBuf->head, streamBuf->tail);
+
+    if (type == OS_STREAMBUF_READ) {
+        return (used >= size);
+    }
+    return ((streamBuf->size - 1 - used) >= size);
+}
+
+STATIC UINT32 OsStreamBufCopyIn(STREAMBUF_CB_S *streamBuf, const UINT8 *data, UINT32 len)
+{
+    UINT32 head = streamBuf->head;
+    UINT32 tail = OS_STREAMBUF_LOAD_ACQUIRE(&streamBuf->tail);
+    UINT32 space = streamBuf->size - 1 - OsStreamBufUsed(streamBuf, head, tail);
+    UINT32 chunk;
+
+    if (len > space) {
+        len = space;
+    }
+    if (len == 0) {
+        return 0;
+    }
+
+    chunk = streamBuf->size - head;
+    if (chunk > len) {
+        chunk = len;
+    }
+    (VOID)memcpy_s(&streamBuf->buffer[head], streamBuf->size - head, data, chunk);
+    if (len > chunk) {
+        (VOID)memcpy_s(streamBuf->buffer, streamBuf->size, data + chunk, len - chunk);
+    }
+
+    head += len;
+    if (head >= streamBuf->size) {
+        head -= streamBuf->size;
+    }
+    OS_STREAMBUF_STORE_RELEASE(&streamBuf->head, head);
+    return len;
+}
+
+STATIC UINT32 OsStreamBufCopyOut(STREAMBUF_CB_S *streamBuf, UINT8 *data, UINT32 len)
+{
+    UINT32 tail = streamBuf->tail;
+    UINT32 head = OS_STREAMBUF_LOAD_ACQUIRE(&streamBuf->head);
+    UINT32 used = OsStreamBufUsed(streamBuf, head, tail);
+    UINT32 chunk;
+
+    if (len > used) {
+        len = used;
+    }
+    if (len == 0) {
+        return 0;
+    }
+
+    chunk = streamBuf->size - tail;
+    if (chunk > len) {
+        chunk = len;
+    }
+    (VOID)memcpy_s(data, len, &streamBuf->buffer[tail], chunk);
+    if (len > chunk) {
+        (VOID)memcpy_s(data + chunk, len - chunk, streamBuf->buffer, len - chunk);
+    }
+
+    tail += len;
+    if (tail >= streamBuf->size) {
+        tail -= streamBuf->size;
+    }
+    OS_STREAMBUF_STORE_RELEASE(&streamBuf->tail, tail);
+    return len;
+}
+
+/*
+ * Block the running task until the condition of the given side holds. The condition is checked again with
+ * interrupts masked, so an offset update of the peer either happens before the check or sees the waiter.
+ */
+STATIC UINT32 OsStreamBufWait(STREAMBUF_CB_S *streamBuf, UINT32 type, UINT32 size, UINT32 timeOut)
+{
+    LosTaskCB *runTsk = NULL;
+    UINT32 ret = LOS_OK;
+    UINT32 intSave;
+
+    intSave = LOS_IntLock();
+    if (OsStreamBufReady(streamBuf, type, size)) {
+        goto OUT;
+    }
+
+    if (g_losTaskLock) {
+        ret = LOS_ERRNO_STREAMBUF_PEND_IN_LOCK;
+        goto OUT;
+    }
+
+    if (!LOS_ListEmpty(&streamBuf->waitList[type])) {
+        ret = LOS_ERRNO_STREAMBUF_IN_USE;
+        goto OUT;
+    }
+
+    streamBuf->waitSize[type] = size;
+    runTsk = g_losTask.runTask;
+    OsSchedTaskWait(&streamBuf->waitList[type], timeOut);
+    LOS_IntRestore(intSave);
+    LOS_Schedule();
+
+    intSave = LOS_IntLock();
+    if (runTsk->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+        runTsk->taskStatus &= ~OS_TASK_STATUS_TIMEOUT;
+        ret = LOS_ERRNO_STREAMBUF_TIMEOUT;
+    }
+
+OUT:
+    LOS_IntRestore(intSave);
+    return ret;
+}
+
+STATIC VOID OsStreamBufWake(STREAMBUF_CB_S *streamBuf, UINT32 type)
+{
+    LosTaskCB *resumedTask = NULL;
+    UINT32 intSave;
+
+    /*
+     * The waiter checks the offsets and queues itself with interrupts masked. On a single core the offset
+     * update only has to stay before the waiter check in program order, which a compiler barrier keeps.
+     */
+    OS_ATOMIC_BARRIER();
+    if (LOS_ListEmpty(&streamBuf->waitList[type])) {
+        return;
+    }
+
+    intSave = LOS_IntLock();
+    if (!LOS_ListEmpty(&streamBuf->waitList[type]) &&
+        OsStreamBufReady(streamBuf, type, streamBuf->waitSize[type])) {
+        resumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&streamBuf->waitList[type]));
+        OsSchedTaskWake(resumedTask);
+        LOS_IntRestore(intSave);
+        LOS_Schedule();
+        return;
+    }
+    LOS_IntRestore(intSave);
+}
+
+STATIC INLINE UINT32 OsStreamBufParamCheck(const STREAMBUF_CB_S *streamBuf, const VOID *data,
+                                           const UINT32 *len, UINT32 timeOut)
+{
+    if ((streamBuf == NULL) || (data == NULL) || (len == NULL)) {
+        return LOS_ERRNO_STREAMBUF_PTR_NULL;
+    }
+
+    if (streamBuf->buffer == NULL) {
+        return LOS_ERRNO_STREAMBUF_NOT_INITIALIZED;
+    }
+
+    if (*len == 0) {
+        return LOS_ERRNO_STREAMBUF_LEN_ISZERO;
+    }
+
+    if ((timeOut != LOS_NO_WAIT) && OS_INT_ACTIVE) {
+        return LOS_ERRNO_STREAMBUF_PEND_INTERR;
+    }
+
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_StreamBufInit(STREAMBUF_CB_S *streamBuf, VOID *buffer, UINT32 size,
+                                               UINT32 triggerLevel)
+{
+    if ((streamBuf == NULL) || (buffer == NULL)) {
+        return LOS_ERRNO_STREAMBUF_PTR_NULL;
+    }
+
+    if (size < 2) { /* 2: one byte of data and the byte kept free */
+        return LOS_ERRNO_STREAMBUF_SIZE_INVALID;
+    }
+
+    if ((triggerLevel == 0) || (triggerLevel >= size)) {
+        return LOS_ERRNO_STREAMBUF_TRIGGER_INVALID;
+    }
+
+    streamBuf->buffer = (UINT8 *)buffer;
+    streamBuf->size = size;
+    streamBuf->head = 0;
+    streamBuf->tail = 0;
+    streamBuf->triggerLevel = triggerLevel;
+    streamBuf->waitSize[OS_STREAMBUF_READ] = 0;
+    streamBuf->waitSize[OS_STREAMBUF_WRITE] = 0;
+    LOS_ListInit(&streamBuf->waitList[OS_STREAMBUF_READ]);
+    LOS_ListInit(&streamBuf->waitList[OS_STREAMBUF_WRITE]);
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_StreamBufWrite(STREAMBUF_CB_S *streamBuf, const VOID *data, UINT32 *len, UINT32 timeOut)
+{
+    UINT32 ret;
+    UINT32 written;
+
+    ret = OsStreamBufParamCheck(streamBuf, data, len, timeOut);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    if ((timeOut != LOS_NO_WAIT) && (*len > (streamBuf->size - 1))) {
+        return LOS_ERRNO_STREAMBUF_LEN_TOO_BIG;
+    }
+
+    written = OsStreamBufCopyIn(streamBuf, (const UINT8 *)data, *len);
+    OsStreamBufWake(streamBuf, OS_STREAMBUF_READ);
+
+    if ((written < *len) && (timeOut != LOS_NO_WAIT)) {
+        ret = OsStreamBufWait(streamBuf, OS_STREAMBUF_WRITE, *len - written, timeOut);
+        if (ret == LOS_OK) {
+            written += OsStreamBufCopyIn(streamBuf, (const UINT8 *)data + written, *len - written);
+            OsStreamBufWake(streamBuf, OS_STREAMBUF_READ);
+        }
+    }
+
+    *len = written;
+    if ((ret == LOS_OK) && (written == 0)) {
+        ret = LOS_ERRNO_STREAMBUF_ISFULL;
+    }
+    return ret;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_StreamBufRead(STREAMBUF_CB_S *streamBuf, VOID *data, UINT32 *len, UINT32 timeOut)
+{
+    UINT32 ret;
+    UINT32 need;
+    UINT32 read;
+
+    ret = OsStreamBufParamCheck(streamBuf, data, len, timeOut);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    if (timeOut != LOS_NO_WAIT) {
+        need = (*len < streamBuf->triggerLevel) ? *len : streamBuf->triggerLevel;
+        if (LOS_StreamBufUsedGet(streamBuf) < need) {
+            ret = OsStreamBufWait(streamBuf, OS_STREAMBUF_READ, need, timeOut);
+            if (ret != LOS_OK) {
+                *len = 0;
+                return ret;
+            }
+        }
+    }
+
+    read = OsStreamBufCopyOut(streamBuf, (UINT8 *)data, *len);
+    OsStreamBufWake(streamBuf, OS_STREAMBUF_WRITE);
+
+    *len = read;
+    return (read == 0) ? LOS_ERRNO_STREAMBUF_ISEMPTY : LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_StreamBufTriggerLevelSet(STREAMBUF_CB_S *streamBuf, UINT32 triggerLevel)
+{
+    if (streamBuf == NULL) {
+        return LOS_ERRNO_STREAMBUF_PTR_NULL;
+    }
+
+    if (streamBuf->buffer == NULL) {
+        return LOS_ERRNO_STREAMBUF_NOT_INITIALIZED;
+    }
+
+    if ((triggerLevel == 0) || (triggerLevel >= streamBuf->size)) {
+        return LOS_ERRNO_STREAMBUF_TRIGGER_INVALID;
+    }
+
+    streamBuf->triggerLevel = triggerLevel;
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_StreamBufUsedGet(const STREAMBUF_CB_S *streamBuf)
+{
+    if ((streamBuf == NULL) || (streamBuf->buffer == NULL)) {
+        return 0;
+    }
+
+    return OsStreamBufUsed(streamBuf, OS_STREAMBUF_LOAD_ACQUIRE(&streamBuf->head),
+                           OS_STREAMBUF_LOAD_ACQUIRE(&streamBuf->tail));
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_StreamBufSpaceGet(const STREAMBUF_CB_S *streamBuf)
+{
+    if ((streamBuf == NULL) || (streamBuf->buffer == NULL)) {
+        return 0;
+    }
+
+    return streamBuf->size - 1 - LOS_StreamBufUsedGet(streamBuf);
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_StreamBufReset(STREAMBUF_CB_S *streamBuf)
+{
+    UINT32 intSave;
+
+    if (streamBuf == NULL) {
+        return LOS_ERRNO_STREAMBUF_PTR_NULL;
+    }
+
+    if (streamBuf->buffer == NULL) {
+        return LOS_ERRNO_STREAMBUF_NOT_INITIALIZED;
+    }
+
+    intSave = LOS_IntLock();
+    if (!LOS_ListEmpty(&streamBuf->waitList[OS_STREAMBUF_READ]) ||
+        !LOS_ListEmpty(&streamBuf->waitList[OS_STREAMBUF_WRITE])) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_STREAMBUF_IN_USE;
+    }
+    streamBuf->head = 0;
+    streamBuf->tail = 0;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_StreamBufDestroy(STREAMBUF_CB_S *streamBuf)
+{
+    UINT32 intSave;
+
+    if (streamBuf == NULL) {
+        return LOS_ERRNO_STREAMBUF_PTR_NULL;
+    }
+
+    intSave = LOS_IntLock();
+    if ((streamBuf->buffer != NULL) &&
+        (!LOS_ListEmpty(&streamBuf->waitList[OS_STREAMBUF_READ]) ||
+         !LOS_ListEmpty(&streamBuf->waitList[OS_STREAMBUF_WRITE]))) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_STREAMBUF_IN_USE;
+    }
+    streamBuf->buffer = NULL;
+    streamBuf->size = 0;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+#endif /* (LOSCFG_BASE_IPC_STREAMBUF == 1) */
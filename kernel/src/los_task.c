@@ -41,6 +41,9 @@
 #include "los_mux.h"
 #include "los_sem.h"
 #include "los_timer.h"
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+#include "los_barrier.h"
+#endif
 #if (LOSCFG_BASE_CORE_CPUP == 1)
 #include "los_cpup.h"
 #endif
@@ -164,6 +167,10 @@ LITE_OS_SEC_TEXT VOID OsIdleTask(VOID)
     while (1) {
         OsRecyleFinishedTask();
 
+#if (LOSCFG_MEM_BACKGROUND_CHECK == 1)
+        (VOID)LOS_MemIntegrityCheckStep(m_aucSysMem0, LOSCFG_MEM_BACKGROUND_CHECK_NODE_NUM);
+#endif
+
         if (PmEnter != NULL) {
             PmEnter(TRUE);
         } else {
@@ -657,6 +664,16 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsNewTaskInit(LosTaskCB *taskCB, TSK_INIT_PARAM_S *
     taskCB->stackSize       = taskInitParam->uwStackSize;
     taskCB->taskSem         = NULL;
     taskCB->taskMux         = NULL;
+    taskCB->semPendCount    = 0;
+#if (LOSCFG_BASE_IPC_RWLOCK == 1)
+    (VOID)memset_s(taskCB->rwlockRead, sizeof(taskCB->rwlockRead), 0, sizeof(taskCB->rwlockRead));
+#endif
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+    taskCB->taskBarrier     = NULL;
+#endif
+#if (LOSCFG_MEM_TCACHE == 1)
+    (VOID)memset_s(&taskCB->memCache, sizeof(LosMemTcache), 0, sizeof(LosMemTcache));
+#endif
     taskCB->taskStatus      = OS_TASK_STATUS_SUSPEND;
     taskCB->priority        = taskInitParam->usTaskPrio;
     taskCB->timeSlice       = 0;
@@ -709,12 +726,12 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *taskID, TSK_INIT_PARAM_S
     LOS_IntRestore(intSave);
 
 #if (LOSCFG_EXC_HARDWARE_STACK_PROTECTION == 1)
-    UINTPTR stackPtr = (UINTPTR)LOS_MemAllocAlign(OS_TASK_STACK_ADDR, taskInitParam->uwStackSize +
-        OS_TASK_STACK_PROTECT_SIZE, OS_TASK_STACK_PROTECT_SIZE);
+    UINTPTR stackPtr = (UINTPTR)LOS_MemAllocAlignHint(OS_TASK_STACK_ADDR, taskInitParam->uwStackSize +
+        OS_TASK_STACK_PROTECT_SIZE, OS_TASK_STACK_PROTECT_SIZE, LOSCFG_TASK_STACK_MEM_HINT);
     topOfStack = (VOID *)(stackPtr + OS_TASK_STACK_PROTECT_SIZE);
 #else
-    topOfStack = (VOID *)LOS_MemAllocAlign(OS_TASK_STACK_ADDR, taskInitParam->uwStackSize,
-        LOSCFG_STACK_POINT_ALIGN_SIZE);
+    topOfStack = (VOID *)LOS_MemAllocAlignHint(OS_TASK_STACK_ADDR, taskInitParam->uwStackSize,
+        LOSCFG_STACK_POINT_ALIGN_SIZE, LOSCFG_TASK_STACK_MEM_HINT);
 #endif
     if (topOfStack == NULL) {
         intSave = LOS_IntLock();
@@ -899,12 +916,26 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskDelete(UINT32 taskID)
     UINT32 intSave;
     LosTaskCB *taskCB = OS_TCB_FROM_TID(taskID);
     UINTPTR stackPtr;
+#if (LOSCFG_BASE_IPC_SEM == 1)
+    LosSemCB *semPended = NULL;
+#endif
+#if (LOSCFG_MEM_TCACHE == 1)
+    LosMemTcache memCache;
+#endif
+    BOOL needSched = FALSE;
 
     UINT32 ret = OsCheckTaskIDValid(taskID);
     if (ret != LOS_OK) {
         return ret;
     }
 
+#if (LOSCFG_MEM_TCACHE == 1)
+    /* A task deleting itself does not come back after the schedule, so it gives its cache back first. */
+    if (taskCB == g_losTask.runTask) {
+        OsMemTcacheFlush(taskID);
+    }
+#endif
+
     intSave = LOS_IntLock();
 
     if ((taskCB->taskStatus) & OS_TASK_STATUS_UNUSED) {
@@ -919,7 +950,30 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskDelete(UINT32 taskID)
     }
 
     OsHookCall(LOS_HOOK_TYPE_TASK_DELETE, taskCB);
+#if (LOSCFG_MEM_TCACHE == 1)
+    /* The blocks are freed once interrupts are unlocked again. */
+    OsMemTcacheTake(taskID, &memCache);
+#endif
+#if (LOSCFG_BASE_IPC_SEM == 1)
+    if (taskCB->taskStatus & OS_TASK_STATUS_PEND) {
+        semPended = (LosSemCB *)taskCB->taskSem;
+        taskCB->taskSem = NULL;
+    }
+#endif
     OsSchedTaskExit(taskCB);
+#if (LOSCFG_BASE_IPC_SEM == 1)
+    /* A deleted head waiter may hold back units that the waiters behind it can take. */
+    if (semPended != NULL) {
+        needSched = OsSemWaiterLeft(semPended);
+    }
+#endif
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+    /* A waiter whose round has not been released yet still counts as arrived. */
+    if (taskCB->taskBarrier != NULL) {
+        OsBarrierWaiterLeft((LosBarrierCB *)taskCB->taskBarrier, taskCB->barrierRound);
+        taskCB->taskBarrier = NULL;
+    }
+#endif
 
     LOS_EventDestroy(&(taskCB->event));
     taskCB->event.uwEventID = OS_NULL_INT;
@@ -932,6 +986,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskDelete(UINT32 taskID)
         taskCB->taskStatus = OS_TASK_STATUS_UNUSED;
         OsRunningTaskDelete(taskID, taskCB);
         LOS_IntRestore(intSave);
+#if (LOSCFG_MEM_TCACHE == 1)
+        OsMemTcacheRelease(&memCache);
+#endif
         LOS_Schedule();
         return LOS_OK;
     } else {
@@ -947,6 +1004,12 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskDelete(UINT32 taskID)
     }
 
     LOS_IntRestore(intSave);
+#if (LOSCFG_MEM_TCACHE == 1)
+    OsMemTcacheRelease(&memCache);
+#endif
+    if (needSched) {
+        LOS_Schedule();
+    }
     return LOS_OK;
 }
 
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_arena.h"
+#include "los_memory.h"
+
+#if (LOSCFG_MEM_ARENA == 1)
+#define OS_ARENA_ALIGN_SIZE         sizeof(UINTPTR)
+#define OS_ARENA_IS_POW_TWO(value)  ((((UINTPTR)(value)) & ((UINTPTR)(value) - 1)) == 0)
+#define OS_ARENA_ALIGN(p, alignSize) (((UINTPTR)(p) + (alignSize) - 1) & ~((UINTPTR)((alignSize) - 1)))
+
+/* A chunk added when the current one is full, its memory follows the head. */
+typedef struct OsArenaChunk {
+    struct OsArenaChunk *next;
+    UINT32 size;
+} OsArenaChunk;
+
+/* The first chunk follows the arena head in the same block of the parent pool. */
+typedef struct {
+    VOID *pool;
+    OsArenaChunk *chunkList; /* Chunks added after the first one */
+    UINTPTR cur;             /* Next free byte of the current chunk */
+    UINTPTR end;             /* End of the current chunk */
+    UINT32 chunkSize;
+    UINT32 usedSize;
+    UINT32 peakUsedSize;
+    UINT32 totalSize;
+    UINT32 chunkNum;
+} OsArena;
+
+STATIC INLINE UINTPTR OsArenaFirstChunkGet(const OsArena *arena)
+{
+    return (UINTPTR)(arena + 1);
+}
+
+STATIC VOID *OsArenaChunkAdd(OsArena *arena, UINT32 size, UINT32 boundary)
+{
+    OsArenaChunk *chunk = NULL;
+    UINTPTR ptr;
+    UINT32 needSize;
+    UINT32 chunkSize;
+
+    /* The chunk memory is aligned to OS_ARENA_ALIGN_SIZE, so that much of the boundary needs no padding. */
+    if (size > (UINT32)(OS_NULL_INT - sizeof(OsArenaChunk) - boundary)) {
+        return NULL;
+    }
+    needSize = size + boundary - OS_ARENA_ALIGN_SIZE;
+    chunkSize = (needSize > arena->chunkSize) ? needSize : arena->chunkSize;
+
+    chunk = (OsArenaChunk *)LOS_MemAlloc(arena->pool, sizeof(OsArenaChunk) + chunkSize);
+    if (chunk == NULL) {
+        return NULL;
+    }
+    chunk->size = chunkSize;
+    chunk->next = arena->chunkList;
+    arena->chunkList = chunk;
+    arena->totalSize += chunkSize;
+    arena->chunkNum++;
+
+    ptr = OS_ARENA_ALIGN(chunk + 1, boundary);
+    /* A request larger than the chunk size gets a chunk of its own, and the current chunk stays in use. */
+    if (chunkSize == arena->chunkSize) {
+        arena->cur = ptr + size;
+        arena->end = (UINTPTR)(chunk + 1) + chunkSize;
+    }
+    arena->usedSize += size;
+    return (VOID *)ptr;
+}
+
+VOID *LOS_ArenaCreate(VOID *pool, UINT32 chunkSize)
+{
+    OsArena *arena = NULL;
+
+    if ((pool == NULL) || (chunkSize == 0) ||
+        (chunkSize > (UINT32)(OS_NULL_INT - sizeof(OsArena) - OS_ARENA_ALIGN_SIZE))) {
+        return NULL;
+    }
+    chunkSize = OS_ARENA_ALIGN(chunkSize, OS_ARENA_ALIGN_SIZE);
+
+    arena = (OsArena *)LOS_MemAlloc(pool, sizeof(OsArena) + chunkSize);
+    if (arena == NULL) {
+        return NULL;
+    }
+    arena->pool = pool;
+    arena->chunkList = NULL;
+    arena->cur = OsArenaFirstChunkGet(arena);
+    arena->end = arena->cur + chunkSize;
+    arena->chunkSize = chunkSize;
+    arena->usedSize = 0;
+    arena->peakUsedSize = 0;
+    arena->totalSize = chunkSize;
+    arena->chunkNum = 1;
+    return arena;
+}
+
+VOID *LOS_ArenaAllocAlign(VOID *arena, UINT32 size, UINT32 boundary)
+{
+    OsArena *head = (OsArena *)arena;
+    UINTPTR ptr;
+
+    if ((head == NULL) || (size == 0) || (boundary == 0) || !OS_ARENA_IS_POW_TWO(boundary)) {
+        return NULL;
+    }
+    if (boundary < OS_ARENA_ALIGN_SIZE) {
+        boundary = OS_ARENA_ALIGN_SIZE;
+    }
+
+    ptr = OS_ARENA_ALIGN(head->cur, boundary);
+    if ((ptr <= head->end) && (size <= (head->end - ptr))) {
+        head->cur = ptr + size;
+        head->usedSize += size;
+        return (VOID *)ptr;
+    }
+    return OsArenaChunkAdd(head, size, boundary);
+}
+
+VOID *LOS_ArenaAlloc(VOID *arena, UINT32 size)
+{
+    return LOS_ArenaAllocAlign(arena, size, OS_ARENA_ALIGN_SIZE);
+}
+
+STATIC VOID OsArenaChunksFree(OsArena *arena)
+{
+    OsArenaChunk *chunk = arena->chunkList;
+    OsArenaChunk *next = NULL;
+
+    while (chunk != NULL) {
+        next = chunk->next;
+        (VOID)LOS_MemFree(arena->pool, chunk);
+        chunk = next;
+    }
+    arena->chunkList = NULL;
+}
+
+UINT32 LOS_ArenaReset(VOID *arena)
+{
+    OsArena *head = (OsArena *)arena;
+
+    if (head == NULL) {
+        return LOS_NOK;
+    }
+
+    OsArenaChunksFree(head);
+    if (head->usedSize > head->peakUsedSize) {
+        head->peakUsedSize = head->usedSize;
+    }
+    head->cur = OsArenaFirstChunkGet(head);
+    head->end = head->cur + head->chunkSize;
+    head->usedSize = 0;
+    head->totalSize = head->chunkSize;
+    head->chunkNum = 1;
+    return LOS_OK;
+}
+
+UINT32 LOS_ArenaDestroy(VOID *arena)
+{
+    OsArena *head = (OsArena *)arena;
+
+    if (head == NULL) {
+        return LOS_NOK;
+    }
+
+    OsArenaChunksFree(head);
+    return LOS_MemFree(head->pool, head);
+}
+
+UINT32 LOS_ArenaInfoGet(const VOID *arena, LOS_ARENA_STATUS *status)
+{
+    const OsArena *head = (const OsArena *)arena;
+
+    if ((head == NULL) || (status == NULL)) {
+        return LOS_NOK;
+    }
+
+    status->usedSize = head->usedSize;
+    status->peakUsedSize = (head->usedSize > head->peakUsedSize) ? head->usedSize : head->peakUsedSize;
+    status->totalSize = head->totalSize;
+    status->chunkNum = head->chunkNum;
+    return LOS_OK;
+}
+#endif /* (LOSCFG_MEM_ARENA == 1) */
@@ -32,9 +32,12 @@
 #include "los_membox.h"
 #include "securec.h"
 #include "los_interrupt.h"
+#include "los_atomic.h"
 #include "los_context.h"
 #include "los_debug.h"
 #include "los_task.h"
+#include "los_sched.h"
+#include "los_memory.h"
 
 
 /* The magic length is 32 bits, the lower 8 bits are used to save the owner task ID,
@@ -44,10 +47,9 @@
 #define OS_MEMBOX_MAX_TASKID    ((1 << OS_MEMBOX_TASKID_BITS) - 1)
 #define OS_MEMBOX_TASKID_GET(addr) (((UINTPTR)(addr)) & OS_MEMBOX_MAX_TASKID)
 
-STATIC INLINE VOID OsMemBoxSetMagic(LOS_MEMBOX_NODE *node)
+STATIC INLINE VOID OsMemBoxSetMagic(LOS_MEMBOX_NODE *node, UINT32 taskID)
 {
-    UINT8 taskID = (UINT8)LOS_CurTaskIDGet();
-    node->pstNext = (LOS_MEMBOX_NODE *)(OS_MEMBOX_MAGIC | taskID);
+    node->pstNext = (LOS_MEMBOX_NODE *)(OS_MEMBOX_MAGIC | (UINT8)taskID);
 }
 
 STATIC INLINE UINT32 OsMemBoxCheckMagic(LOS_MEMBOX_NODE *node)
@@ -87,6 +89,179 @@ STATIC INLINE UINT32 OsCheckBoxMem(const LOS_MEMBOX_INFO *boxInfo, const VOID *n
     return OsMemBoxCheckMagic((LOS_MEMBOX_NODE *)node);
 }
 
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+/* The head of a lock-free free list is a 32-bit word, so that one compare-and-swap updates it: the low 16 bits
+   are the index of the first free block plus one, 0 for an empty list, and the high 16 bits are a tag that
+   every update increments, so that a pop preempted between reading the head and swapping it fails even if
+   the same block is back at the head by then. */
+#define OS_MEMBOX_LOCK_FREE_MAX_BLK     0xFFFF
+#define OS_MEMBOX_HEAD_INDEX_MASK       0xFFFFU
+#define OS_MEMBOX_HEAD_TAG_STEP         0x10000U
+
+STATIC INLINE LOS_MEMBOX_NODE *OsMemBoxHeadNodeGet(const LOS_MEMBOX_INFO *boxInfo, UINT32 head)
+{
+    UINT32 index = head & OS_MEMBOX_HEAD_INDEX_MASK;
+
+    if (index == 0) {
+        return NULL;
+    }
+    return (LOS_MEMBOX_NODE *)(VOID *)((UINT8 *)(boxInfo + 1) + ((index - 1) * boxInfo->uwBlkSize));
+}
+
+STATIC INLINE UINT32 OsMemBoxHeadMake(const LOS_MEMBOX_INFO *boxInfo, UINT32 oldHead, const LOS_MEMBOX_NODE *node)
+{
+    UINT32 index = 0;
+
+    /* node may be garbage read from a block another user took meanwhile, the swap fails then anyway. */
+    if (node != NULL) {
+        index = ((UINT32)((UINTPTR)node - (UINTPTR)(boxInfo + 1)) / boxInfo->uwBlkSize) + 1;
+    }
+    return ((oldHead + OS_MEMBOX_HEAD_TAG_STEP) & ~OS_MEMBOX_HEAD_INDEX_MASK) | (index & OS_MEMBOX_HEAD_INDEX_MASK);
+}
+
+STATIC LOS_MEMBOX_NODE *OsMemBoxLockFreePop(LOS_MEMBOX_INFO *boxInfo)
+{
+    LOS_MEMBOX_NODE *node = NULL;
+    UINT32 head;
+
+    do {
+        head = (UINT32)LOS_AtomicLoadAcquire((Atomic *)&boxInfo->uwFreeHead);
+        node = OsMemBoxHeadNodeGet(boxInfo, head);
+        if (node == NULL) {
+            return NULL;
+        }
+    } while (LOS_AtomicCmpXchg32bits((Atomic *)&boxInfo->uwFreeHead,
+                                     (INT32)OsMemBoxHeadMake(boxInfo, head, node->pstNext), (INT32)head));
+
+    return node;
+}
+
+STATIC UINT32 OsMemBoxLockFreeFree(LOS_MEMBOX_INFO *boxInfo, LOS_MEMBOX_NODE *node)
+{
+    UINTPTR magic = (UINTPTR)node->pstNext;
+    UINT32 head;
+
+    if (OsCheckBoxMem(boxInfo, node) != LOS_OK) {
+        return LOS_NOK;
+    }
+
+    /* Clear the magic, which fits in the low 32 bits of the node head, so that a racing second free fails. */
+    if (LOS_AtomicCmpXchg32bits((Atomic *)(VOID *)node, 0, (INT32)magic)) {
+        return LOS_NOK;
+    }
+
+    do {
+        head = (UINT32)LOS_AtomicLoadAcquire((Atomic *)&boxInfo->uwFreeHead);
+        node->pstNext = OsMemBoxHeadNodeGet(boxInfo, head);
+    } while (LOS_AtomicCmpXchg32bits((Atomic *)&boxInfo->uwFreeHead,
+                                     (INT32)OsMemBoxHeadMake(boxInfo, head, node), (INT32)head));
+
+    return LOS_OK;
+}
+
+UINT32 LOS_MemboxLockFreeEnable(VOID *pool)
+{
+    LOS_MEMBOX_INFO *boxInfo = (LOS_MEMBOX_INFO *)pool;
+    UINT32 intSave;
+
+    if ((pool == NULL) || (boxInfo->uwBlkSize == 0) || (boxInfo->uwBlkNum > OS_MEMBOX_LOCK_FREE_MAX_BLK)) {
+        return LOS_NOK;
+    }
+
+    MEMBOX_LOCK(intSave);
+    if (!boxInfo->uwLockFree) {
+        boxInfo->uwFreeHead = OsMemBoxHeadMake(boxInfo, 0, boxInfo->stFreeList.pstNext);
+        boxInfo->stFreeList.pstNext = NULL;
+        boxInfo->uwLockFree = TRUE;
+    }
+    MEMBOX_UNLOCK(intSave);
+
+    return LOS_OK;
+}
+#endif
+
+/* Take the first block off the free list, with interrupts locked unless the pool is lock-free. */
+STATIC INLINE LOS_MEMBOX_NODE *OsMemBoxPop(LOS_MEMBOX_INFO *boxInfo)
+{
+    LOS_MEMBOX_NODE *node = NULL;
+
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    if (boxInfo->uwLockFree) {
+        return OsMemBoxLockFreePop(boxInfo);
+    }
+#endif
+    node = boxInfo->stFreeList.pstNext;
+    if (node != NULL) {
+        boxInfo->stFreeList.pstNext = node->pstNext;
+    }
+    return node;
+}
+
+VOID *OsMemboxPend(LOS_MEMBOX_INFO *boxInfo, UINT32 timeout, UINT32 *intSave)
+{
+    LosTaskCB *runTask = g_losTask.runTask;
+    VOID *block = NULL;
+
+    OsSchedTaskWait(&boxInfo->stWaitList, timeout);
+    MEMBOX_UNLOCK(*intSave);
+    LOS_Schedule();
+
+    MEMBOX_LOCK(*intSave);
+    if (runTask->taskStatus & OS_TASK_STATUS_TIMEOUT) {
+        runTask->taskStatus &= ~OS_TASK_STATUS_TIMEOUT;
+        return NULL;
+    }
+
+    block = runTask->msg;
+    runTask->msg = NULL;
+    return block;
+}
+
+UINT32 OsMemboxPost(LOS_MEMBOX_INFO *boxInfo, VOID *block)
+{
+    LosTaskCB *resumedTask = NULL;
+    LosTaskCB *taskCB = NULL;
+
+    /* The wait list is in arrival order, the first of the highest priority waiters is served. */
+    LOS_DL_LIST_FOR_EACH_ENTRY(taskCB, &boxInfo->stWaitList, LosTaskCB, pendList) {
+        if ((resumedTask == NULL) || (taskCB->priority < resumedTask->priority)) {
+            resumedTask = taskCB;
+        }
+    }
+
+    if (resumedTask == NULL) {
+        return OS_INVALID;
+    }
+
+    resumedTask->msg = block;
+    OsSchedTaskWake(resumedTask);
+    return resumedTask->taskID;
+}
+
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+/* Called after a lock-free push that raced with a task finding the pool empty and starting to wait. */
+STATIC VOID OsMemBoxWaiterWake(LOS_MEMBOX_INFO *boxInfo)
+{
+    LOS_MEMBOX_NODE *node = NULL;
+    UINT32 intSave;
+
+    MEMBOX_LOCK(intSave);
+    if (!LOS_ListEmpty(&boxInfo->stWaitList)) {
+        /* Another user may have taken the freed block meanwhile, the waiters then keep waiting for the next. */
+        node = OsMemBoxPop(boxInfo);
+    }
+    if (node == NULL) {
+        MEMBOX_UNLOCK(intSave);
+        return;
+    }
+
+    OsMemBoxSetMagic(node, OsMemboxPost(boxInfo, OS_MEMBOX_USER_ADDR(node)));
+    boxInfo->uwBlkCnt++;
+    MEMBOX_UNLOCK(intSave);
+    LOS_Schedule();
+}
+#endif
+
 #if (LOSCFG_PLATFORM_EXC == 1)
 STATIC LOS_MEMBOX_INFO *g_memBoxHead = NULL;
 STATIC VOID OsMemBoxAdd(VOID *pool)
@@ -132,6 +307,11 @@ UINT32 LOS_MemboxInit(VOID *pool, UINT32 poolSize, UINT32 blkSize)
     boxInfo->uwBlkSize = LOS_MEMBOX_ALIGNED(blkSize + OS_MEMBOX_NODE_HEAD_SIZE);
     boxInfo->uwBlkNum = (poolSize - sizeof(LOS_MEMBOX_INFO)) / boxInfo->uwBlkSize;
     boxInfo->uwBlkCnt = 0;
+    LOS_ListInit(&boxInfo->stWaitList);
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    boxInfo->uwLockFree = FALSE;
+    boxInfo->uwFreeHead = 0;
+#endif
     if (boxInfo->uwBlkNum == 0) {
         MEMBOX_UNLOCK(intSave);
         return LOS_NOK;
@@ -161,29 +341,61 @@ VOID *LOS_MemboxAlloc(VOID *pool)
 {
     LOS_MEMBOX_INFO *boxInfo = (LOS_MEMBOX_INFO *)pool;
     LOS_MEMBOX_NODE *node = NULL;
-    LOS_MEMBOX_NODE *nodeTmp = NULL;
     UINT32 intSave;
 
     if (pool == NULL) {
         return NULL;
     }
 
+    /* The block count is a plain field under the lock, only the lock-free paths update it atomically. */
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    if (boxInfo->uwLockFree) {
+        node = OsMemBoxPop(boxInfo);
+        if (node != NULL) {
+            LOS_AtomicInc((Atomic *)&boxInfo->uwBlkCnt);
+        }
+    } else
+#endif
+    {
+        MEMBOX_LOCK(intSave);
+        node = OsMemBoxPop(boxInfo);
+        if (node != NULL) {
+            boxInfo->uwBlkCnt++;
+        }
+        MEMBOX_UNLOCK(intSave);
+    }
+
+    if (node == NULL) {
+        return NULL;
+    }
+    OsMemBoxSetMagic(node, LOS_CurTaskIDGet());
+    return OS_MEMBOX_USER_ADDR(node);
+}
+
+VOID *LOS_MemboxAllocWait(VOID *pool, UINT32 timeout)
+{
+    VOID *box = NULL;
+    UINT32 intSave;
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    /* Allocating and joining the wait list under one lock leaves no window for a free to miss the waiter. */
     MEMBOX_LOCK(intSave);
-    node = &(boxInfo->stFreeList);
-    if (node->pstNext != NULL) {
-        nodeTmp = node->pstNext;
-        node->pstNext = nodeTmp->pstNext;
-        OsMemBoxSetMagic(nodeTmp);
-        boxInfo->uwBlkCnt++;
+    box = LOS_MemboxAlloc(pool);
+    if ((box == NULL) && (timeout != LOS_NO_WAIT) && !OS_INT_ACTIVE && (g_losTaskLock == 0)) {
+        box = OsMemboxPend((LOS_MEMBOX_INFO *)pool, timeout, &intSave);
     }
     MEMBOX_UNLOCK(intSave);
 
-    return (nodeTmp == NULL) ? NULL : OS_MEMBOX_USER_ADDR(nodeTmp);
+    return box;
 }
 
 UINT32 LOS_MemboxFree(VOID *pool, VOID *box)
 {
     LOS_MEMBOX_INFO *boxInfo = (LOS_MEMBOX_INFO *)pool;
+    LOS_MEMBOX_NODE *node = NULL;
     UINT32 ret = LOS_NOK;
     UINT32 intSave;
 
@@ -191,20 +403,50 @@ UINT32 LOS_MemboxFree(VOID *pool, VOID *box)
         return LOS_NOK;
     }
 
-    MEMBOX_LOCK(intSave);
-    do {
-        LOS_MEMBOX_NODE *node = OS_MEMBOX_NODE_ADDR(box);
-        if (OsCheckBoxMem(boxInfo, node) != LOS_OK) {
-            break;
+    node = OS_MEMBOX_NODE_ADDR(box);
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    /* Without waiters, a lock-free pool takes the block back without the lock. */
+    if (boxInfo->uwLockFree && LOS_ListEmpty(&boxInfo->stWaitList)) {
+        ret = OsMemBoxLockFreeFree(boxInfo, node);
+        if (ret == LOS_OK) {
+            LOS_AtomicDec((Atomic *)&boxInfo->uwBlkCnt);
+            /* A task that found the pool empty just before the push may be waiting by now. */
+            if (!LOS_ListEmpty(&boxInfo->stWaitList)) {
+                OsMemBoxWaiterWake(boxInfo);
+            }
         }
+        return ret;
+    }
+#endif
 
+    MEMBOX_LOCK(intSave);
+    if (OsCheckBoxMem(boxInfo, node) != LOS_OK) {
+        MEMBOX_UNLOCK(intSave);
+        return LOS_NOK;
+    }
+
+    /* The block goes straight to a waiter and stays allocated, so no other user can take it on the way. */
+    if (!LOS_ListEmpty(&boxInfo->stWaitList)) {
+        OsMemBoxSetMagic(node, OsMemboxPost(boxInfo, box));
+        MEMBOX_UNLOCK(intSave);
+        LOS_Schedule();
+        return LOS_OK;
+    }
+
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    if (boxInfo->uwLockFree) {
+        ret = OsMemBoxLockFreeFree(boxInfo, node);
+    } else
+#endif
+    {
         node->pstNext = boxInfo->stFreeList.pstNext;
         boxInfo->stFreeList.pstNext = node;
-        boxInfo->uwBlkCnt--;
         ret = LOS_OK;
-    } while (0);
+    }
+    if (ret == LOS_OK) {
+        boxInfo->uwBlkCnt--;
+    }
     MEMBOX_UNLOCK(intSave);
-
     return ret;
 }
 
@@ -234,8 +476,13 @@ VOID LOS_ShowBox(VOID *pool)
     PRINT_INFO("membox(%p, 0x%x, 0x%x):\r\n", pool, boxInfo->uwBlkSize, boxInfo->uwBlkNum);
     PRINT_INFO("free node list:\r\n");
 
-    for (node = boxInfo->stFreeList.pstNext, index = 0; node != NULL;
-        node = node->pstNext, ++index) {
+    node = boxInfo->stFreeList.pstNext;
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    if (boxInfo->uwLockFree) {
+        node = OsMemBoxHeadNodeGet(boxInfo, boxInfo->uwFreeHead);
+    }
+#endif
+    for (index = 0; node != NULL; node = node->pstNext, ++index) {
         PRINT_INFO("(%u, %p)\r\n", index, node);
     }
 
@@ -255,12 +502,171 @@ UINT32 LOS_MemboxStatisticsGet(const VOID *boxMem, UINT32 *maxBlk,
     }
 
     *maxBlk = ((OS_MEMBOX_S *)boxMem)->uwBlkNum;
-    *blkCnt = ((OS_MEMBOX_S *)boxMem)->uwBlkCnt;
+    *blkCnt = (UINT32)LOS_AtomicRead((const Atomic *)&((const OS_MEMBOX_S *)boxMem)->uwBlkCnt);
     *blkSize = ((OS_MEMBOX_S *)boxMem)->uwBlkSize;
 
     return LOS_OK;
 }
 
+#if (LOSCFG_MEMBOX_MULTI == 1)
+UINT32 LOS_MemboxMultiInit(VOID *pool, UINT32 poolSize, const LOS_MEMBOX_CLASS_CFG *cfg,
+                           UINT32 classNum, BOOL spill)
+{
+    LOS_MEMBOX_MULTI_INFO *multiInfo = (LOS_MEMBOX_MULTI_INFO *)pool;
+    UINT8 *classPool = NULL;
+    UINT32 classSize;
+    UINT32 index;
+
+    if ((pool == NULL) || (cfg == NULL) || (classNum == 0) || (classNum > LOSCFG_MEMBOX_MULTI_CLASS_NUM) ||
+        (((UINTPTR)pool & (sizeof(UINTPTR) - 1)) != 0) || (poolSize < sizeof(LOS_MEMBOX_MULTI_INFO))) {
+        return LOS_NOK;
+    }
+
+    poolSize -= sizeof(LOS_MEMBOX_MULTI_INFO);
+    for (index = 0; index < classNum; index++) {
+        if ((cfg[index].blkSize == 0) || (cfg[index].blkNum == 0) || (poolSize <= sizeof(LOS_MEMBOX_INFO)) ||
+            (cfg[index].blkSize >= poolSize) || ((index > 0) && (cfg[index].blkSize <= cfg[index - 1].blkSize))) {
+            return LOS_NOK;
+        }
+        classSize = LOS_MEMBOX_ALIGNED(cfg[index].blkSize + OS_MEMBOX_NODE_HEAD_SIZE);
+        if (cfg[index].blkNum > ((poolSize - sizeof(LOS_MEMBOX_INFO)) / classSize)) {
+            return LOS_NOK;
+        }
+        poolSize -= (UINT32)LOS_MEMBOX_SIZE(cfg[index].blkSize, cfg[index].blkNum);
+    }
+
+    (VOID)memset_s(multiInfo, sizeof(LOS_MEMBOX_MULTI_INFO), 0, sizeof(LOS_MEMBOX_MULTI_INFO));
+    multiInfo->classNum = classNum;
+    multiInfo->spill = spill;
+    classPool = (UINT8 *)(multiInfo + 1);
+    for (index = 0; index < classNum; index++) {
+        classSize = (UINT32)LOS_MEMBOX_SIZE(cfg[index].blkSize, cfg[index].blkNum);
+        (VOID)LOS_MemboxInit(classPool, classSize, cfg[index].blkSize);
+        multiInfo->classes[index].pool = (LOS_MEMBOX_INFO *)classPool;
+        classPool += classSize;
+        multiInfo->classes[index].poolEnd = (UINTPTR)classPool;
+    }
+
+    return LOS_OK;
+}
+
+STATIC VOID OsMemboxClassAllocCount(LOS_MEMBOX_CLASS *cls, UINT32 blkCnt, BOOL fallback)
+{
+    UINT32 peakCnt;
+
+    LOS_AtomicInc((Atomic *)&cls->allocCount);
+    if (fallback) {
+        LOS_AtomicInc((Atomic *)&cls->fallbackCount);
+    }
+    do {
+        peakCnt = (UINT32)LOS_AtomicRead((Atomic *)&cls->peakCnt);
+        if (blkCnt <= peakCnt) {
+            break;
+        }
+    } while (LOS_AtomicCmpXchg32bits((Atomic *)&cls->peakCnt, (INT32)blkCnt, (INT32)peakCnt));
+}
+
+VOID *LOS_MemboxMultiAlloc(VOID *pool, UINT32 size)
+{
+    LOS_MEMBOX_MULTI_INFO *multiInfo = (LOS_MEMBOX_MULTI_INFO *)pool;
+    LOS_MEMBOX_CLASS *cls = NULL;
+    VOID *box = NULL;
+    UINT32 first;
+    UINT32 index;
+
+    if ((pool == NULL) || (size == 0)) {
+        return NULL;
+    }
+
+    /* At most LOSCFG_MEMBOX_MULTI_CLASS_NUM classes to look at, each of them allocating in constant time. */
+    for (first = 0; first < multiInfo->classNum; first++) {
+        if ((multiInfo->classes[first].pool->uwBlkSize - OS_MEMBOX_NODE_HEAD_SIZE) >= size) {
+            break;
+        }
+    }
+
+    for (index = first; index < multiInfo->classNum; index++) {
+        cls = &multiInfo->classes[index];
+        box = LOS_MemboxAlloc(cls->pool);
+        if (box != NULL) {
+            OsMemboxClassAllocCount(cls, (UINT32)LOS_AtomicRead((Atomic *)&cls->pool->uwBlkCnt), index != first);
+            return box;
+        }
+        LOS_AtomicInc((Atomic *)&cls->failCount);
+    }
+
+    if (!multiInfo->spill) {
+        return NULL;
+    }
+
+    cls = &multiInfo->spillClass;
+    box = LOS_MemAlloc((VOID *)OS_SYS_MEM_ADDR, size);
+    if (box == NULL) {
+        LOS_AtomicInc((Atomic *)&cls->failCount);
+        return NULL;
+    }
+    OsMemboxClassAllocCount(cls, (UINT32)LOS_AtomicIncRet((Atomic *)&multiInfo->spillCnt),
+                            first < multiInfo->classNum);
+    return box;
+}
+
+UINT32 LOS_MemboxMultiFree(VOID *pool, VOID *box)
+{
+    LOS_MEMBOX_MULTI_INFO *multiInfo = (LOS_MEMBOX_MULTI_INFO *)pool;
+    LOS_MEMBOX_CLASS *cls = NULL;
+    UINT32 index;
+    UINT32 ret;
+
+    if ((pool == NULL) || (box == NULL)) {
+        return LOS_NOK;
+    }
+
+    for (index = 0; index < multiInfo->classNum; index++) {
+        cls = &multiInfo->classes[index];
+        if (((UINTPTR)box > (UINTPTR)cls->pool) && ((UINTPTR)box < cls->poolEnd)) {
+            return LOS_MemboxFree(cls->pool, box);
+        }
+    }
+
+    if (!multiInfo->spill) {
+        return LOS_NOK;
+    }
+
+    ret = LOS_MemFree((VOID *)OS_SYS_MEM_ADDR, box);
+    if (ret == LOS_OK) {
+        LOS_AtomicDec((Atomic *)&multiInfo->spillCnt);
+    }
+    return ret;
+}
+
+UINT32 LOS_MemboxMultiStatisticsGet(const VOID *pool, UINT32 classIndex, LOS_MEMBOX_CLASS_STAT *stat)
+{
+    const LOS_MEMBOX_MULTI_INFO *multiInfo = (const LOS_MEMBOX_MULTI_INFO *)pool;
+    const LOS_MEMBOX_CLASS *cls = NULL;
+
+    if ((pool == NULL) || (stat == NULL) || (classIndex > multiInfo->classNum)) {
+        return LOS_NOK;
+    }
+
+    if (classIndex == multiInfo->classNum) {
+        cls = &multiInfo->spillClass;
+        stat->blkSize = 0;
+        stat->blkNum = 0;
+        stat->blkCnt = (UINT32)LOS_AtomicRead((const Atomic *)&multiInfo->spillCnt);
+    } else {
+        cls = &multiInfo->classes[classIndex];
+        (VOID)LOS_MemboxStatisticsGet(cls->pool, &stat->blkNum, &stat->blkCnt, &stat->blkSize);
+        stat->blkSize -= OS_MEMBOX_NODE_HEAD_SIZE;
+    }
+    stat->peakCnt = cls->peakCnt;
+    stat->allocCount = cls->allocCount;
+    stat->fallbackCount = cls->fallbackCount;
+    stat->failCount = cls->failCount;
+
+    return LOS_OK;
+}
+#endif
+
 #if (LOSCFG_PLATFORM_EXC == 1)
 STATIC VOID OsMemboxExcInfoGetSub(const LOS_MEMBOX_INFO *pool, MemInfoCB *memExcInfo)
 {
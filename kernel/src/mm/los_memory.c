@@ -37,6 +37,7 @@
 #include "los_hook.h"
 #include "los_interrupt.h"
 #include "los_task.h"
+#include "los_sched.h"
 
 
 /* Used to cut non-essential functions. */
@@ -68,6 +69,10 @@ VOID *g_poolHead = NULL;
 #define OS_MEM_FREE_LIST_COUNT  (OS_MEM_SMALL_BUCKET_COUNT + (OS_MEM_LARGE_BUCKET_COUNT << OS_MEM_SLI))
 /* The bitmap is used to indicate whether the free list is empty, 1: not empty, 0: empty. */
 #define OS_MEM_BITMAP_WORDS     ((OS_MEM_FREE_LIST_COUNT >> 5) + 1)
+/* The first level bitmap marks the words of the free list bitmap that are not zero, so it must fit in one word. */
+#if (OS_MEM_BITMAP_WORDS > 32)
+#error "The first level free list bitmap is too small"
+#endif
 
 #define OS_MEM_BITMAP_MASK 0x1FU
 
@@ -154,13 +159,69 @@ struct OsMemPoolInfo {
 #endif
 };
 
+#if (LOSCFG_MEM_SLAB == 1)
+/*
+ * Small requests are served by size classes of 16, 32, 64 and 128 bytes. Their objects are carved out of fixed-size
+ * pages of one arena taken from the pool; the page descriptors live outside the pages, so an object has no header
+ * and its page is found from its address alone.
+ */
+#define OS_MEM_SLAB_MIN_SHIFT       4
+#define OS_MEM_SLAB_MAX_SIZE        (1U << (OS_MEM_SLAB_MIN_SHIFT + LOS_MEM_SLAB_CLASS_NUM - 1))
+#define OS_MEM_SLAB_PAGE_SHIFT      9
+#define OS_MEM_SLAB_PAGE_SIZE       (1U << OS_MEM_SLAB_PAGE_SHIFT)
+#define OS_MEM_SLAB_ALIGN_SIZE      (1U << OS_MEM_SLAB_MIN_SHIFT)
+#define OS_MEM_SLAB_OBJ_SIZE(index) (1U << ((index) + OS_MEM_SLAB_MIN_SHIFT))
+#define OS_MEM_SLAB_OBJ_NUM(index)  (OS_MEM_SLAB_PAGE_SIZE >> ((index) + OS_MEM_SLAB_MIN_SHIFT))
+
+struct OsMemSlabPage {
+    struct OsMemSlabPage *prev;
+    struct OsMemSlabPage *next;
+    VOID *freeObj;      /* Objects given back to the page, linked through their first word */
+    UINT32 usedMap;     /* Bit i is set while object i is handed out */
+    UINT16 bumpIndex;   /* Objects from this index on have never been handed out */
+    UINT8 usedNum;
+    UINT8 classIndex;
+};
+
+struct OsMemSlabClass {
+    struct OsMemSlabPage *partial; /* Pages with at least one free object */
+    UINT32 pageNum;
+    UINT32 usedNum;
+};
+
+struct OsMemSlabArena {
+    UINTPTR base;                   /* Address of the first page */
+    UINT32 pageNum;
+    struct OsMemSlabPage *page;     /* One descriptor per page */
+    struct OsMemSlabPage *freePage; /* Pages not owned by any class */
+    struct OsMemSlabClass slabClass[LOS_MEM_SLAB_CLASS_NUM];
+};
+#endif
+
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+struct OsMemRegionTier {
+    UINTPTR start;
+    UINTPTR end;
+    UINT32 attr;
+    UINT32 freeSize;    /* Bytes of the free nodes in the region, so a hinted search knows when to skip it */
+};
+#endif
+
 struct OsMemPoolHead {
     struct OsMemPoolInfo info;
+    UINT32 freeListWordBitmap;
     UINT32 freeListBitmap[OS_MEM_BITMAP_WORDS];
     struct OsMemFreeNodeHead *freeList[OS_MEM_FREE_LIST_COUNT];
 #if (LOSCFG_MEM_MUL_POOL == 1)
     VOID *nextPool;
 #endif
+#if (LOSCFG_MEM_SLAB == 1)
+    struct OsMemSlabArena *slab;
+#endif
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    UINT32 tierNum;     /* Regions with attributes, the others have none */
+    struct OsMemRegionTier tier[LOSCFG_MEM_REGION_TIER_NUM];
+#endif
 };
 
 /* The memory pool support expand. */
@@ -313,6 +374,40 @@ STATIC INLINE VOID OsMemWaterUsedRecord(struct OsMemPoolHead *pool, UINT32 size)
 }
 #endif
 
+#if (LOSCFG_MEM_BACKGROUND_CHECK == 1)
+/* Where LOS_MemIntegrityCheckStep resumes: the last node it found intact, and the end of its region. */
+STATIC struct {
+    const VOID *pool;
+    struct OsMemNodeHead *node;
+    struct OsMemNodeHead *endNode;
+} g_memCheckCursor;
+
+STATIC INLINE VOID OsMemCheckCursorReset(const VOID *pool)
+{
+    if (g_memCheckCursor.pool == pool) {
+        g_memCheckCursor.node = NULL;
+    }
+}
+
+/* node is about to be merged into the node before it, so its head stops being a node. */
+STATIC INLINE VOID OsMemCheckCursorMerge(const struct OsMemNodeHead *node)
+{
+    if (g_memCheckCursor.node == node) {
+        g_memCheckCursor.node = node->ptr.prev;
+    }
+}
+#else
+STATIC INLINE VOID OsMemCheckCursorReset(const VOID *pool)
+{
+    (VOID)pool;
+}
+
+STATIC INLINE VOID OsMemCheckCursorMerge(const struct OsMemNodeHead *node)
+{
+    (VOID)node;
+}
+#endif
+
 #if OS_MEM_EXPAND_ENABLE
 STATIC INLINE struct OsMemNodeHead *OsMemLastSentinelNodeGet(const struct OsMemNodeHead *sentinelNode)
 {
@@ -430,6 +525,7 @@ STATIC INLINE BOOL TryShrinkPool(const VOID *pool, const struct OsMemNodeHead *n
         PRINT_ERR("TryShrinkPool free 0x%x failed!\n", node);
         return FALSE;
     }
+    OsMemCheckCursorReset(pool);
 
     return TRUE;
 }
@@ -604,6 +700,128 @@ STATIC VOID OsMemNodeBacktraceInfo(const struct OsMemNodeHead *tmpNode,
 #endif
 #endif
 
+#if (LOSCFG_MEM_PROFILE == 1)
+/* Number of entries tried for a site before its allocations go to the overflow site. */
+#define OS_MEM_PROFILE_PROBE_NUM    8
+
+/* The last entry is the overflow site, for the sites that find no room in the table. */
+STATIC LOS_MEM_PROFILE_SITE g_memProfileSite[LOSCFG_MEM_PROFILE_SITE_NUM + 1];
+
+STATIC INLINE UINT32 OsMemProfileHash(const UINTPTR *linkReg)
+{
+    UINT32 hash = 0;
+    UINT32 count;
+
+    for (count = 0; count < LOSCFG_MEM_RECORD_LR_CNT; count++) {
+        hash = (hash * 31) + (UINT32)linkReg[count]; /* 31: multiplier of the classic string hash */
+    }
+    return hash ^ (hash >> 16); /* 16: fold the high half into the bits that pick the entry */
+}
+
+/* Sites are never removed, so the lookup may stop at the first empty entry. */
+STATIC LOS_MEM_PROFILE_SITE *OsMemProfileSiteGet(const UINTPTR *linkReg, BOOL create)
+{
+    UINT32 index = OsMemProfileHash(linkReg);
+    LOS_MEM_PROFILE_SITE *site = NULL;
+    UINT32 probe;
+
+    for (probe = 0; probe < OS_MEM_PROFILE_PROBE_NUM; probe++, index++) {
+        site = &g_memProfileSite[index % LOSCFG_MEM_PROFILE_SITE_NUM];
+        if (site->allocCount == 0) {
+            if (!create) {
+                break;
+            }
+            (VOID)memcpy_s(site->linkReg, sizeof(site->linkReg), linkReg, sizeof(site->linkReg));
+            return site;
+        }
+        if (memcmp(site->linkReg, linkReg, sizeof(site->linkReg)) == 0) {
+            return site;
+        }
+    }
+
+    return &g_memProfileSite[LOSCFG_MEM_PROFILE_SITE_NUM];
+}
+
+STATIC INLINE VOID OsMemProfileAlloc(const struct OsMemNodeHead *node)
+{
+    UINT32 intSave = LOS_IntLock();
+    LOS_MEM_PROFILE_SITE *site = OsMemProfileSiteGet(node->linkReg, TRUE);
+
+    site->liveSize += OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
+    site->liveCount++;
+    site->allocCount++;
+    if (site->liveSize > site->peakSize) {
+        site->peakSize = site->liveSize;
+    }
+    LOS_IntRestore(intSave);
+}
+
+STATIC INLINE VOID OsMemProfileFree(const struct OsMemNodeHead *node)
+{
+    UINT32 size = OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
+    UINT32 intSave = LOS_IntLock();
+    LOS_MEM_PROFILE_SITE *site = OsMemProfileSiteGet(node->linkReg, FALSE);
+
+    if (site->liveCount != 0) {
+        site->liveCount--;
+        site->liveSize -= (site->liveSize > size) ? size : site->liveSize;
+    }
+    LOS_IntRestore(intSave);
+}
+
+UINT32 LOS_MemProfileGet(LOS_MEM_PROFILE_SITE *sites, UINT32 *num)
+{
+    const LOS_MEM_PROFILE_SITE *site = NULL;
+    UINT32 count = 0;
+    UINT32 index;
+    UINT32 pos;
+    UINT32 moveNum;
+    UINT32 intSave;
+
+    if ((sites == NULL) || (num == NULL)) {
+        return LOS_NOK;
+    }
+
+    intSave = LOS_IntLock();
+    for (index = 0; index <= LOSCFG_MEM_PROFILE_SITE_NUM; index++) {
+        site = &g_memProfileSite[index];
+        if (site->allocCount == 0) {
+            continue;
+        }
+        pos = count;
+        while ((pos > 0) && (sites[pos - 1].liveSize < site->liveSize)) {
+            pos--;
+        }
+        if (pos >= *num) {
+            continue;
+        }
+        moveNum = ((count < *num) ? count : (*num - 1)) - pos;
+        if (moveNum != 0) {
+            (VOID)memmove_s(&sites[pos + 1], moveNum * sizeof(LOS_MEM_PROFILE_SITE),
+                            &sites[pos], moveNum * sizeof(LOS_MEM_PROFILE_SITE));
+        }
+        sites[pos] = *site;
+        if (count < *num) {
+            count++;
+        }
+    }
+    LOS_IntRestore(intSave);
+
+    *num = count;
+    return LOS_OK;
+}
+#else
+STATIC INLINE VOID OsMemProfileAlloc(const struct OsMemNodeHead *node)
+{
+    (VOID)node;
+}
+
+STATIC INLINE VOID OsMemProfileFree(const struct OsMemNodeHead *node)
+{
+    (VOID)node;
+}
+#endif
+
 STATIC INLINE UINT32 OsMemFreeListIndexGet(UINT32 size)
 {
     UINT32 fl = OsMemFlGet(size);
@@ -629,13 +847,20 @@ STATIC INLINE struct OsMemFreeNodeHead *OsMemFindCurSuitableBlock(struct OsMemPo
     return NULL;
 }
 
+/* Find the first non-empty free list from index on: one bit search in its word, one in the first level bitmap. */
 STATIC INLINE UINT32 OsMemNotEmptyIndexGet(struct OsMemPoolHead *poolHead, UINT32 index)
 {
-    UINT32 mask = poolHead->freeListBitmap[index >> 5]; /* 5: Divide by 32 to calculate the index of the bitmap array. */
-    mask &= ~((1 << (index & OS_MEM_BITMAP_MASK)) - 1);
+    UINT32 word = index >> 5; /* 5: Divide by 32 to calculate the index of the bitmap array. */
+    UINT32 mask = poolHead->freeListBitmap[word];
+    mask &= ~((1U << (index & OS_MEM_BITMAP_MASK)) - 1);
+    if (mask != 0) {
+        return OsMemFFS(mask) + (word << 5); /* 5: Multiply by 32 to get the first index of the word. */
+    }
+
+    mask = poolHead->freeListWordBitmap & ~((2U << word) - 1); /* 2: Skip the words up to and including word. */
     if (mask != 0) {
-        index = OsMemFFS(mask) + (index & ~OS_MEM_BITMAP_MASK);
-        return index;
+        word = OsMemFFS(mask);
+        return OsMemFFS(poolHead->freeListBitmap[word]) + (word << 5); /* 5: Multiply by 32. */
     }
 
     return OS_MEM_FREE_LIST_COUNT;
@@ -648,7 +873,6 @@ STATIC INLINE struct OsMemFreeNodeHead *OsMemFindNextSuitableBlock(VOID *pool, U
     UINT32 sl;
     UINT32 index, tmp;
     UINT32 curIndex = OS_MEM_FREE_LIST_COUNT;
-    UINT32 mask;
 
     do {
         if (fl < OS_MEM_SMALL_BUCKET_COUNT) {
@@ -664,14 +888,6 @@ STATIC INLINE struct OsMemFreeNodeHead *OsMemFindNextSuitableBlock(VOID *pool, U
             index = tmp;
             goto DONE;
         }
-
-        for (index = LOS_Align(index + 1, 32); index < OS_MEM_FREE_LIST_COUNT; index += 32) {
-            mask = poolHead->freeListBitmap[index >> 5]; /* 5: Divide by 32 to calculate the index of the bitmap array. */
-            if (mask != 0) {
-                index = OsMemFFS(mask) + index;
-                goto DONE;
-            }
-        }
     } while (0);
 
     if (curIndex == OS_MEM_FREE_LIST_COUNT) {
@@ -687,13 +903,40 @@ DONE:
 
 STATIC INLINE VOID OsMemSetFreeListBit(struct OsMemPoolHead *head, UINT32 index)
 {
-    head->freeListBitmap[index >> 5] |= 1U << (index & 0x1f); /* 5: Divide by 32 to calculate the index of the bitmap array. */
+    UINT32 word = index >> 5; /* 5: Divide by 32 to calculate the index of the bitmap array. */
+
+    head->freeListBitmap[word] |= 1U << (index & 0x1f);
+    head->freeListWordBitmap |= 1U << word;
 }
 
 STATIC INLINE VOID OsMemClearFreeListBit(struct OsMemPoolHead *head, UINT32 index)
 {
-    head->freeListBitmap[index >> 5] &= ~(1U << (index & 0x1f)); /* 5: Divide by 32 to calculate the index of the bitmap array. */
+    UINT32 word = index >> 5; /* 5: Divide by 32 to calculate the index of the bitmap array. */
+
+    head->freeListBitmap[word] &= ~(1U << (index & 0x1f));
+    if (head->freeListBitmap[word] == 0) {
+        head->freeListWordBitmap &= ~(1U << word);
+    }
+}
+
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+STATIC INLINE VOID OsMemTierFreeSizeUpdate(struct OsMemPoolHead *pool, const struct OsMemFreeNodeHead *node,
+                                           BOOL add)
+{
+    UINT32 index;
+
+    for (index = 0; index < pool->tierNum; index++) {
+        if (OS_MEM_MIDDLE_ADDR_OPEN_END(pool->tier[index].start, node, pool->tier[index].end)) {
+            if (add) {
+                pool->tier[index].freeSize += OS_MEM_NODE_GET_SIZE(node->header.sizeAndFlag);
+            } else {
+                pool->tier[index].freeSize -= OS_MEM_NODE_GET_SIZE(node->header.sizeAndFlag);
+            }
+            return;
+        }
+    }
 }
+#endif
 
 STATIC INLINE VOID OsMemListAdd(struct OsMemPoolHead *pool, UINT32 listIndex, struct OsMemFreeNodeHead *node)
 {
@@ -706,6 +949,9 @@ STATIC INLINE VOID OsMemListAdd(struct OsMemPoolHead *pool, UINT32 listIndex, st
     pool->freeList[listIndex] = node;
     OsMemSetFreeListBit(pool, listIndex);
     OS_MEM_SET_MAGIC(&node->header);
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    OsMemTierFreeSizeUpdate(pool, node, TRUE);
+#endif
 }
 
 STATIC INLINE VOID OsMemListDelete(struct OsMemPoolHead *pool, UINT32 listIndex, struct OsMemFreeNodeHead *node)
@@ -724,6 +970,9 @@ STATIC INLINE VOID OsMemListDelete(struct OsMemPoolHead *pool, UINT32 listIndex,
         }
     }
     OS_MEM_SET_MAGIC(&node->header);
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    OsMemTierFreeSizeUpdate(pool, node, FALSE);
+#endif
 }
 
 STATIC INLINE VOID OsMemFreeNodeAdd(VOID *pool, struct OsMemFreeNodeHead *node)
@@ -741,11 +990,74 @@ STATIC INLINE VOID OsMemFreeNodeDelete(VOID *pool, struct OsMemFreeNodeHead *nod
     OsMemListDelete(pool, index, node);
 }
 
-STATIC INLINE struct OsMemNodeHead *OsMemFreeNodeGet(VOID *pool, UINT32 size)
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+STATIC INLINE UINT32 OsMemRegionAttrGet(const struct OsMemPoolHead *poolHead, const VOID *addr)
+{
+    UINT32 index;
+
+    for (index = 0; index < poolHead->tierNum; index++) {
+        if (OS_MEM_MIDDLE_ADDR_OPEN_END(poolHead->tier[index].start, addr, poolHead->tier[index].end)) {
+            return poolHead->tier[index].attr;
+        }
+    }
+    return 0;
+}
+
+/* Unlike OsMemFindNextSuitableBlock this walks the lists, a node never spans two regions as gap nodes part them. */
+STATIC struct OsMemFreeNodeHead *OsMemTierFreeNodeFind(struct OsMemPoolHead *poolHead, UINT32 size, UINT32 attr,
+                                                       UINT32 *outIndex)
+{
+    struct OsMemFreeNodeHead *node = NULL;
+    UINT32 freeSize = 0;
+    UINT32 index;
+
+    /* Walk the lists only when the regions with the attributes hold enough free memory for the request. */
+    for (index = 0; index < poolHead->tierNum; index++) {
+        if ((poolHead->tier[index].attr & attr) == attr) {
+            freeSize += poolHead->tier[index].freeSize;
+        }
+    }
+    if (freeSize < size) {
+        return NULL;
+    }
+
+    index = OsMemNotEmptyIndexGet(poolHead, OsMemFreeListIndexGet(size));
+    while (index < OS_MEM_FREE_LIST_COUNT) {
+        for (node = poolHead->freeList[index]; node != NULL; node = node->next) {
+            if ((node->header.sizeAndFlag >= size) && ((OsMemRegionAttrGet(poolHead, node) & attr) == attr)) {
+                *outIndex = index;
+                return node;
+            }
+        }
+        if ((index + 1) == OS_MEM_FREE_LIST_COUNT) {
+            break;
+        }
+        index = OsMemNotEmptyIndexGet(poolHead, index + 1);
+    }
+    return NULL;
+}
+#endif
+
+STATIC INLINE struct OsMemNodeHead *OsMemFreeNodeGet(VOID *pool, UINT32 size, UINT32 hint)
 {
     struct OsMemPoolHead *poolHead = (struct OsMemPoolHead *)pool;
     UINT32 index;
-    struct OsMemFreeNodeHead *firstNode = OsMemFindNextSuitableBlock(pool, size, &index);
+    struct OsMemFreeNodeHead *firstNode = NULL;
+
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    if ((hint & ~LOS_MEM_HINT_STRICT) != 0) {
+        firstNode = OsMemTierFreeNodeFind(poolHead, size, hint & ~LOS_MEM_HINT_STRICT, &index);
+        if ((firstNode == NULL) && (hint & LOS_MEM_HINT_STRICT)) {
+            return NULL;
+        }
+    }
+    if (firstNode == NULL) {
+        firstNode = OsMemFindNextSuitableBlock(pool, size, &index);
+    }
+#else
+    (VOID)hint;
+    firstNode = OsMemFindNextSuitableBlock(pool, size, &index);
+#endif
     if (firstNode == NULL) {
         return NULL;
     }
@@ -759,6 +1071,7 @@ STATIC INLINE VOID OsMemMergeNode(struct OsMemNodeHead *node)
 {
     struct OsMemNodeHead *nextNode = NULL;
 
+    OsMemCheckCursorMerge(node);
     node->ptr.prev->sizeAndFlag += node->sizeAndFlag;
     nextNode = (struct OsMemNodeHead *)((UINTPTR)node + node->sizeAndFlag);
     if (!OS_MEM_NODE_GET_LAST_FLAG(nextNode->sizeAndFlag) && !OS_MEM_IS_GAP_NODE(nextNode)) {
@@ -805,6 +1118,7 @@ STATIC UINT32 OsMemPoolInit(VOID *pool, UINT32 size)
     struct OsMemNodeHead *endNode = NULL;
 
     (VOID)memset_s(poolHead, sizeof(struct OsMemPoolHead), 0, sizeof(struct OsMemPoolHead));
+    OsMemCheckCursorReset(pool);
 
     poolHead->info.pool = pool;
     poolHead->info.totalSize = size;
@@ -838,6 +1152,7 @@ STATIC UINT32 OsMemPoolInit(VOID *pool, UINT32 size)
 #if (LOSCFG_MEM_MUL_POOL == 1)
 STATIC VOID OsMemPoolDeinit(VOID *pool)
 {
+    OsMemCheckCursorReset(pool);
     (VOID)memset_s(pool, sizeof(struct OsMemPoolHead), 0, sizeof(struct OsMemPoolHead));
 }
 
@@ -959,7 +1274,207 @@ UINT32 LOS_MemPoolList(VOID)
 }
 #endif
 
-STATIC INLINE VOID *OsMemAlloc(struct OsMemPoolHead *pool, UINT32 size, UINT32 intSave)
+#if (LOSCFG_MEM_SLAB == 1)
+STATIC INLINE UINT32 OsMemSlabClassGet(UINT32 size)
+{
+    if (size <= OS_MEM_SLAB_ALIGN_SIZE) {
+        return 0;
+    }
+    return (OsMemLog2(size - 1) + 1 - OS_MEM_SLAB_MIN_SHIFT);
+}
+
+STATIC INLINE BOOL OsMemSlabOwns(const struct OsMemSlabArena *arena, const VOID *ptr)
+{
+    return ((arena != NULL) && ((UINTPTR)ptr >= arena->base) &&
+            ((UINTPTR)ptr < (arena->base + (arena->pageNum << OS_MEM_SLAB_PAGE_SHIFT))));
+}
+
+STATIC INLINE struct OsMemSlabPage *OsMemSlabPageGet(const struct OsMemSlabArena *arena, const VOID *ptr)
+{
+    return &arena->page[((UINTPTR)ptr - arena->base) >> OS_MEM_SLAB_PAGE_SHIFT];
+}
+
+STATIC INLINE UINT32 OsMemSlabObjBit(const struct OsMemSlabArena *arena, const VOID *obj, UINT32 index)
+{
+    return 1U << ((((UINTPTR)obj - arena->base) & (OS_MEM_SLAB_PAGE_SIZE - 1)) >> (index + OS_MEM_SLAB_MIN_SHIFT));
+}
+
+STATIC INLINE VOID OsMemSlabPageInsert(struct OsMemSlabClass *slabClass, struct OsMemSlabPage *page)
+{
+    page->prev = NULL;
+    page->next = slabClass->partial;
+    if (slabClass->partial != NULL) {
+        slabClass->partial->prev = page;
+    }
+    slabClass->partial = page;
+}
+
+STATIC INLINE VOID OsMemSlabPageRemove(struct OsMemSlabClass *slabClass, struct OsMemSlabPage *page)
+{
+    if (page->prev != NULL) {
+        page->prev->next = page->next;
+    } else {
+        slabClass->partial = page->next;
+    }
+    if (page->next != NULL) {
+        page->next->prev = page->prev;
+    }
+}
+
+STATIC VOID *OsMemSlabAlloc(struct OsMemSlabArena *arena, UINT32 size)
+{
+    UINT32 index = OsMemSlabClassGet(size);
+    struct OsMemSlabClass *slabClass = &arena->slabClass[index];
+    struct OsMemSlabPage *page = slabClass->partial;
+    VOID *obj = NULL;
+
+    if (page == NULL) {
+        page = arena->freePage;
+        if (page == NULL) {
+            return NULL;
+        }
+        arena->freePage = page->next;
+        page->freeObj = NULL;
+        page->usedMap = 0;
+        page->bumpIndex = 0;
+        page->usedNum = 0;
+        page->classIndex = (UINT8)index;
+        OsMemSlabPageInsert(slabClass, page);
+        slabClass->pageNum++;
+    }
+
+    if (page->freeObj != NULL) {
+        obj = page->freeObj;
+        page->freeObj = *(VOID **)obj;
+    } else {
+        obj = (VOID *)(arena->base + ((UINTPTR)(page - arena->page) << OS_MEM_SLAB_PAGE_SHIFT) +
+                       ((UINTPTR)page->bumpIndex << (index + OS_MEM_SLAB_MIN_SHIFT)));
+        page->bumpIndex++;
+    }
+
+    page->usedMap |= OsMemSlabObjBit(arena, obj, index);
+    page->usedNum++;
+    slabClass->usedNum++;
+    if (page->usedNum == OS_MEM_SLAB_OBJ_NUM(index)) {
+        OsMemSlabPageRemove(slabClass, page);
+    }
+    return obj;
+}
+
+STATIC UINT32 OsMemSlabFree(struct OsMemSlabArena *arena, VOID *ptr)
+{
+    struct OsMemSlabPage *page = OsMemSlabPageGet(arena, ptr);
+    UINT32 index = page->classIndex;
+    struct OsMemSlabClass *slabClass = &arena->slabClass[index];
+    UINT32 objBit;
+
+    /* Reject a pointer into the middle of an object, and an object that is not handed out, e.g. freed twice. */
+    if ((page->usedNum == 0) || (((UINTPTR)ptr - arena->base) & (OS_MEM_SLAB_OBJ_SIZE(index) - 1))) {
+        PRINT_ERR("[%s] invalid slab object %p\n", __FUNCTION__, ptr);
+        return LOS_NOK;
+    }
+    objBit = OsMemSlabObjBit(arena, ptr, index);
+    if ((page->usedMap & objBit) == 0) {
+        PRINT_ERR("[%s] slab object %p is not in use\n", __FUNCTION__, ptr);
+        return LOS_NOK;
+    }
+    page->usedMap &= ~objBit;
+
+    if (page->usedNum == OS_MEM_SLAB_OBJ_NUM(index)) {
+        OsMemSlabPageInsert(slabClass, page);
+    }
+    *(VOID **)ptr = page->freeObj;
+    page->freeObj = ptr;
+    page->usedNum--;
+    slabClass->usedNum--;
+
+    /* Give an empty page back to the arena unless it is the last one the class could allocate from. */
+    if ((page->usedNum == 0) && ((slabClass->partial != page) || (page->next != NULL))) {
+        OsMemSlabPageRemove(slabClass, page);
+        page->next = arena->freePage;
+        arena->freePage = page;
+        slabClass->pageNum--;
+    }
+    return LOS_OK;
+}
+
+STATIC VOID OsMemSlabInit(struct OsMemPoolHead *pool, UINT32 size)
+{
+    struct OsMemSlabArena *arena = NULL;
+    UINT32 overhead = sizeof(struct OsMemSlabArena) + OS_MEM_SLAB_ALIGN_SIZE;
+    UINT32 pageNum;
+    UINT32 index;
+
+    if (size <= overhead) {
+        return;
+    }
+    pageNum = (size - overhead) / (OS_MEM_SLAB_PAGE_SIZE + sizeof(struct OsMemSlabPage));
+    if (pageNum == 0) {
+        return;
+    }
+
+    arena = (struct OsMemSlabArena *)LOS_MemAlloc(pool, overhead + (pageNum * sizeof(struct OsMemSlabPage)) +
+                                                  (pageNum << OS_MEM_SLAB_PAGE_SHIFT));
+    if (arena == NULL) {
+        PRINT_ERR("[%s] no memory for the slab arena\n", __FUNCTION__);
+        return;
+    }
+
+    (VOID)memset_s(arena, sizeof(struct OsMemSlabArena), 0, sizeof(struct OsMemSlabArena));
+    arena->page = (struct OsMemSlabPage *)(arena + 1);
+    arena->base = OS_MEM_ALIGN(arena->page + pageNum, OS_MEM_SLAB_ALIGN_SIZE);
+    arena->pageNum = pageNum;
+    for (index = 0; index < pageNum; index++) {
+        arena->page[index].next = (index + 1 < pageNum) ? &arena->page[index + 1] : NULL;
+        arena->page[index].usedNum = 0;
+    }
+    arena->freePage = arena->page;
+    pool->slab = arena;
+}
+
+STATIC VOID OsMemSlabInfoGet(const struct OsMemSlabArena *arena, LOS_MEM_POOL_STATUS *poolStatus)
+{
+    const struct OsMemSlabPage *page = NULL;
+    UINT32 index;
+
+    if (arena == NULL) {
+        return;
+    }
+
+    for (page = arena->freePage; page != NULL; page = page->next) {
+        poolStatus->slabFreePageNum++;
+    }
+    for (index = 0; index < LOS_MEM_SLAB_CLASS_NUM; index++) {
+        poolStatus->slabStatus[index].objSize = OS_MEM_SLAB_OBJ_SIZE(index);
+        poolStatus->slabStatus[index].pageNum = arena->slabClass[index].pageNum;
+        poolStatus->slabStatus[index].usedObjNum = arena->slabClass[index].usedNum;
+        poolStatus->slabStatus[index].freeObjNum = (arena->slabClass[index].pageNum * OS_MEM_SLAB_OBJ_NUM(index)) -
+                                                   arena->slabClass[index].usedNum;
+    }
+}
+
+STATIC VOID *OsMemSlabRealloc(VOID *pool, VOID *ptr, UINT32 size)
+{
+    struct OsMemSlabArena *arena = ((struct OsMemPoolHead *)pool)->slab;
+    /* The class of a page does not change while one of its objects is in use. */
+    UINT32 objSize = OS_MEM_SLAB_OBJ_SIZE(OsMemSlabPageGet(arena, ptr)->classIndex);
+    VOID *newPtr = NULL;
+
+    if (size <= objSize) {
+        return ptr;
+    }
+
+    newPtr = LOS_MemAlloc(pool, size);
+    if (newPtr == NULL) {
+        return NULL;
+    }
+    (VOID)memcpy_s(newPtr, size, ptr, objSize);
+    (VOID)LOS_MemFree(pool, ptr);
+    return newPtr;
+}
+#endif
+
+STATIC INLINE VOID *OsMemAlloc(struct OsMemPoolHead *pool, UINT32 size, UINT32 hint, UINT32 intSave)
 {
     struct OsMemNodeHead *allocNode = NULL;
 
@@ -973,7 +1488,7 @@ STATIC INLINE VOID *OsMemAlloc(struct OsMemPoolHead *pool, UINT32 size, UINT32 i
 #if OS_MEM_EXPAND_ENABLE
 retry:
 #endif
-    allocNode = OsMemFreeNodeGet(pool, allocSize);
+    allocNode = OsMemFreeNodeGet(pool, allocSize, hint);
     if (allocNode == NULL) {
 #if OS_MEM_EXPAND_ENABLE
         if (pool->info.attr & OS_MEM_POOL_EXPAND_ENABLE) {
@@ -1004,10 +1519,28 @@ retry:
 #if (LOSCFG_MEM_LEAKCHECK == 1)
     OsMemLinkRegisterRecord(allocNode);
 #endif
+    OsMemProfileAlloc(allocNode);
     return OsMemCreateUsedNode((VOID *)allocNode);
 }
 
-VOID *LOS_MemAlloc(VOID *pool, UINT32 size)
+#if (LOSCFG_MEM_SLAB == 1)
+/*
+ * The slab arena lies wherever the pool put it, so placed requests bypass it, unless the pool has no regions with
+ * attributes and the request may fall back to any memory anyway.
+ */
+STATIC INLINE BOOL OsMemSlabHintFits(const struct OsMemPoolHead *poolHead, UINT32 hint)
+{
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    return (hint == 0) || ((poolHead->tierNum == 0) && !(hint & LOS_MEM_HINT_STRICT));
+#else
+    (VOID)poolHead;
+    (VOID)hint;
+    return TRUE;
+#endif
+}
+#endif
+
+STATIC INLINE VOID *OsMemAllocHint(VOID *pool, UINT32 size, UINT32 hint)
 {
     if ((pool == NULL) || (size == 0)) {
         return NULL;
@@ -1026,7 +1559,15 @@ VOID *LOS_MemAlloc(VOID *pool, UINT32 size)
         if (OS_MEM_NODE_GET_USED_FLAG(size) || OS_MEM_NODE_GET_ALIGNED_FLAG(size)) {
             break;
         }
-        ptr = OsMemAlloc(poolHead, size, intSave);
+#if (LOSCFG_MEM_SLAB == 1)
+        if ((poolHead->slab != NULL) && (size <= OS_MEM_SLAB_MAX_SIZE) && OsMemSlabHintFits(poolHead, hint)) {
+            ptr = OsMemSlabAlloc(poolHead->slab, size);
+            if (ptr != NULL) {
+                break;
+            }
+        }
+#endif
+        ptr = OsMemAlloc(poolHead, size, hint, intSave);
     } while (0);
     MEM_UNLOCK(poolHead, intSave);
 
@@ -1035,13 +1576,23 @@ VOID *LOS_MemAlloc(VOID *pool, UINT32 size)
     return ptr;
 }
 
-VOID *LOS_MemAllocAlign(VOID *pool, UINT32 size, UINT32 boundary)
+VOID *LOS_MemAlloc(VOID *pool, UINT32 size)
 {
-    UINT32 gapSize;
+    return OsMemAllocHint(pool, size, 0);
+}
 
-    if ((pool == NULL) || (size == 0) || (boundary == 0) || !OS_MEM_IS_POW_TWO(boundary) ||
-        !OS_MEM_IS_ALIGNED(boundary, sizeof(VOID *))) {
-        return NULL;
+VOID *LOS_MemAllocHint(VOID *pool, UINT32 size, UINT32 hint)
+{
+    return OsMemAllocHint(pool, size, hint);
+}
+
+STATIC INLINE VOID *OsMemAllocAlignHint(VOID *pool, UINT32 size, UINT32 boundary, UINT32 hint)
+{
+    UINT32 gapSize;
+
+    if ((pool == NULL) || (size == 0) || (boundary == 0) || !OS_MEM_IS_POW_TWO(boundary) ||
+        !OS_MEM_IS_ALIGNED(boundary, sizeof(VOID *))) {
+        return NULL;
     }
 
     if (size < OS_MEM_MIN_ALLOC_SIZE) {
@@ -1069,7 +1620,7 @@ VOID *LOS_MemAllocAlign(VOID *pool, UINT32 size, UINT32 boundary)
 
     MEM_LOCK(poolHead, intSave);
     do {
-        ptr = OsMemAlloc(pool, useSize, intSave);
+        ptr = OsMemAlloc(pool, useSize, hint, intSave);
         alignedPtr = (VOID *)OS_MEM_ALIGN(ptr, boundary);
         if (ptr == alignedPtr) {
             break;
@@ -1090,6 +1641,16 @@ VOID *LOS_MemAllocAlign(VOID *pool, UINT32 size, UINT32 boundary)
     return ptr;
 }
 
+VOID *LOS_MemAllocAlign(VOID *pool, UINT32 size, UINT32 boundary)
+{
+    return OsMemAllocAlignHint(pool, size, boundary, 0);
+}
+
+VOID *LOS_MemAllocAlignHint(VOID *pool, UINT32 size, UINT32 boundary, UINT32 hint)
+{
+    return OsMemAllocAlignHint(pool, size, boundary, hint);
+}
+
 STATIC INLINE BOOL OsMemAddrValidCheck(const struct OsMemPoolHead *pool, const VOID *addr)
 {
     UINT32 size;
@@ -1197,6 +1758,7 @@ STATIC INLINE UINT32 OsMemFree(struct OsMemPoolHead *pool, struct OsMemNodeHead
         PRINT_ERR("OsMemFree check error!\n");
         return ret;
     }
+    OsMemProfileFree(node);
 
 #if (LOSCFG_MEM_WATERLINE == 1)
     pool->info.curUsedSize -= OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
@@ -1274,6 +1836,12 @@ UINT32 LOS_MemFree(VOID *pool, VOID *ptr)
 
     MEM_LOCK(poolHead, intSave);
     do {
+#if (LOSCFG_MEM_SLAB == 1)
+        if (OsMemSlabOwns(poolHead->slab, ptr)) {
+            ret = OsMemSlabFree(poolHead->slab, ptr);
+            break;
+        }
+#endif
         ptr = OsGetRealPtr(pool, ptr);
         if (ptr == NULL) {
             break;
@@ -1291,6 +1859,7 @@ STATIC INLINE VOID OsMemReAllocSmaller(VOID *pool, UINT32 allocSize, struct OsMe
 #if (LOSCFG_MEM_WATERLINE == 1)
     struct OsMemPoolHead *poolInfo = (struct OsMemPoolHead *)pool;
 #endif
+    OsMemProfileFree(node);
     node->sizeAndFlag = nodeSize;
     if ((allocSize + OS_MEM_MIN_LEFT_SIZE) <= nodeSize) {
         OsMemSplitNode(pool, node, allocSize);
@@ -1302,45 +1871,113 @@ STATIC INLINE VOID OsMemReAllocSmaller(VOID *pool, UINT32 allocSize, struct OsMe
 #if (LOSCFG_MEM_LEAKCHECK == 1)
     OsMemLinkRegisterRecord(node);
 #endif
+    OsMemProfileAlloc(node);
 }
 
 STATIC INLINE VOID OsMemMergeNodeForReAllocBigger(VOID *pool, UINT32 allocSize, struct OsMemNodeHead *node,
                                                   UINT32 nodeSize, struct OsMemNodeHead *nextNode)
 {
+    OsMemProfileFree(node);
     node->sizeAndFlag = nodeSize;
     OsMemFreeNodeDelete(pool, (struct OsMemFreeNodeHead *)nextNode);
     OsMemMergeNode(nextNode);
     if ((allocSize + OS_MEM_MIN_LEFT_SIZE) <= node->sizeAndFlag) {
         OsMemSplitNode(pool, node, allocSize);
     }
-    OS_MEM_NODE_SET_USED_FLAG(node->sizeAndFlag);
     OsMemWaterUsedRecord((struct OsMemPoolHead *)pool, node->sizeAndFlag - nodeSize);
+    OS_MEM_NODE_SET_USED_FLAG(node->sizeAndFlag);
 #if (LOSCFG_MEM_LEAKCHECK == 1)
     OsMemLinkRegisterRecord(node);
 #endif
+    OsMemProfileAlloc(node);
 }
 
-STATIC INLINE VOID *OsMemRealloc(struct OsMemPoolHead *pool, const VOID *ptr,
-                struct OsMemNodeHead *node, UINT32 size, UINT32 intSave)
+/* Grow node into the free node before it, and into the free node after it if that is not enough. */
+STATIC INLINE VOID *OsMemMergeNodeForReAllocPrev(VOID *pool, const VOID *ptr, UINT32 allocSize,
+                                                 struct OsMemNodeHead *node, UINT32 nodeSize)
+{
+    struct OsMemNodeHead *preNode = node->ptr.prev;
+    struct OsMemNodeHead *nextNode = OS_MEM_NEXT_NODE(node);
+    VOID *newPtr = (VOID *)((UINTPTR)preNode + OS_MEM_NODE_HEAD_SIZE);
+
+    OsMemProfileFree(node);
+    OsMemFreeNodeDelete(pool, (struct OsMemFreeNodeHead *)preNode);
+    node->sizeAndFlag = nodeSize;
+    OsMemMergeNode(node);
+    if (preNode->sizeAndFlag < allocSize) {
+        OsMemFreeNodeDelete(pool, (struct OsMemFreeNodeHead *)nextNode);
+        OsMemMergeNode(nextNode);
+    }
+
+    /* The regions overlap when the previous node is smaller than the payload. */
+    (VOID)memmove_s(newPtr, preNode->sizeAndFlag - OS_MEM_NODE_HEAD_SIZE, ptr, nodeSize - OS_MEM_NODE_HEAD_SIZE);
+
+    if ((allocSize + OS_MEM_MIN_LEFT_SIZE) <= preNode->sizeAndFlag) {
+        OsMemSplitNode(pool, preNode, allocSize);
+    }
+    OsMemWaterUsedRecord((struct OsMemPoolHead *)pool, preNode->sizeAndFlag - nodeSize);
+    OS_MEM_NODE_SET_USED_FLAG(preNode->sizeAndFlag);
+#if (LOSCFG_MEM_FREE_BY_TASKID == 1)
+    OsMemNodeSetTaskID((struct OsMemUsedNodeHead *)preNode);
+#endif
+#if (LOSCFG_MEM_LEAKCHECK == 1)
+    OsMemLinkRegisterRecord(preNode);
+#endif
+    OsMemProfileAlloc(preNode);
+    return newPtr;
+}
+
+/* Resize node without moving it: shrink it, or grow it into the free node after it. */
+STATIC INLINE BOOL OsMemReAllocInPlace(struct OsMemPoolHead *pool, struct OsMemNodeHead *node, UINT32 allocSize)
 {
-    struct OsMemNodeHead *nextNode = NULL;
-    UINT32 allocSize = OS_MEM_ALIGN(size + OS_MEM_NODE_HEAD_SIZE, OS_MEM_ALIGN_SIZE);
     UINT32 nodeSize = OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
-    VOID *tmpPtr = NULL;
+    struct OsMemNodeHead *nextNode = NULL;
 
     if (nodeSize >= allocSize) {
         OsMemReAllocSmaller(pool, allocSize, node, nodeSize);
-        return (VOID *)ptr;
+        return TRUE;
     }
 
     nextNode = OS_MEM_NEXT_NODE(node);
     if (!OS_MEM_NODE_GET_USED_FLAG(nextNode->sizeAndFlag) &&
         ((nextNode->sizeAndFlag + nodeSize) >= allocSize)) {
         OsMemMergeNodeForReAllocBigger(pool, allocSize, node, nodeSize, nextNode);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+STATIC INLINE VOID *OsMemRealloc(struct OsMemPoolHead *pool, const VOID *ptr,
+                struct OsMemNodeHead *node, UINT32 size, UINT32 intSave)
+{
+    struct OsMemNodeHead *preNode = node->ptr.prev;
+    struct OsMemNodeHead *nextNode = NULL;
+    UINT32 allocSize = OS_MEM_ALIGN(size + OS_MEM_NODE_HEAD_SIZE, OS_MEM_ALIGN_SIZE);
+    UINT32 nodeSize = OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
+    UINT32 mergeSize;
+    VOID *tmpPtr = NULL;
+
+    if (OsMemReAllocInPlace(pool, node, allocSize)) {
         return (VOID *)ptr;
     }
 
-    tmpPtr = OsMemAlloc(pool, size, intSave);
+    if ((preNode != NULL) && !OS_MEM_NODE_GET_USED_FLAG(preNode->sizeAndFlag)) {
+        mergeSize = preNode->sizeAndFlag + nodeSize;
+        nextNode = OS_MEM_NEXT_NODE(node);
+        if (!OS_MEM_NODE_GET_USED_FLAG(nextNode->sizeAndFlag)) {
+            mergeSize += nextNode->sizeAndFlag;
+        }
+        if (mergeSize >= allocSize) {
+            return OsMemMergeNodeForReAllocPrev(pool, ptr, allocSize, node, nodeSize);
+        }
+    }
+
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    /* Keep the block in regions with the attributes of the one it is in. */
+    tmpPtr = OsMemAlloc(pool, size, OsMemRegionAttrGet(pool, node), intSave);
+#else
+    tmpPtr = OsMemAlloc(pool, size, 0, intSave);
+#endif
     if (tmpPtr != NULL) {
         if (memcpy_s(tmpPtr, size, ptr, (nodeSize - OS_MEM_NODE_HEAD_SIZE)) != EOK) {
             MEM_UNLOCK(pool, intSave);
@@ -1379,6 +2016,12 @@ VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size)
     VOID *newPtr = NULL;
     UINT32 intSave = 0;
 
+#if (LOSCFG_MEM_SLAB == 1)
+    if (OsMemSlabOwns(poolHead->slab, ptr)) {
+        return OsMemSlabRealloc(pool, ptr, size);
+    }
+#endif
+
     MEM_LOCK(poolHead, intSave);
     do {
         ptr = OsGetRealPtr(pool, ptr);
@@ -1398,6 +2041,220 @@ VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size)
     return newPtr;
 }
 
+UINT32 LOS_MemReallocInPlace(VOID *pool, VOID *ptr, UINT32 size)
+{
+    if ((pool == NULL) || (ptr == NULL) || (size == 0) ||
+        OS_MEM_NODE_GET_USED_FLAG(size) || OS_MEM_NODE_GET_ALIGNED_FLAG(size)) {
+        return LOS_NOK;
+    }
+
+    if (size < OS_MEM_MIN_ALLOC_SIZE) {
+        size = OS_MEM_MIN_ALLOC_SIZE;
+    }
+
+    struct OsMemPoolHead *poolHead = (struct OsMemPoolHead *)pool;
+    struct OsMemNodeHead *node = NULL;
+    UINT32 ret = LOS_NOK;
+    UINT32 intSave = 0;
+
+#if (LOSCFG_MEM_SLAB == 1)
+    if (OsMemSlabOwns(poolHead->slab, ptr)) {
+        return (size <= OS_MEM_SLAB_OBJ_SIZE(OsMemSlabPageGet(poolHead->slab, ptr)->classIndex)) ? LOS_OK : LOS_NOK;
+    }
+#endif
+
+    MEM_LOCK(poolHead, intSave);
+    do {
+        /* Blocks from LOS_MemAllocAlign start after a gap that a resize in place would not keep. */
+        if (OsGetRealPtr(pool, ptr) != ptr) {
+            break;
+        }
+
+        node = (struct OsMemNodeHead *)((UINTPTR)ptr - OS_MEM_NODE_HEAD_SIZE);
+        if (OsMemCheckUsedNode(pool, node) != LOS_OK) {
+            break;
+        }
+
+        if (OsMemReAllocInPlace(poolHead, node, OS_MEM_ALIGN(size + OS_MEM_NODE_HEAD_SIZE, OS_MEM_ALIGN_SIZE))) {
+            ret = LOS_OK;
+        }
+    } while (0);
+    MEM_UNLOCK(poolHead, intSave);
+
+    return ret;
+}
+
+#if (LOSCFG_MEM_TCACHE == 1)
+#define OS_MEM_TCACHE_SHIFT         4
+#define OS_MEM_TCACHE_MAX_SIZE      (LOS_MEM_TCACHE_CLASS_NUM << OS_MEM_TCACHE_SHIFT)
+#define OS_MEM_TCACHE_INDEX(size)   (((size) - 1) >> OS_MEM_TCACHE_SHIFT)
+#define OS_MEM_TCACHE_SIZE(index)   (((index) + 1) << OS_MEM_TCACHE_SHIFT)
+/* Word of a cached block that holds the address of the owning cache, as a cheap double free check. */
+#define OS_MEM_TCACHE_KEY(ptr)      (((UINTPTR *)(ptr))[1])
+
+STATIC INLINE LosMemTcache *OsMemTcacheGet(VOID)
+{
+    /* An interrupt may land in the middle of the running task's cache update, so it goes to the pool. */
+    if (OS_INT_ACTIVE || !g_taskScheduled) {
+        return NULL;
+    }
+    return &g_losTask.runTask->memCache;
+}
+
+/* Size to ask the pool for on a miss, so that the block comes back to the class it was looked up in. */
+STATIC INLINE UINT32 OsMemTcacheClassSize(UINT32 size)
+{
+#if (LOSCFG_MEM_SLAB == 1)
+    if ((((struct OsMemPoolHead *)OS_SYS_MEM_ADDR)->slab != NULL) && (size <= OS_MEM_SLAB_MAX_SIZE)) {
+        return OS_MEM_SLAB_OBJ_SIZE(OsMemSlabClassGet(size));
+    }
+#endif
+    return (UINT32)OS_MEM_ALIGN(size, 1U << OS_MEM_TCACHE_SHIFT);
+}
+
+STATIC UINT32 OsMemTcacheUsableSize(struct OsMemPoolHead *pool, VOID *ptr, struct OsMemNodeHead **node)
+{
+    VOID *realPtr = NULL;
+
+    *node = NULL;
+    if (!OS_MEM_IS_ALIGNED(ptr, sizeof(VOID *))) {
+        return 0;
+    }
+
+#if (LOSCFG_MEM_SLAB == 1)
+    if (OsMemSlabOwns(pool->slab, ptr)) {
+        struct OsMemSlabPage *page = OsMemSlabPageGet(pool->slab, ptr);
+        return (page->usedNum != 0) ? OS_MEM_SLAB_OBJ_SIZE(page->classIndex) : 0;
+    }
+#endif
+
+    if (!OS_MEM_MIDDLE_ADDR_OPEN_END(OS_MEM_FIRST_NODE(pool), ptr, OS_MEM_END_NODE(pool, pool->info.totalSize))) {
+        return 0;
+    }
+    realPtr = OsGetRealPtr(pool, ptr);
+    if (realPtr == NULL) {
+        return 0;
+    }
+    *node = (struct OsMemNodeHead *)((UINTPTR)realPtr - OS_MEM_NODE_HEAD_SIZE);
+    if (!OS_MEM_NODE_GET_USED_FLAG((*node)->sizeAndFlag)) {
+        return 0;
+    }
+    return (UINT32)((UINTPTR)OS_MEM_NEXT_NODE(*node) - (UINTPTR)ptr);
+}
+
+VOID *LOS_MemTcacheAlloc(UINT32 size)
+{
+    LosMemTcache *cache = OsMemTcacheGet();
+    UINT32 index;
+    VOID *ptr = NULL;
+
+    if ((size == 0) || (size > OS_MEM_TCACHE_MAX_SIZE) || (cache == NULL)) {
+        return LOS_MemAlloc(OS_SYS_MEM_ADDR, size);
+    }
+
+    index = OS_MEM_TCACHE_INDEX(OsMemTcacheClassSize(size));
+    ptr = cache->head[index];
+    if (ptr == NULL) {
+        return LOS_MemAlloc(OS_SYS_MEM_ADDR, OS_MEM_TCACHE_SIZE(index));
+    }
+    cache->head[index] = *(VOID **)ptr;
+    cache->count[index]--;
+    OS_MEM_TCACHE_KEY(ptr) = 0;
+
+    OsHookCall(LOS_HOOK_TYPE_MEM_ALLOC, OS_SYS_MEM_ADDR, ptr, size);
+    return ptr;
+}
+
+UINT32 LOS_MemTcacheFree(VOID *ptr)
+{
+    struct OsMemPoolHead *pool = (struct OsMemPoolHead *)OS_SYS_MEM_ADDR;
+    LosMemTcache *cache = OsMemTcacheGet();
+    struct OsMemNodeHead *node = NULL;
+    UINT32 size;
+    UINT32 index;
+    VOID *tmpPtr = NULL;
+
+    if ((ptr == NULL) || (cache == NULL)) {
+        return LOS_MemFree(pool, ptr);
+    }
+
+    size = OsMemTcacheUsableSize(pool, ptr, &node);
+    if ((size < OS_MEM_TCACHE_SIZE(0)) || (size >= OS_MEM_TCACHE_SIZE(LOS_MEM_TCACHE_CLASS_NUM))) {
+        return LOS_MemFree(pool, ptr);
+    }
+    index = (size >> OS_MEM_TCACHE_SHIFT) - 1;
+    if (cache->count[index] >= LOSCFG_MEM_TCACHE_DEPTH) {
+        return LOS_MemFree(pool, ptr);
+    }
+
+    if (OS_MEM_TCACHE_KEY(ptr) == (UINTPTR)cache) {
+        for (tmpPtr = cache->head[index]; tmpPtr != NULL; tmpPtr = *(VOID **)tmpPtr) {
+            if (tmpPtr == ptr) {
+                PRINT_ERR("[%s] double free of %p\n", __FUNCTION__, ptr);
+                return LOS_NOK;
+            }
+        }
+    }
+
+    OsHookCall(LOS_HOOK_TYPE_MEM_FREE, OS_SYS_MEM_ADDR, ptr);
+#if (LOSCFG_MEM_FREE_BY_TASKID == 1)
+    /* The block now belongs to this task's cache, so LOS_MemFreeByTaskID of the old owner must not touch it. */
+    if (node != NULL) {
+        OsMemNodeSetTaskID((struct OsMemUsedNodeHead *)node);
+    }
+#endif
+    *(VOID **)ptr = cache->head[index];
+    OS_MEM_TCACHE_KEY(ptr) = (UINTPTR)cache;
+    cache->head[index] = ptr;
+    cache->count[index]++;
+    return LOS_OK;
+}
+
+VOID OsMemTcacheTake(UINT32 taskID, LosMemTcache *cache)
+{
+    LosTaskCB *taskCB = OS_TCB_FROM_TID(taskID);
+
+    (VOID)memcpy_s(cache, sizeof(LosMemTcache), &taskCB->memCache, sizeof(LosMemTcache));
+    (VOID)memset_s(&taskCB->memCache, sizeof(LosMemTcache), 0, sizeof(LosMemTcache));
+}
+
+VOID OsMemTcacheRelease(LosMemTcache *cache)
+{
+    VOID *next = NULL;
+    UINT32 index;
+
+    for (index = 0; index < LOS_MEM_TCACHE_CLASS_NUM; index++) {
+        while (cache->head[index] != NULL) {
+            next = *(VOID **)cache->head[index];
+            (VOID)LOS_MemFree(OS_SYS_MEM_ADDR, cache->head[index]);
+            cache->head[index] = next;
+        }
+    }
+}
+
+VOID OsMemTcacheFlush(UINT32 taskID)
+{
+    LosTaskCB *taskCB = OS_TCB_FROM_TID(taskID);
+    LosMemTcache cache;
+    UINT32 intSave;
+
+    intSave = LOS_IntLock();
+    /*
+     * The owner updates its cache without a lock, so another context may only take the cache of a task that
+     * cannot be stopped in the middle of LOS_MemTcacheAlloc or LOS_MemTcacheFree: one blocked in a kernel call.
+     */
+    if (((taskCB != g_losTask.runTask) || OS_INT_ACTIVE) &&
+        !(taskCB->taskStatus & (OS_TASK_STATUS_PEND | OS_TASK_STATUS_DELAY))) {
+        LOS_IntRestore(intSave);
+        return;
+    }
+    OsMemTcacheTake(taskID, &cache);
+    LOS_IntRestore(intSave);
+
+    OsMemTcacheRelease(&cache);
+}
+#endif
+
 #if (LOSCFG_MEM_FREE_BY_TASKID == 1)
 UINT32 LOS_MemFreeByTaskID(VOID *pool, UINT32 taskID)
 {
@@ -1415,6 +2272,12 @@ UINT32 LOS_MemFreeByTaskID(VOID *pool, UINT32 taskID)
     struct OsMemNodeHead *endNode = NULL;
     UINT32 intSave = 0;
 
+#if (LOSCFG_MEM_TCACHE == 1)
+    if (pool == OS_SYS_MEM_ADDR) {
+        OsMemTcacheFlush(taskID);
+    }
+#endif
+
     MEM_LOCK(poolHead, intSave);
     endNode = OS_MEM_END_NODE(pool, poolHead->info.totalSize);
     for (tmpNode = OS_MEM_FIRST_NODE(pool); tmpNode < endNode;
@@ -1814,6 +2677,75 @@ ERROR_OUT:
     return LOS_NOK;
 }
 
+#if (LOSCFG_MEM_BACKGROUND_CHECK == 1)
+/* Check up to nodeNum nodes from where the cursor stopped, wrapping around at the end of the pool. */
+STATIC UINT32 OsMemIntegrityCheckResume(const struct OsMemPoolHead *pool, UINT32 nodeNum,
+                                        struct OsMemNodeHead **tmpNode, struct OsMemNodeHead **preNode)
+{
+    struct OsMemNodeHead *endNode = g_memCheckCursor.endNode;
+    UINT32 count = 0;
+
+    if ((g_memCheckCursor.pool != pool) || (g_memCheckCursor.node == NULL)) {
+        *preNode = OS_MEM_FIRST_NODE(pool);
+        *tmpNode = *preNode;
+        endNode = OS_MEM_END_NODE(pool, pool->info.totalSize);
+    } else {
+        *preNode = g_memCheckCursor.node;
+        *tmpNode = OS_MEM_NEXT_NODE(*preNode);
+    }
+
+    while (count < nodeNum) {
+        if (*tmpNode >= endNode) {
+#if OS_MEM_EXPAND_ENABLE
+            if (OsMemIsLastSentinelNode(endNode) == FALSE) {
+                *tmpNode = OsMemSentinelNodeGet(endNode);
+                endNode = OS_MEM_END_NODE(*tmpNode, OS_MEM_NODE_GET_SIZE(endNode->sizeAndFlag));
+                *preNode = *tmpNode;
+                continue;
+            }
+#endif
+            *preNode = OS_MEM_FIRST_NODE(pool);
+            *tmpNode = *preNode;
+            endNode = OS_MEM_END_NODE(pool, pool->info.totalSize);
+        }
+        if (!OS_MEM_IS_GAP_NODE(*tmpNode)) {
+            if (OsMemIntegrityCheckSub(tmpNode, pool, endNode) == LOS_NOK) {
+                g_memCheckCursor.node = NULL;
+                return LOS_NOK;
+            }
+            *preNode = *tmpNode;
+        }
+        *tmpNode = OS_MEM_NEXT_NODE(*tmpNode);
+        count++;
+    }
+
+    g_memCheckCursor.pool = pool;
+    g_memCheckCursor.node = *preNode;
+    g_memCheckCursor.endNode = endNode;
+    return LOS_OK;
+}
+
+UINT32 LOS_MemIntegrityCheckStep(const VOID *pool, UINT32 nodeNum)
+{
+    if ((pool == NULL) || (nodeNum == 0)) {
+        return LOS_NOK;
+    }
+
+    struct OsMemPoolHead *poolHead = (struct OsMemPoolHead *)pool;
+    struct OsMemNodeHead *tmpNode = NULL;
+    struct OsMemNodeHead *preNode = NULL;
+    UINT32 intSave = 0;
+
+    MEM_LOCK(poolHead, intSave);
+    if (OsMemIntegrityCheckResume(poolHead, nodeNum, &tmpNode, &preNode)) {
+        OsMemIntegrityCheckError(poolHead, tmpNode, preNode, intSave);
+        return LOS_NOK;
+    }
+    MEM_UNLOCK(poolHead, intSave);
+    return LOS_OK;
+}
+#endif
+
 STATIC INLINE VOID OsMemInfoGet(struct OsMemPoolHead *poolInfo, struct OsMemNodeHead *node,
                 LOS_MEM_POOL_STATUS *poolStatus)
 {
@@ -1849,7 +2781,23 @@ STATIC INLINE VOID OsMemInfoGet(struct OsMemPoolHead *poolInfo, struct OsMemNode
     poolStatus->freeNodeNum += freeNodeNum;
 }
 
-UINT32 LOS_MemInfoGet(VOID *pool, LOS_MEM_POOL_STATUS *poolStatus)
+/* All the memory of a pool, whatever the attributes of its regions */
+#define OS_MEM_REGION_ATTR_ALL  0xFFFFFFFFU
+
+STATIC INLINE BOOL OsMemNodeAttrMatch(const struct OsMemPoolHead *poolInfo, const struct OsMemNodeHead *node,
+                                      UINT32 attr)
+{
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    return (attr == OS_MEM_REGION_ATTR_ALL) || (OsMemRegionAttrGet(poolInfo, node) == attr);
+#else
+    (VOID)poolInfo;
+    (VOID)node;
+    (VOID)attr;
+    return TRUE;
+#endif
+}
+
+STATIC UINT32 OsMemPoolStatusGet(VOID *pool, UINT32 attr, LOS_MEM_POOL_STATUS *poolStatus)
 {
     struct OsMemPoolHead *poolInfo = pool;
 
@@ -1875,8 +2823,10 @@ UINT32 LOS_MemInfoGet(VOID *pool, LOS_MEM_POOL_STATUS *poolStatus)
     UINT32 size;
     for (tmpNode = OS_MEM_FIRST_NODE(pool); tmpNode <= endNode; tmpNode = OS_MEM_NEXT_NODE(tmpNode)) {
         if (tmpNode == endNode) {
-            poolStatus->totalUsedSize += OS_MEM_NODE_HEAD_SIZE;
-            poolStatus->usedNodeNum++;
+            if (OsMemNodeAttrMatch(poolInfo, tmpNode, attr)) {
+                poolStatus->totalUsedSize += OS_MEM_NODE_HEAD_SIZE;
+                poolStatus->usedNodeNum++;
+            }
             if (OsMemIsLastSentinelNode(endNode) == FALSE) {
                 size = OS_MEM_NODE_GET_SIZE(endNode->sizeAndFlag);
                 tmpNode = OsMemSentinelNodeGet(endNode);
@@ -1885,23 +2835,164 @@ UINT32 LOS_MemInfoGet(VOID *pool, LOS_MEM_POOL_STATUS *poolStatus)
             } else {
                 break;
             }
-        } else {
+        } else if (OsMemNodeAttrMatch(poolInfo, tmpNode, attr)) {
             OsMemInfoGet(poolInfo, tmpNode, poolStatus);
         }
     }
 #else
     for (tmpNode = OS_MEM_FIRST_NODE(pool); tmpNode < endNode; tmpNode = OS_MEM_NEXT_NODE(tmpNode)) {
-        OsMemInfoGet(poolInfo, tmpNode, poolStatus);
+        if (OsMemNodeAttrMatch(poolInfo, tmpNode, attr)) {
+            OsMemInfoGet(poolInfo, tmpNode, poolStatus);
+        }
     }
 #endif
+    if (attr == OS_MEM_REGION_ATTR_ALL) {
 #if (LOSCFG_MEM_WATERLINE == 1)
-    poolStatus->usageWaterLine = poolInfo->info.waterLine;
+        poolStatus->usageWaterLine = poolInfo->info.waterLine;
 #endif
+#if (LOSCFG_MEM_SLAB == 1)
+        OsMemSlabInfoGet(poolInfo->slab, poolStatus);
+#endif
+    }
     MEM_UNLOCK(poolInfo, intSave);
 
     return LOS_OK;
 }
 
+UINT32 LOS_MemInfoGet(VOID *pool, LOS_MEM_POOL_STATUS *poolStatus)
+{
+    return OsMemPoolStatusGet(pool, OS_MEM_REGION_ATTR_ALL, poolStatus);
+}
+
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+UINT32 LOS_MemTierInfoGet(VOID *pool, UINT32 attr, LOS_MEM_POOL_STATUS *poolStatus)
+{
+    if (attr == OS_MEM_REGION_ATTR_ALL) {
+        return LOS_NOK;
+    }
+    return OsMemPoolStatusGet(pool, attr, poolStatus);
+}
+#endif
+
+STATIC INLINE BOOL OsMemFragIsAllocation(const struct OsMemNodeHead *node)
+{
+    return (OS_MEM_NODE_GET_USED_FLAG(node->sizeAndFlag) && !OS_MEM_IS_GAP_NODE(node));
+}
+
+/* Keep the largest free nodes in descending order of size, with the allocations on both sides of them. */
+STATIC VOID OsMemFragGapRecord(LOS_MEM_FRAG_INFO *fragInfo, const struct OsMemNodeHead *node,
+                               const struct OsMemNodeHead *endNode)
+{
+    UINT32 size = OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
+    const struct OsMemNodeHead *prevNode = node->ptr.prev;
+    const struct OsMemNodeHead *nextNode = OS_MEM_NEXT_NODE(node);
+    LOS_MEM_FRAG_GAP *gap = NULL;
+    UINT32 index;
+
+    for (index = 0; index < LOS_MEM_FRAG_GAP_NUM; index++) {
+        if (fragInfo->gap[index].size < size) {
+            break;
+        }
+    }
+    if (index == LOS_MEM_FRAG_GAP_NUM) {
+        return;
+    }
+
+    gap = &fragInfo->gap[index];
+    if (index < (LOS_MEM_FRAG_GAP_NUM - 1)) {
+        (VOID)memmove_s(gap + 1, sizeof(LOS_MEM_FRAG_GAP) * (LOS_MEM_FRAG_GAP_NUM - index - 1),
+                        gap, sizeof(LOS_MEM_FRAG_GAP) * (LOS_MEM_FRAG_GAP_NUM - index - 1));
+    }
+    (VOID)memset_s(gap, sizeof(LOS_MEM_FRAG_GAP), 0, sizeof(LOS_MEM_FRAG_GAP));
+    gap->size = size;
+
+    /* The first node of a region points back to the sentinel at its end. */
+    if ((prevNode != NULL) && (prevNode < node) && OsMemFragIsAllocation(prevNode)) {
+        gap->prevUsed = (VOID *)((UINTPTR)prevNode + OS_MEM_NODE_HEAD_SIZE);
+#if (LOSCFG_MEM_LEAKCHECK == 1)
+        (VOID)memcpy_s(gap->prevLR, sizeof(gap->prevLR), prevNode->linkReg, sizeof(prevNode->linkReg));
+#endif
+    }
+    if ((nextNode != endNode) && OsMemFragIsAllocation(nextNode)) {
+        gap->nextUsed = (VOID *)((UINTPTR)nextNode + OS_MEM_NODE_HEAD_SIZE);
+#if (LOSCFG_MEM_LEAKCHECK == 1)
+        (VOID)memcpy_s(gap->nextLR, sizeof(gap->nextLR), nextNode->linkReg, sizeof(nextNode->linkReg));
+#endif
+    }
+}
+
+STATIC VOID OsMemFragNodeGet(LOS_MEM_FRAG_INFO *fragInfo, const struct OsMemNodeHead *node,
+                             const struct OsMemNodeHead *endNode)
+{
+    UINT32 size;
+
+    if (OS_MEM_NODE_GET_USED_FLAG(node->sizeAndFlag)) {
+        return;
+    }
+
+    size = OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
+    fragInfo->totalFreeSize += size;
+    fragInfo->freeNodeNum++;
+    if (size > fragInfo->maxFreeNodeSize) {
+        fragInfo->maxFreeNodeSize = size;
+    }
+    fragInfo->freeNodeHist[OsMemLog2(size)]++;
+    OsMemFragGapRecord(fragInfo, node, endNode);
+}
+
+UINT32 LOS_MemFragInfoGet(VOID *pool, LOS_MEM_FRAG_INFO *fragInfo)
+{
+    struct OsMemPoolHead *poolInfo = pool;
+
+    if (fragInfo == NULL) {
+        PRINT_ERR("can't use NULL addr to save info\n");
+        return LOS_NOK;
+    }
+
+    if ((pool == NULL) || (poolInfo->info.pool != pool)) {
+        PRINT_ERR("wrong mem pool addr: 0x%x, line:%d\n", (UINTPTR)poolInfo, __LINE__);
+        return LOS_NOK;
+    }
+
+    (VOID)memset_s(fragInfo, sizeof(LOS_MEM_FRAG_INFO), 0, sizeof(LOS_MEM_FRAG_INFO));
+
+    struct OsMemNodeHead *tmpNode = NULL;
+    struct OsMemNodeHead *endNode = NULL;
+    UINT32 intSave = 0;
+
+    MEM_LOCK(poolInfo, intSave);
+    endNode = OS_MEM_END_NODE(pool, poolInfo->info.totalSize);
+#if OS_MEM_EXPAND_ENABLE
+    UINT32 size;
+    for (tmpNode = OS_MEM_FIRST_NODE(pool); tmpNode <= endNode; tmpNode = OS_MEM_NEXT_NODE(tmpNode)) {
+        if (tmpNode == endNode) {
+            if (OsMemIsLastSentinelNode(endNode) == FALSE) {
+                size = OS_MEM_NODE_GET_SIZE(endNode->sizeAndFlag);
+                tmpNode = OsMemSentinelNodeGet(endNode);
+                endNode = OS_MEM_END_NODE(tmpNode, size);
+                continue;
+            } else {
+                break;
+            }
+        } else {
+            OsMemFragNodeGet(fragInfo, tmpNode, endNode);
+        }
+    }
+#else
+    for (tmpNode = OS_MEM_FIRST_NODE(pool); tmpNode < endNode; tmpNode = OS_MEM_NEXT_NODE(tmpNode)) {
+        OsMemFragNodeGet(fragInfo, tmpNode, endNode);
+    }
+#endif
+    MEM_UNLOCK(poolInfo, intSave);
+
+    if (fragInfo->totalFreeSize != 0) {
+        /* 100: percent */
+        fragInfo->maxFreeRatio = (UINT32)(((UINT64)fragInfo->maxFreeNodeSize * 100) / fragInfo->totalFreeSize);
+    }
+
+    return LOS_OK;
+}
+
 STATIC VOID OsMemInfoPrint(VOID *pool)
 {
 #if (LOSCFG_KERNEL_PRINTF != 0)
@@ -1931,6 +3022,18 @@ STATIC VOID OsMemInfoPrint(VOID *pool)
            status.totalFreeSize, status.maxFreeNodeSize, status.usedNodeNum,
            status.freeNodeNum);
 #endif
+#if (LOSCFG_MEM_SLAB == 1)
+    if (poolInfo->slab != NULL) {
+        UINT32 index;
+        PRINTK("slab object size   page num     used obj num  free obj num   (free page num: %u)\n",
+               status.slabFreePageNum);
+        for (index = 0; index < LOS_MEM_SLAB_CLASS_NUM; index++) {
+            PRINTK("0x%-14x   0x%-8x   0x%-8x    0x%-8x\n", status.slabStatus[index].objSize,
+                   status.slabStatus[index].pageNum, status.slabStatus[index].usedObjNum,
+                   status.slabStatus[index].freeObjNum);
+        }
+    }
+#endif
 #endif
 }
 
@@ -1998,6 +3101,7 @@ STATIC INLINE UINT32 OsMemMulRegionsParamCheck(VOID *pool, const LosMemRegion *
     UINT32 lastLength;
     UINT32 curLength;
     UINT32 regionCount;
+    UINT32 tierNum = 0;
 
     if ((pool != NULL) && (((struct OsMemPoolHead *)pool)->info.pool != pool)) {
         PRINT_ERR("wrong mem pool addr: %p, func: %s, line: %d\n", pool, __FUNCTION__, __LINE__);
@@ -2007,6 +3111,7 @@ STATIC INLINE UINT32 OsMemMulRegionsParamCheck(VOID *pool, const LosMemRegion *
     if (pool != NULL) {
         lastStartAddress = pool;
         lastLength = ((struct OsMemPoolHead *)pool)->info.totalSize;
+        tierNum = ((struct OsMemPoolHead *)pool)->tierNum;
     }
 
     memRegion = memRegions;
@@ -2028,6 +3133,15 @@ STATIC INLINE UINT32 OsMemMulRegionsParamCheck(VOID *pool, const LosMemRegion *
                      (UINTPTR)lastStartAddress, lastLength, (UINTPTR)curStartAddress);
             return LOS_NOK;
         }
+        if (memRegion->attr & LOS_MEM_HINT_STRICT) {
+            PRINT_ERR("Memory region attributes configured wrongly:address:0x%x, the attributes:0x%x\n", \
+                     (UINTPTR)curStartAddress, memRegion->attr);
+            return LOS_NOK;
+        }
+        if ((memRegion->attr != 0) && (++tierNum > LOSCFG_MEM_REGION_TIER_NUM)) {
+            PRINT_ERR("Too many memory regions with attributes, the maximum:%u\n", LOSCFG_MEM_REGION_TIER_NUM);
+            return LOS_NOK;
+        }
         memRegion++;
         regionCount++;
         lastStartAddress = curStartAddress;
@@ -2036,6 +3150,32 @@ STATIC INLINE UINT32 OsMemMulRegionsParamCheck(VOID *pool, const LosMemRegion *
     return LOS_OK;
 }
 
+STATIC INLINE VOID OsMemRegionTierAdd(struct OsMemPoolHead *poolHead, const LosMemRegion *memRegion)
+{
+    struct OsMemRegionTier *tier = NULL;
+    struct OsMemFreeNodeHead *node = NULL;
+    UINT32 index;
+
+    if (memRegion->attr == 0) {
+        return;
+    }
+
+    tier = &poolHead->tier[poolHead->tierNum];
+    tier->start = (UINTPTR)memRegion->startAddress;
+    tier->end = tier->start + memRegion->length;
+    tier->attr = memRegion->attr;
+    tier->freeSize = 0;
+    /* The free node of the region is already in the lists, added before the region was known as a tier. */
+    for (index = 0; index < OS_MEM_FREE_LIST_COUNT; index++) {
+        for (node = poolHead->freeList[index]; node != NULL; node = node->next) {
+            if (OS_MEM_MIDDLE_ADDR_OPEN_END(tier->start, node, tier->end)) {
+                tier->freeSize += OS_MEM_NODE_GET_SIZE(node->header.sizeAndFlag);
+            }
+        }
+    }
+    poolHead->tierNum++;
+}
+
 STATIC INLINE VOID OsMemMulRegionsLink(struct OsMemPoolHead *poolHead, VOID *lastStartAddress, UINT32 lastLength, struct OsMemNodeHead *lastEndNode, const LosMemRegion *memRegion)
 {
     UINT32 curLength;
@@ -2109,6 +3249,7 @@ UINT32 LOS_MemRegionsAdd(VOID *pool, const LosMemRegion *const memRegions, UINT3
         if (ret != LOS_OK) {
             return ret;
         }
+        OsMemRegionTierAdd(poolHead, memRegion);
         memRegion++;
         regionCount++;
     }
@@ -2120,6 +3261,7 @@ UINT32 LOS_MemRegionsAdd(VOID *pool, const LosMemRegion *const memRegions, UINT3
         curLength = memRegion->length;
 
         OsMemMulRegionsLink(poolHead, lastStartAddress, lastLength, lastEndNode, memRegion);
+        OsMemRegionTierAdd(poolHead, memRegion);
         lastStartAddress = curStartAddress;
         lastLength = curLength;
         lastEndNode = OS_MEM_END_NODE(curStartAddress, curLength);
@@ -2144,6 +3286,11 @@ UINT32 OsMemSystemInit(VOID)
 
     ret = LOS_MemInit(m_aucSysMem0, LOSCFG_SYS_HEAP_SIZE);
     PRINT_INFO("LiteOS heap memory address:%p, size:0x%lx\n", m_aucSysMem0, LOSCFG_SYS_HEAP_SIZE);
+#if (LOSCFG_MEM_SLAB == 1)
+    if (ret == LOS_OK) {
+        OsMemSlabInit((struct OsMemPoolHead *)m_aucSysMem0, LOSCFG_MEM_SLAB_ARENA_SIZE);
+    }
+#endif
     return ret;
 }
 
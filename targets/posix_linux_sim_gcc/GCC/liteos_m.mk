@@ -0,0 +1,48 @@
+LITEOSTOPDIR := ../../../
+LITEOSTOPDIR := $(realpath $(LITEOSTOPDIR))
+
+# third party code lives next to the kernel in the OpenHarmony tree, kal/cmsis/cmsis_os2.h expects it there
+THIRDPARTYDIR ?= $(LITEOSTOPDIR)/../../third_party
+THIRDPARTYDIR := $(realpath $(THIRDPARTYDIR))
+
+# Common
+C_SOURCES     += $(wildcard $(LITEOSTOPDIR)/kernel/src/*.c) \
+                 $(wildcard $(LITEOSTOPDIR)/kernel/src/mm/*.c) \
+                 $(wildcard $(LITEOSTOPDIR)/components/cpup/*.c) \
+                 $(wildcard $(LITEOSTOPDIR)/components/power/*.c) \
+                 $(wildcard $(LITEOSTOPDIR)/utils/*.c)
+
+C_INCLUDES    += -I$(LITEOSTOPDIR)/utils \
+                 -I$(LITEOSTOPDIR)/kernel/include \
+                 -I$(LITEOSTOPDIR)/components/cpup \
+                 -I$(LITEOSTOPDIR)/components/power
+
+# KAL, only CMSIS: the posix KAL is written against the LiteOS libc headers and clashes with the host libc
+C_SOURCES     += $(wildcard $(LITEOSTOPDIR)/kal/cmsis/*.c)
+
+C_INCLUDES    += -I$(LITEOSTOPDIR)/kal/cmsis \
+                 -I$(THIRDPARTYDIR)/cmsis/CMSIS/RTOS2/Include
+
+# kernel test suite
+C_SOURCES     += $(wildcard $(LITEOSTOPDIR)/testsuits/src/*.c) \
+                 $(filter-out $(LITEOSTOPDIR)/testsuits/sample/kernel/dynlink/%, \
+                              $(wildcard $(LITEOSTOPDIR)/testsuits/sample/kernel/*/*.c))
+
+C_INCLUDES    += -I$(LITEOSTOPDIR)/testsuits/include
+
+# the memory tests still size some pools with the old doubly linked list names, as in testsuits/sample/kernel/mem/BUILD.gn
+C_DEFS        += -DLOS_DLNK_NODE_HEAD_SIZE=0 \
+                 -DMIN_DLNK_POOL_SIZE=0
+
+#third party related
+C_INCLUDES    += -I$(THIRDPARTYDIR)/bounds_checking_function/include \
+                 -I$(THIRDPARTYDIR)/bounds_checking_function/src
+
+C_SOURCES     += $(wildcard $(THIRDPARTYDIR)/bounds_checking_function/src/*.c)
+
+# posix simulation port
+C_SOURCES     += $(wildcard $(LITEOSTOPDIR)/kernel/arch/posix/gcc/*.c)
+
+C_INCLUDES    += -I. \
+                 -I$(LITEOSTOPDIR)/kernel/arch/include \
+                 -I$(LITEOSTOPDIR)/kernel/arch/posix/gcc
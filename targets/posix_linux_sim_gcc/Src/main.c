@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "los_config.h"
+#include "los_debug.h"
+#include "los_task.h"
+#include "los_arch_timer.h"
+
+#define SIM_TEST_TASK_PRIO          25
+#define SIM_TEST_TASK_STACK_SIZE    0x1000
+
+extern VOID TestTaskEntry(VOID);
+extern UINT32 g_failResult;
+extern UINT32 g_testTskHandle;
+
+STATIC VOID SimTestEntry(VOID)
+{
+    TestTaskEntry();
+
+#if (LOSCFG_ARCH_POSIX_VIRTUAL_TIME == 1)
+    /* Equal between two runs of the same build when the run is reproducible. */
+    printf("virtual time: %llu cycles\n", (unsigned long long)HalVirtualTimeGet());
+#endif
+    /* The exit status tells scripts whether the kernel test suite passed. */
+    exit((g_failResult == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main(VOID)
+{
+    UINT32 ret;
+    TSK_INIT_PARAM_S taskParam = {0};
+
+    (VOID)setvbuf(stdout, NULL, _IONBF, 0);
+
+    ret = LOS_KernelInit();
+    if (ret != LOS_OK) {
+        PRINT_ERR("LOS_KernelInit failed: 0x%x\n", ret);
+        return EXIT_FAILURE;
+    }
+
+    taskParam.pfnTaskEntry = (TSK_ENTRY_FUNC)SimTestEntry;
+    taskParam.uwStackSize = SIM_TEST_TASK_STACK_SIZE;
+    taskParam.pcName = "SimTest";
+    taskParam.usTaskPrio = SIM_TEST_TASK_PRIO;
+    ret = LOS_TaskCreate(&g_testTskHandle, &taskParam);
+    if (ret != LOS_OK) {
+        PRINT_ERR("SimTest task create failed: 0x%x\n", ret);
+        return EXIT_FAILURE;
+    }
+
+    (VOID)LOS_Start();
+    return EXIT_FAILURE;
+}
@@ -32,6 +32,7 @@
 #ifndef _OSTEST_H
 #define _OSTEST_H
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -76,6 +77,12 @@ extern "C" {
 #define LOS_KERNEL_IPC_SEM_TEST 1
 #define LOS_KERNEL_IPC_EVENT_TEST 1
 #define LOS_KERNEL_IPC_QUEUE_TEST 1
+#define LOS_KERNEL_IPC_STREAMBUF_TEST LOSCFG_BASE_IPC_STREAMBUF
+#define LOS_KERNEL_IPC_QUEUESET_TEST LOSCFG_BASE_IPC_QUEUESET
+#define LOS_KERNEL_IPC_RWLOCK_TEST LOSCFG_BASE_IPC_RWLOCK
+#define LOS_KERNEL_IPC_CONDVAR_TEST LOSCFG_BASE_IPC_CONDVAR
+#define LOS_KERNEL_IPC_BARRIER_TEST LOSCFG_BASE_IPC_BARRIER
+#define LOS_KERNEL_ATOMIC_TEST 1
 #define LOS_KERNEL_CORE_SWTMR_TEST 1
 #ifndef LOS_KERNEL_HWI_TEST
 #define LOS_KERNEL_HWI_TEST 1
@@ -328,6 +335,12 @@ typedef struct tagHwiHandleForm {
 
 extern VOID ItSuiteLosTask(void);
 extern VOID ItSuiteLosQueue(void);
+extern VOID ItSuiteLosStreambuf(void);
+extern VOID ItSuiteLosQueueset(void);
+extern VOID ItSuiteLosRwlock(void);
+extern VOID ItSuiteLosCondvar(void);
+extern VOID ItSuiteLosBarrier(void);
+extern VOID ItSuiteLosAtomic(void);
 extern VOID ItSuiteLosMux(void);
 extern VOID ItSuiteLosEvent(void);
 extern VOID ItSuiteLosSem(void);
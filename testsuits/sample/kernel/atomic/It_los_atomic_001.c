@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include "It_los_atomic.h"
+
+
+static UINT32 Testcase(VOID)
+{
+    INT32 ret;
+    INT64 ret64;
+    BOOL bitRet;
+
+    LOS_AtomicSet(&g_testAtomic, 0x10);
+    ret = LOS_AtomicAdd(&g_testAtomic, 0x5);
+    ICUNIT_ASSERT_EQUAL(ret, 0x15, ret);
+    ret = LOS_AtomicSub(&g_testAtomic, 0x20);
+    ICUNIT_ASSERT_EQUAL(ret, -0xB, ret);
+    LOS_AtomicInc(&g_testAtomic);
+    ret = LOS_AtomicIncRet(&g_testAtomic);
+    ICUNIT_ASSERT_EQUAL(ret, -0x9, ret);
+    LOS_AtomicDec(&g_testAtomic);
+    ret = LOS_AtomicDecRet(&g_testAtomic);
+    ICUNIT_ASSERT_EQUAL(ret, -0xB, ret);
+
+    ret = LOS_AtomicXchg32bits(&g_testAtomic, 0x100);
+    ICUNIT_ASSERT_EQUAL(ret, -0xB, ret);
+    bitRet = LOS_AtomicCmpXchg32bits(&g_testAtomic, 0x200, 0x101);
+    ICUNIT_ASSERT_EQUAL(bitRet, TRUE, bitRet);
+    ret = LOS_AtomicRead(&g_testAtomic);
+    ICUNIT_ASSERT_EQUAL(ret, 0x100, ret);
+    bitRet = LOS_AtomicCmpXchg32bits(&g_testAtomic, 0x200, 0x100);
+    ICUNIT_ASSERT_EQUAL(bitRet, FALSE, bitRet);
+    ret = LOS_AtomicLoadAcquire(&g_testAtomic);
+    ICUNIT_ASSERT_EQUAL(ret, 0x200, ret);
+
+    /* Bit operations return the previous state. */
+    LOS_AtomicStoreRelease(&g_testAtomic, 0x1);
+    ret = LOS_AtomicFetchOr(&g_testAtomic, 0x6);
+    ICUNIT_ASSERT_EQUAL(ret, 0x1, ret);
+    ret = LOS_AtomicFetchAnd(&g_testAtomic, 0x5);
+    ICUNIT_ASSERT_EQUAL(ret, 0x7, ret);
+    bitRet = LOS_AtomicBitSet(&g_testAtomic, 31); // 31, the sign bit.
+    ICUNIT_ASSERT_EQUAL(bitRet, FALSE, bitRet);
+    bitRet = LOS_AtomicBitSet(&g_testAtomic, 31); // 31, the sign bit.
+    ICUNIT_ASSERT_EQUAL(bitRet, TRUE, bitRet);
+    bitRet = LOS_AtomicBitClear(&g_testAtomic, 0);
+    ICUNIT_ASSERT_EQUAL(bitRet, TRUE, bitRet);
+    bitRet = LOS_AtomicBitClear(&g_testAtomic, 1);
+    ICUNIT_ASSERT_EQUAL(bitRet, FALSE, bitRet);
+    ret = LOS_AtomicRead(&g_testAtomic);
+    ICUNIT_ASSERT_EQUAL(ret, (INT32)0x80000004, ret);
+
+    /* 64-bit values carry across the 32-bit halves. */
+    LOS_Atomic64Set(&g_testAtomic64, 0xFFFFFFFFLL);
+    ret64 = LOS_Atomic64IncRet(&g_testAtomic64);
+    ICUNIT_ASSERT_EQUAL(ret64 == 0x100000000LL, TRUE, ret64);
+    ret64 = LOS_Atomic64Sub(&g_testAtomic64, 0x100000001LL);
+    ICUNIT_ASSERT_EQUAL(ret64 == -1, TRUE, ret64);
+    LOS_Atomic64Inc(&g_testAtomic64);
+    LOS_Atomic64Dec(&g_testAtomic64);
+    ret64 = LOS_Atomic64DecRet(&g_testAtomic64);
+    ICUNIT_ASSERT_EQUAL(ret64 == -2, TRUE, ret64);
+    ret64 = LOS_Atomic64Add(&g_testAtomic64, 0x200000002LL);
+    ICUNIT_ASSERT_EQUAL(ret64 == 0x200000000LL, TRUE, ret64);
+    ret64 = LOS_AtomicXchg64bits(&g_testAtomic64, 0x1);
+    ICUNIT_ASSERT_EQUAL(ret64 == 0x200000000LL, TRUE, ret64);
+    bitRet = LOS_AtomicCmpXchg64bits(&g_testAtomic64, 0x100000000LL, 0x2);
+    ICUNIT_ASSERT_EQUAL(bitRet, TRUE, bitRet);
+    bitRet = LOS_AtomicCmpXchg64bits(&g_testAtomic64, 0x100000000LL, 0x1);
+    ICUNIT_ASSERT_EQUAL(bitRet, FALSE, bitRet);
+    ret64 = LOS_Atomic64Read(&g_testAtomic64);
+    ICUNIT_ASSERT_EQUAL(ret64 == 0x100000000LL, TRUE, ret64);
+
+    return LOS_OK;
+}
+
+VOID ItLosAtomic001(VOID)
+{
+    TEST_ADD_CASE("ItLosAtomic001", Testcase, TEST_LOS, TEST_ATO, TEST_LEVEL0, TEST_FUNCTION);
+}
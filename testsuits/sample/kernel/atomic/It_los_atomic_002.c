@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include "It_los_atomic.h"
+
+static Atomic g_doneCount;
+
+static VOID TaskF01(VOID)
+{
+    UINT32 index;
+
+    for (index = 0; index < ATOMIC_LOOP_NUM; index++) {
+        LOS_AtomicInc(&g_testAtomic);
+        LOS_Atomic64Add(&g_testAtomic64, 0x100000001LL);
+    }
+    LOS_AtomicInc(&g_doneCount);
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    INT64 ret64;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.usTaskPrio = TASK_PRIO_TEST + 1;
+    task1.uwResved = LOS_TASK_STATUS_DETACHED;
+
+    LOS_AtomicSet(&g_testAtomic, 0);
+    LOS_AtomicSet(&g_doneCount, 0);
+    LOS_Atomic64Set(&g_testAtomic64, 0);
+
+    /* Equal priority tasks are time sliced, so the updates interleave. */
+    task1.pcName = "TskAtomic2A";
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    task1.pcName = "TskAtomic2B";
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    for (index = 0; (index < 100) && (LOS_AtomicRead(&g_doneCount) != 2); index++) { // 100 ticks, 2 tasks.
+        LOS_TaskDelay(1);
+    }
+    ICUNIT_GOTO_EQUAL(LOS_AtomicRead(&g_doneCount), 2, g_doneCount, EXIT); // 2, both tasks finished.
+
+    ICUNIT_ASSERT_EQUAL(LOS_AtomicRead(&g_testAtomic), ATOMIC_LOOP_NUM * 2, g_testAtomic); // 2 tasks.
+    ret64 = LOS_Atomic64Read(&g_testAtomic64);
+    ICUNIT_ASSERT_EQUAL(ret64 == (0x100000001LL * ATOMIC_LOOP_NUM * 2), TRUE, ret64); // 2 tasks.
+
+    return LOS_OK;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+    LOS_TaskDelete(g_testTaskID02);
+    return LOS_OK;
+}
+
+VOID ItLosAtomic002(VOID)
+{
+    TEST_ADD_CASE("ItLosAtomic002", Testcase, TEST_LOS, TEST_ATO, TEST_LEVEL1, TEST_FUNCTION);
+}
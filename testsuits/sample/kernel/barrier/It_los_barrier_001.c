@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_barrier.h"
+
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    BOOL isLast = FALSE;
+
+    ret = LOS_BarrierCreate(1, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_BARRIER_PTR_NULL, ret);
+    ret = LOS_BarrierCreate(0, &g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_BARRIER_COUNT_INVALID, ret);
+    ret = LOS_BarrierWait(LOSCFG_BASE_IPC_BARRIER_LIMIT, LOS_NO_WAIT, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_BARRIER_INVALID, ret);
+
+    /* A barrier of one never blocks and every caller releases it. */
+    ret = LOS_BarrierCreate(1, &g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_BarrierWait(g_testBarrierID, LOS_NO_WAIT, &isLast);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(isLast, TRUE, isLast, EXIT);
+    ret = LOS_BarrierDelete(g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    /* A task that gives up waiting is no longer counted as arrived. */
+    ret = LOS_BarrierCreate(2, &g_testBarrierID); // 2, the caller and one more task.
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_BarrierWait(g_testBarrierID, LOS_NO_WAIT, &isLast);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_BARRIER_TIMEOUT, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(isLast, FALSE, isLast, EXIT);
+    ret = LOS_BarrierWait(g_testBarrierID, 2, &isLast); // 2, wait two ticks.
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_BARRIER_TIMEOUT, ret, EXIT);
+    ret = LOS_BarrierDelete(g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_BarrierDelete(g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_BARRIER_INVALID, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_BarrierDelete(g_testBarrierID);
+    return LOS_OK;
+}
+
+VOID ItLosBarrier001(VOID)
+{
+    TEST_ADD_CASE("ItLosBarrier001", Testcase, TEST_LOS, TEST_SEM, TEST_LEVEL0, TEST_FUNCTION);
+}
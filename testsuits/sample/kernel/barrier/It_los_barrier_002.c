@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_barrier.h"
+
+#define BARRIER_TASK_NUM    3
+#define BARRIER_ROUND_NUM   2
+
+static UINT32 g_passedCount;
+static UINT32 g_serialCount;
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+    UINT32 round;
+    BOOL isLast = FALSE;
+
+    for (round = 0; round < BARRIER_ROUND_NUM; round++) {
+        g_testCount++;
+        ret = LOS_BarrierWait(g_testBarrierID, LOS_WAIT_FOREVER, &isLast);
+        ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+        if (isLast) {
+            g_serialCount++;
+        }
+        g_passedCount++;
+    }
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 round;
+    BOOL isLast = FALSE;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+    task1.uwResved = LOS_TASK_STATUS_DETACHED;
+
+    g_testCount = 0;
+    g_passedCount = 0;
+    g_serialCount = 0;
+
+    ret = LOS_BarrierCreate(BARRIER_TASK_NUM + 1, &g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    task1.pcName = "TskBarrier2A";
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    task1.pcName = "TskBarrier2B";
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    task1.pcName = "TskBarrier2C";
+    ret = LOS_TaskCreate(&g_testTaskID03, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    for (round = 1; round <= BARRIER_ROUND_NUM; round++) {
+        /* The tasks wait until the test task arrives last and releases them all at once. */
+        ICUNIT_GOTO_EQUAL(g_testCount, BARRIER_TASK_NUM * round, g_testCount, EXIT);
+        ICUNIT_GOTO_EQUAL(g_passedCount, BARRIER_TASK_NUM * (round - 1), g_passedCount, EXIT);
+
+        ret = LOS_BarrierDelete(g_testBarrierID);
+        ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_BARRIER_PENDED, ret, EXIT);
+
+        ret = LOS_BarrierWait(g_testBarrierID, LOS_WAIT_FOREVER, &isLast);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+        ICUNIT_GOTO_EQUAL(isLast, TRUE, isLast, EXIT);
+    }
+
+    ICUNIT_GOTO_EQUAL(g_passedCount, BARRIER_TASK_NUM * BARRIER_ROUND_NUM, g_passedCount, EXIT);
+    ICUNIT_GOTO_EQUAL(g_serialCount, 0, g_serialCount, EXIT);
+
+    ret = LOS_BarrierDelete(g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+    LOS_TaskDelete(g_testTaskID02);
+    LOS_TaskDelete(g_testTaskID03);
+    LOS_BarrierDelete(g_testBarrierID);
+    return LOS_OK;
+}
+
+VOID ItLosBarrier002(VOID)
+{
+    TEST_ADD_CASE("ItLosBarrier002", Testcase, TEST_LOS, TEST_SEM, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_barrier.h"
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    g_testCount++;
+    ret = LOS_BarrierWait(g_testBarrierID, LOS_WAIT_FOREVER, NULL);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    g_testCount++;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    BOOL isLast = FALSE;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "TskBarrier3";
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+    task1.uwResved = LOS_TASK_STATUS_DETACHED;
+
+    g_testCount = 0;
+
+    ret = LOS_BarrierCreate(2, &g_testBarrierID); // 2: the waiting task and the test task
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT);
+
+    /* The deleted waiter no longer counts, so the test task alone does not release the barrier. */
+    ret = LOS_TaskDelete(g_testTaskID01);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_BarrierWait(g_testBarrierID, 0, &isLast);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_BARRIER_TIMEOUT, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(isLast, FALSE, isLast, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT);
+
+    ret = LOS_BarrierDelete(g_testBarrierID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+    LOS_BarrierDelete(g_testBarrierID);
+    return LOS_OK;
+}
+
+VOID ItLosBarrier003(VOID)
+{
+    TEST_ADD_CASE("ItLosBarrier003", Testcase, TEST_LOS, TEST_SEM, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_condvar.h"
+
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_CondCreate(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_CONDVAR_PTR_NULL, ret);
+    ret = LOS_CondCreate(&g_testCondID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_MuxCreate(&g_testCondMuxID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    /* The mutex must be held exactly once by the waiter. */
+    ret = LOS_CondWait(g_testCondID, g_testCondMuxID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_CONDVAR_MUX_INVALID, ret, EXIT);
+    ret = LOS_MuxPend(g_testCondMuxID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MuxPend(g_testCondMuxID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_CondWait(g_testCondID, g_testCondMuxID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_CONDVAR_MUX_INVALID, ret, EXIT);
+    ret = LOS_MuxPost(g_testCondMuxID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* A signal with no waiter is lost, and the mutex is held again after a timeout. */
+    ret = LOS_CondSignal(g_testCondID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_CondWait(g_testCondID, g_testCondMuxID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_CONDVAR_TIMEOUT, ret, EXIT);
+    ret = LOS_CondWait(g_testCondID, g_testCondMuxID, 2); // 2, timeout in ticks.
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_CONDVAR_TIMEOUT, ret, EXIT);
+    ret = LOS_MuxPost(g_testCondMuxID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MuxPost(g_testCondMuxID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_MUX_INVALID, ret, EXIT);
+
+    ret = LOS_MuxDelete(g_testCondMuxID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ret = LOS_CondDelete(g_testCondID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_CondSignal(g_testCondID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_CONDVAR_INVALID, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_MuxPost(g_testCondMuxID);
+    LOS_MuxDelete(g_testCondMuxID);
+EXIT1:
+    LOS_CondDelete(g_testCondID);
+    return LOS_OK;
+}
+
+VOID ItLosCondvar001(VOID)
+{
+    TEST_ADD_CASE("ItLosCondvar001", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL0, TEST_FUNCTION);
+}
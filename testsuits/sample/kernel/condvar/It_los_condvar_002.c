@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_condvar.h"
+
+static UINT32 g_wokenCount;
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_MuxPend(g_testCondMuxID, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+
+    g_testCount++;
+
+    ret = LOS_CondWait(g_testCondID, g_testCondMuxID, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+
+    g_wokenCount++;
+
+    ret = LOS_MuxPost(g_testCondMuxID);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+    task1.uwResved = LOS_TASK_STATUS_DETACHED;
+
+    g_testCount = 0;
+    g_wokenCount = 0;
+
+    ret = LOS_CondCreate(&g_testCondID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_MuxCreate(&g_testCondMuxID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    task1.pcName = "TskCondvar2A";
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    task1.pcName = "TskCondvar2B";
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    task1.pcName = "TskCondvar2C";
+    ret = LOS_TaskCreate(&g_testTaskID03, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 3, g_testCount, EXIT); // 3, all tasks wait on the condition.
+
+    ret = LOS_CondDelete(g_testCondID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_CONDVAR_PENDED, ret, EXIT);
+
+    /* A signal wakes exactly one waiter. */
+    ret = LOS_CondSignal(g_testCondID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_wokenCount, 1, g_wokenCount, EXIT);
+
+    /* A broadcast wakes the rest. */
+    ret = LOS_CondBroadcast(g_testCondID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_wokenCount, 3, g_wokenCount, EXIT); // 3, all tasks have woken.
+
+    ret = LOS_MuxDelete(g_testCondMuxID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ret = LOS_CondDelete(g_testCondID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+    LOS_TaskDelete(g_testTaskID02);
+    LOS_TaskDelete(g_testTaskID03);
+    LOS_MuxDelete(g_testCondMuxID);
+EXIT1:
+    LOS_CondDelete(g_testCondID);
+    return LOS_OK;
+}
+
+VOID ItLosCondvar002(VOID)
+{
+    TEST_ADD_CASE("ItLosCondvar002", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "osTest.h"
+#include "It_los_event.h"
+
+#define EVENT_BIT_LOW      0x1
+#define EVENT_BIT_HIGH     0x100
+#define EVENT_MASK_AND     0x6
+
+static UINT32 g_wokenMask;
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_EventRead(&g_pevent, EVENT_BIT_LOW, LOS_WAITMODE_OR, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, EVENT_BIT_LOW, ret);
+    g_wokenMask |= 0x1;
+}
+
+static VOID TaskF02(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_EventRead(&g_pevent, EVENT_BIT_HIGH, LOS_WAITMODE_OR | LOS_WAITMODE_CLR, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, EVENT_BIT_HIGH, ret);
+    g_wokenMask |= 0x2;
+}
+
+static VOID TaskF03(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_EventRead(&g_pevent, EVENT_MASK_AND, LOS_WAITMODE_AND, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, EVENT_MASK_AND, ret);
+    g_wokenMask |= 0x4;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+    task1.uwResved = LOS_TASK_STATUS_DETACHED;
+
+    g_wokenMask = 0;
+    ret = LOS_EventInit(&g_pevent);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.pcName = "EventTsk44A";
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task1.pcName = "EventTsk44B";
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF03;
+    task1.pcName = "EventTsk44C";
+    ret = LOS_TaskCreate(&g_testTaskID03, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+#if (LOSCFG_BASE_IPC_EVENT_WAIT_BUCKETS > 0)
+    /* The single bit waiters share the bucket of bit 0, the AND waiter on two buckets stays on the event list. */
+    ICUNIT_GOTO_EQUAL(LOS_ListEmpty(&g_pevent.waitBucket[0]), FALSE, 0, EXIT3);
+    ICUNIT_GOTO_EQUAL(LOS_ListEmpty(&g_pevent.stEventList), FALSE, 0, EXIT3);
+    ICUNIT_GOTO_EQUAL(g_pevent.stEventList.pstNext->pstNext, &g_pevent.stEventList, 0, EXIT3);
+#endif
+
+    /* Only the waiter on the written bit wakes, even when other waiters wait on a bit sharing its wait list. */
+    ret = LOS_EventWrite(&g_pevent, EVENT_BIT_HIGH);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ICUNIT_GOTO_EQUAL(g_wokenMask, 0x2, g_wokenMask, EXIT3);
+    ICUNIT_GOTO_EQUAL(g_pevent.uwEventID, 0, g_pevent.uwEventID, EXIT3);
+
+    /* An AND waiter wakes once all of its bits are set. */
+    ret = LOS_EventWrite(&g_pevent, 0x2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ICUNIT_GOTO_EQUAL(g_wokenMask, 0x2, g_wokenMask, EXIT3);
+    ret = LOS_EventWrite(&g_pevent, 0x4);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ICUNIT_GOTO_EQUAL(g_wokenMask, 0x6, g_wokenMask, EXIT3); // 0x6, the second and third tasks have woken.
+
+    ret = LOS_EventDestroy(&g_pevent);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_EVENT_SHOULD_NOT_DESTROYED, ret, EXIT3);
+
+    ret = LOS_EventWrite(&g_pevent, EVENT_BIT_LOW);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ICUNIT_GOTO_EQUAL(g_wokenMask, 0x7, g_wokenMask, EXIT3); // 0x7, all three tasks have woken.
+
+    ret = LOS_EventDestroy(&g_pevent);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT3:
+    LOS_TaskDelete(g_testTaskID03);
+EXIT2:
+    LOS_TaskDelete(g_testTaskID02);
+EXIT1:
+    LOS_TaskDelete(g_testTaskID01);
+EXIT:
+    LOS_EventDestroy(&g_pevent);
+    return LOS_OK;
+}
+
+VOID ItLosEvent044(VOID) // IT_Layer_ModuleORFeature_No
+{
+    TEST_ADD_CASE("ItLosEvent044", Testcase, TEST_LOS, TEST_EVENT, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -116,15 +116,35 @@ struct TestMemPoolInfo {
     UINT32 waterLine;   /* Maximum usage size in a memory pool */
     UINT32 curUsedSize; /* Current usage size in a memory pool */
 #endif
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    UINT32 totalGapSize;
+#endif
 };
 
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+struct TestMemRegionTier {
+    UINTPTR start;
+    UINTPTR end;
+    UINT32 attr;
+    UINT32 freeSize;
+};
+#endif
+
 struct TestMemPoolHead {
     struct TestMemPoolInfo info;
+    UINT32 freeListWordBitmap;
     UINT32 freeListBitmap[OS_MEM_BITMAP_WORDS];
     struct TestMemFreeNodeHead *freeList[OS_MEM_FREE_LIST_COUNT];
 #if (LOSCFG_MEM_MUL_POOL == 1)
     VOID *nextPool;
 #endif
+#if (LOSCFG_MEM_SLAB == 1)
+    VOID *slab;
+#endif
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    UINT32 tierNum;
+    struct TestMemRegionTier tier[LOSCFG_MEM_REGION_TIER_NUM];
+#endif
 };
 
 #define LOS_MEM_NODE_HEAD_SIZE sizeof(struct TestMemUsedNodeHead)
@@ -187,7 +207,18 @@ VOID ItLosMem044(void);
 VOID ItLosMem045(void);
 VOID ItLosMem046(void);
 VOID ItLosMem047(void);
+VOID ItLosMem048(void);
+VOID ItLosMem049(void);
+VOID ItLosMem050(void);
+VOID ItLosMem051(void);
+VOID ItLosMem052(void);
+VOID ItLosMem053(void);
+VOID ItLosMem054(void);
+VOID ItLosMem055(void);
+VOID ItLosMem056(void);
+VOID ItLosMem057(void);
 VOID ItLosMem058(void);
+VOID ItLosMem059(void);
 VOID ItLosMem063(void);
 VOID ItLosMem064(void);
 VOID ItLosMem065(void);
@@ -34,10 +34,14 @@
 
 #if (LOSCFG_MEM_MUL_REGIONS == 1)
 
-// simulate two non-continuous memory regions
-STATIC UINT8 g_memPool_TC46_01[0x200];
-STATIC UINT8 g_memGap_TC46[0x10];
-STATIC UINT8 g_memPool_TC46_02[0x400];
+// simulate two non-continuous memory regions, carved out of one buffer so that their order does not depend on the linker
+#define TC46_REGION1_SIZE   0x200
+#define TC46_GAP_SIZE       0x10
+#define TC46_REGION2_SIZE   0x400
+STATIC UINTPTR g_memBuf_TC46[(TC46_REGION1_SIZE + TC46_GAP_SIZE + TC46_REGION2_SIZE) / sizeof(UINTPTR)];
+#define TC46_POOL1  ((UINT8 *)g_memBuf_TC46)
+#define TC46_GAP    (TC46_POOL1 + TC46_REGION1_SIZE)
+#define TC46_POOL2  (TC46_GAP + TC46_GAP_SIZE)
 
 static UINT32 TestCase(VOID)
 {
@@ -45,8 +49,8 @@ static UINT32 TestCase(VOID)
     void *p = NULL;
     LosMemRegion memRegions[] =
         {
-            {g_memPool_TC46_01, 0x200},
-            {g_memPool_TC46_02, 0x400}
+            {TC46_POOL1, 0x200},
+            {TC46_POOL2, 0x400}
         };
 
     // Initialize the LOS_MemRegionsAdd
@@ -55,9 +59,9 @@ static UINT32 TestCase(VOID)
         return ret;
     }
 
-    // p points to the start address of the gap node between g_memPool_TC46_01 and g_memPool_TC46_02
-    p = g_memPool_TC46_01 + 0x200;
-    (void)memset_s(g_memGap_TC46, 0x10, 1, 0x10);
+    // p points to the start address of the gap node between TC46_POOL1 and TC46_POOL2
+    p = TC46_POOL1 + 0x200;
+    (void)memset_s(TC46_GAP, 0x10, 1, 0x10);
 
     ret = LOS_MemFree(m_aucSysMem0, p);
     ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
@@ -34,11 +34,16 @@
 
 #if (LOSCFG_MEM_MUL_REGIONS == 1)
 
-// simulate two non-continuous memory regions
-STATIC UINT8 g_memGap_TC47_Gap1[0x10];
-STATIC UINT8 g_memPool_TC47_01[0x1000];
-STATIC UINT8 g_memGap_TC47_Gap2[0x10];
-STATIC UINT8 g_memPool_TC47_02[0x400];
+// simulate two non-continuous memory regions, carved out of one buffer so that their order does not depend on the linker
+#define TC47_GAP_SIZE       0x10
+#define TC47_REGION1_SIZE   0x1000
+#define TC47_REGION2_SIZE   0x400
+#define TC47_BUF_SIZE       (TC47_GAP_SIZE + TC47_REGION1_SIZE + TC47_GAP_SIZE + TC47_REGION2_SIZE)
+STATIC UINTPTR g_memBuf_TC47[TC47_BUF_SIZE / sizeof(UINTPTR)];
+#define TC47_GAP1   ((UINT8 *)g_memBuf_TC47)
+#define TC47_POOL1  (TC47_GAP1 + TC47_GAP_SIZE)
+#define TC47_GAP2   (TC47_POOL1 + TC47_REGION1_SIZE)
+#define TC47_POOL2  (TC47_GAP2 + TC47_GAP_SIZE)
 
 static UINT32 TestCase(VOID)
 {
@@ -47,8 +52,8 @@ static UINT32 TestCase(VOID)
     void *p = NULL;
     LosMemRegion memRegions[] =
         {
-            {g_memPool_TC47_01, 0x1000},
-            {g_memPool_TC47_02, 0x400}
+            {TC47_POOL1, 0x1000},
+            {TC47_POOL2, 0x400}
         };
 
     // Initialize the LOS_MemRegionsAdd
@@ -57,20 +62,20 @@ static UINT32 TestCase(VOID)
         return ret;
     }
 
-    // p points to the start address of the gap node between g_memPool_TC47_01 and g_memPool_TC47_02
-    p = g_memPool_TC47_01 + 0x1000;
-    ret = LOS_MemFree((void *)&g_memPool_TC47_01, p);
+    // p points to the start address of the gap node between TC47_POOL1 and TC47_POOL2
+    p = TC47_POOL1 + 0x1000;
+    ret = LOS_MemFree((void *)TC47_POOL1, p);
     ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
 
     size = 0x100;
-    p = LOS_MemAlloc((void *)&g_memPool_TC47_01, size);
+    p = LOS_MemAlloc((void *)TC47_POOL1, size);
     ICUNIT_ASSERT_NOT_EQUAL(p, NULL, 0);
 
     (void)memset_s(p, size, 1, size);
-    (void)memset_s(g_memGap_TC47_Gap1, 0x10, 1, 0x10);
-    (void)memset_s(g_memGap_TC47_Gap2, 0x10, 1, 0x10);
+    (void)memset_s(TC47_GAP1, 0x10, 1, 0x10);
+    (void)memset_s(TC47_GAP2, 0x10, 1, 0x10);
 
-    ret = LOS_MemFree((void *)&g_memPool_TC47_01, p);
+    ret = LOS_MemFree((void *)TC47_POOL1, p);
     ICUNIT_ASSERT_EQUAL(ret, LOS_OK, 0);
     return LOS_OK;
 }
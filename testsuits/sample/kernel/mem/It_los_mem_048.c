@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#if (LOSCFG_MEM_SLAB == 1)
+#define SLAB_TEST_OBJ_NUM   8
+#define SLAB_TEST_OBJ_SIZE  24
+#define SLAB_TEST_CLASS     1 // 1, objects of 17 to 32 bytes.
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT32 usedObjNum;
+    VOID *obj[SLAB_TEST_OBJ_NUM] = { NULL };
+    VOID *ptr = NULL;
+    LOS_MEM_POOL_STATUS status = { 0 };
+
+    ret = LOS_MemInfoGet(m_aucSysMem0, &status);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(status.slabStatus[SLAB_TEST_CLASS].objSize, 32, status.slabStatus[SLAB_TEST_CLASS].objSize);
+    usedObjNum = status.slabStatus[SLAB_TEST_CLASS].usedObjNum;
+
+    for (index = 0; index < SLAB_TEST_OBJ_NUM; index++) {
+        obj[index] = LOS_MemAlloc(m_aucSysMem0, SLAB_TEST_OBJ_SIZE);
+        ICUNIT_GOTO_NOT_EQUAL(obj[index], NULL, obj[index], EXIT);
+        (VOID)memset_s(obj[index], SLAB_TEST_OBJ_SIZE, index, SLAB_TEST_OBJ_SIZE);
+    }
+
+    ret = LOS_MemInfoGet(m_aucSysMem0, &status);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(status.slabStatus[SLAB_TEST_CLASS].usedObjNum, usedObjNum + SLAB_TEST_OBJ_NUM,
+                      status.slabStatus[SLAB_TEST_CLASS].usedObjNum, EXIT);
+
+    /* A request that still fits the object stays in place, a larger one moves with its contents. */
+    ptr = LOS_MemRealloc(m_aucSysMem0, obj[1], SLAB_TEST_OBJ_SIZE + 4); // 4, still within 32 bytes.
+    ICUNIT_GOTO_EQUAL(ptr, obj[1], ptr, EXIT);
+    ptr = LOS_MemRealloc(m_aucSysMem0, obj[1], 0x100);
+    ICUNIT_GOTO_NOT_EQUAL(ptr, NULL, ptr, EXIT);
+    obj[1] = ptr;
+    ICUNIT_GOTO_EQUAL(*((UINT8 *)ptr + SLAB_TEST_OBJ_SIZE - 1), 1, *((UINT8 *)ptr + SLAB_TEST_OBJ_SIZE - 1), EXIT);
+
+    ret = LOS_MemIntegrityCheck(m_aucSysMem0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* The page of the object still has objects in use, so a second free has to be caught by the object itself. */
+    ptr = obj[0];
+    ret = LOS_MemFree(m_aucSysMem0, ptr);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    obj[0] = NULL;
+    ret = LOS_MemFree(m_aucSysMem0, ptr);
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+    ret = LOS_MemFree(m_aucSysMem0, (UINT8 *)obj[2] + 16); // 16, inside the 32-byte object.
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+
+EXIT:
+    for (index = 0; index < SLAB_TEST_OBJ_NUM; index++) {
+        if (obj[index] != NULL) {
+            ret = LOS_MemFree(m_aucSysMem0, obj[index]);
+            ICUNIT_TRACK_EQUAL(ret, LOS_OK, ret);
+        }
+    }
+
+    ret = LOS_MemInfoGet(m_aucSysMem0, &status);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(status.slabStatus[SLAB_TEST_CLASS].usedObjNum, usedObjNum,
+                        status.slabStatus[SLAB_TEST_CLASS].usedObjNum);
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem048(void)
+{
+#if (LOSCFG_MEM_SLAB == 1)
+    TEST_ADD_CASE("ItLosMem048", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
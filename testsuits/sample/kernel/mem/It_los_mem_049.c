@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#if (LOSCFG_MEM_TCACHE == 1)
+#define TCACHE_TEST_SIZE   40
+#define TCACHE_TEST_DELAY  100
+
+static VOID TaskF01(VOID)
+{
+    VOID *ptr = LOS_MemTcacheAlloc(TCACHE_TEST_SIZE);
+    ICUNIT_ASSERT_NOT_EQUAL_VOID(ptr, NULL, ptr);
+    (VOID)LOS_MemTcacheFree(ptr);
+    g_testCount++;
+
+    /* The block stays in this task's cache until the task is deleted. */
+    (VOID)LOS_TaskDelay(TCACHE_TEST_DELAY);
+}
+
+static VOID TaskF02(VOID)
+{
+    VOID *ptr = LOS_MemTcacheAlloc(TCACHE_TEST_SIZE);
+    ICUNIT_ASSERT_NOT_EQUAL_VOID(ptr, NULL, ptr);
+    (VOID)LOS_MemTcacheFree(ptr);
+    g_testCount++;
+
+    /* Returning deletes the task, which gives back its cache itself. */
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 usedSize;
+    VOID *ptr = NULL;
+    VOID *newPtr = NULL;
+    TSK_INIT_PARAM_S task = { 0 };
+
+    ptr = LOS_MemTcacheAlloc(TCACHE_TEST_SIZE);
+    ICUNIT_ASSERT_NOT_EQUAL(ptr, NULL, ptr);
+    usedSize = LOS_MemTotalUsedGet(m_aucSysMem0);
+
+    /* A cached block stays allocated in the pool and is handed back to the next request of its class. */
+    ret = LOS_MemTcacheFree(ptr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(LOS_MemTotalUsedGet(m_aucSysMem0), usedSize, usedSize);
+
+    ret = LOS_MemTcacheFree(ptr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    newPtr = LOS_MemTcacheAlloc(TCACHE_TEST_SIZE - 1);
+    ICUNIT_ASSERT_EQUAL(newPtr, ptr, newPtr);
+    ret = LOS_MemTcacheFree(newPtr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    /* Deleting a task gives its cached blocks back to the pool. */
+    (VOID)LOS_TaskDelay(1); // 1, let the idle task free the stacks of tasks that deleted themselves.
+    usedSize = LOS_MemTotalUsedGet(m_aucSysMem0);
+    g_testCount = 0;
+    task.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task.pcName = "MemTsk049";
+    task.uwStackSize = TASK_STACK_SIZE_TEST;
+    task.usTaskPrio = TASK_PRIO_TEST - 1;
+    ret = LOS_TaskCreate(&g_testTaskID01, &task);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT);
+
+EXIT:
+    ret = LOS_TaskDelete(g_testTaskID01);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(LOS_MemTotalUsedGet(m_aucSysMem0), usedSize, usedSize);
+
+    task.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    ret = LOS_TaskCreate(&g_testTaskID01, &task);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(g_testCount, 2, g_testCount); // 2, both tasks have run.
+    (VOID)LOS_TaskDelay(1); // 1, let the idle task free the stack of the deleted task.
+    ICUNIT_ASSERT_EQUAL(LOS_MemTotalUsedGet(m_aucSysMem0), usedSize, usedSize);
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem049(void)
+{
+#if (LOSCFG_MEM_TCACHE == 1)
+    TEST_ADD_CASE("ItLosMem049", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
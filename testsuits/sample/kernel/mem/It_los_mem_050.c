@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#define FREE_BLOCK_NUM      6
+#define GUARD_SIZE          0x10
+
+/* Blocks left free between used guards, so that free lists in several bitmap words are non-empty. */
+static const UINT32 g_freeBlockSize[FREE_BLOCK_NUM] = { 0x20, 0x48, 0x90, 0x128, 0x260, 0x500 };
+
+/* The free list of a block of size bytes, header included, computed as the allocator does. */
+static UINT32 FreeListIndexGet(UINT32 size)
+{
+    UINT32 log = 0;
+
+    if (size < OS_MEM_SMALL_BUCKET_MAX_SIZE) {
+        return (size >> 2) - 1; /* 2: The small bucket setup is 4. */
+    }
+    while ((size >> (log + 1)) != 0) {
+        log++;
+    }
+    return OS_MEM_SMALL_BUCKET_COUNT + ((log - OS_MEM_LARGE_START_BUCKET) << OS_MEM_SLI) +
+           (((size << OS_MEM_SLI) >> log) - OS_MEM_FREE_LIST_NUM);
+}
+
+/* The smallest block size of free list index. */
+static UINT32 FreeListSizeGet(UINT32 index)
+{
+    UINT32 log;
+
+    if (index < OS_MEM_SMALL_BUCKET_COUNT) {
+        return (index + 1) << 2; /* 2: The small bucket setup is 4. */
+    }
+    index -= OS_MEM_SMALL_BUCKET_COUNT;
+    log = (index >> OS_MEM_SLI) + OS_MEM_LARGE_START_BUCKET;
+    return (OS_MEM_FREE_LIST_NUM + (index & (OS_MEM_FREE_LIST_NUM - 1))) << (log - OS_MEM_SLI);
+}
+
+static UINT32 FirstBitGet(UINT32 bitmap)
+{
+    return 31 - CLZ(bitmap & (~bitmap + 1)); /* 31: The highest bit of a word. */
+}
+
+/* Reference search: the first non-empty free list from index on, looking at every list. */
+static UINT32 NotEmptyIndexScan(const struct TestMemPoolHead *head, UINT32 index)
+{
+    for (; index < OS_MEM_FREE_LIST_COUNT; index++) {
+        if (head->freeList[index] != NULL) {
+            return index;
+        }
+    }
+    return OS_MEM_FREE_LIST_COUNT;
+}
+
+/* The same search through the two bitmap levels, the way the allocator does it. */
+static UINT32 NotEmptyIndexSearch(const struct TestMemPoolHead *head, UINT32 index)
+{
+    UINT32 word = index >> 5; /* 5: Divide by 32 to get the bitmap word. */
+    UINT32 mask = head->freeListBitmap[word] & ~((1U << (index & 0x1f)) - 1);
+
+    if (mask == 0) {
+        mask = head->freeListWordBitmap & ~((2U << word) - 1); /* 2: Skip the words up to and including word. */
+        if (mask == 0) {
+            return OS_MEM_FREE_LIST_COUNT;
+        }
+        word = FirstBitGet(mask);
+        mask = head->freeListBitmap[word];
+    }
+    return FirstBitGet(mask) + (word << 5); /* 5: Multiply by 32 to get the first index of the word. */
+}
+
+/* Both bitmap levels match the free lists, and the two-level search matches the reference for every class. */
+static UINT32 BitmapCheck(const struct TestMemPoolHead *head)
+{
+    UINT32 index;
+    UINT32 word;
+    BOOL set;
+
+    for (index = 0; index < OS_MEM_FREE_LIST_COUNT; index++) {
+        set = (head->freeListBitmap[index >> 5] & (1U << (index & 0x1f))) != 0; /* 5: Bitmap word. */
+        ICUNIT_ASSERT_EQUAL(set, (head->freeList[index] != NULL), index);
+        ICUNIT_ASSERT_EQUAL(NotEmptyIndexSearch(head, index), NotEmptyIndexScan(head, index), index);
+    }
+    for (word = 0; word < OS_MEM_BITMAP_WORDS; word++) {
+        set = (head->freeListWordBitmap & (1U << word)) != 0;
+        ICUNIT_ASSERT_EQUAL(set, (head->freeListBitmap[word] != 0), word);
+    }
+    return LOS_OK;
+}
+
+/* Ask for the smallest block of every class, and check it comes from the list the reference search picks. */
+static UINT32 AllocCheck(struct TestMemPoolHead *head)
+{
+    struct TestMemFreeNodeHead *expect = NULL;
+    UINT32 index;
+    UINT32 size;
+    UINT32 found;
+    UINT32 ret;
+    VOID *ptr = NULL;
+
+    for (index = 0; index < OS_MEM_FREE_LIST_COUNT; index++) {
+        size = FreeListSizeGet(index);
+        if (size >= TEST_MEM_SIZE) {
+            break;
+        }
+        if ((size <= LOS_MEM_NODE_HEAD_SIZE) || ((size & (sizeof(UINTPTR) - 1)) != 0) ||
+            (FreeListIndexGet(size) != index)) {
+            continue;
+        }
+
+        /* A large list may hold blocks smaller than the request, so the search starts one list above it. */
+        found = NotEmptyIndexScan(head, (index < OS_MEM_SMALL_BUCKET_COUNT) ? index : (index + 1));
+        expect = (found < OS_MEM_FREE_LIST_COUNT) ? head->freeList[found] : head->freeList[index];
+
+        ptr = LOS_MemAlloc(head, size - LOS_MEM_NODE_HEAD_SIZE);
+        if (expect == NULL) {
+            ICUNIT_ASSERT_EQUAL(ptr, NULL, index);
+            continue;
+        }
+        ICUNIT_ASSERT_EQUAL((UINTPTR)ptr - LOS_MEM_NODE_HEAD_SIZE, (UINTPTR)expect, index);
+        ret = LOS_MemFree(head, ptr);
+        ICUNIT_ASSERT_EQUAL(ret, LOS_OK, index);
+    }
+    return LOS_OK;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    VOID *block[FREE_BLOCK_NUM] = { NULL };
+
+    MemStart();
+    MemInit();
+
+    ret = BitmapCheck((struct TestMemPoolHead *)g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    for (index = 0; index < FREE_BLOCK_NUM; index++) {
+        block[index] = LOS_MemAlloc(g_memPool, g_freeBlockSize[index]);
+        ICUNIT_GOTO_NOT_EQUAL(block[index], NULL, index, EXIT);
+        ICUNIT_GOTO_NOT_EQUAL(LOS_MemAlloc(g_memPool, GUARD_SIZE), NULL, index, EXIT);
+    }
+    for (index = 0; index < FREE_BLOCK_NUM; index++) {
+        ret = LOS_MemFree(g_memPool, block[index]);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    }
+
+    ret = BitmapCheck((struct TestMemPoolHead *)g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = AllocCheck((struct TestMemPoolHead *)g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* Taking the blocks back empties whole bitmap words, whose first level bits must go too. */
+    for (index = 0; index < FREE_BLOCK_NUM; index++) {
+        ICUNIT_GOTO_NOT_EQUAL(LOS_MemAlloc(g_memPool, g_freeBlockSize[index]), NULL, index, EXIT);
+        ret = BitmapCheck((struct TestMemPoolHead *)g_memPool);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    }
+
+EXIT:
+    MemFree();
+    MemEnd();
+    return LOS_OK;
+}
+
+VOID ItLosMem050(void)
+{
+    TEST_ADD_CASE("ItLosMem050", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#define REALLOC_BLOCK_NUM   4
+#define REALLOC_BLOCK_SIZE  0x100
+#define REALLOC_PREV_SIZE   0x180
+#define REALLOC_BOTH_SIZE   0x280
+#define REALLOC_PATTERN     0x5A
+
+static UINT32 BlocksAlloc(VOID **ptr)
+{
+    UINT32 index;
+
+    for (index = 0; index < REALLOC_BLOCK_NUM; index++) {
+        ptr[index] = LOS_MemAlloc(g_memPool, REALLOC_BLOCK_SIZE);
+        if (ptr[index] == NULL) {
+            return LOS_NOK;
+        }
+    }
+    (VOID)memset_s(ptr[1], REALLOC_BLOCK_SIZE, REALLOC_PATTERN, REALLOC_BLOCK_SIZE);
+    return LOS_OK;
+}
+
+static UINT32 PatternCheck(const VOID *ptr)
+{
+    UINT32 index;
+
+    for (index = 0; index < REALLOC_BLOCK_SIZE; index++) {
+        if (((const UINT8 *)ptr)[index] != REALLOC_PATTERN) {
+            return LOS_NOK;
+        }
+    }
+    return LOS_OK;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    VOID *ptr[REALLOC_BLOCK_NUM] = { NULL };
+    VOID *newPtr = NULL;
+
+    MemStart();
+    MemInit();
+
+    /* Grow into the free block before: the payload moves down to its start. */
+    ret = BlocksAlloc(ptr);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MemFree(g_memPool, ptr[0]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_MemReallocInPlace(g_memPool, ptr[1], REALLOC_PREV_SIZE);
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+    newPtr = LOS_MemRealloc(g_memPool, ptr[1], REALLOC_PREV_SIZE);
+    ICUNIT_GOTO_EQUAL(newPtr, ptr[0], newPtr, EXIT);
+    ret = PatternCheck(newPtr);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MemIntegrityCheck(g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    (VOID)LOS_MemFree(g_memPool, newPtr);
+    (VOID)LOS_MemFree(g_memPool, ptr[2]); // 2, the third block.
+    (VOID)LOS_MemFree(g_memPool, ptr[3]); // 3, the last block.
+
+    /* Grow in place into the free block after, then into the free blocks on both sides. */
+    ret = BlocksAlloc(ptr);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MemFree(g_memPool, ptr[0]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MemFree(g_memPool, ptr[2]); // 2, the third block.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_MemReallocInPlace(g_memPool, ptr[1], REALLOC_BOTH_SIZE);
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+    ret = LOS_MemReallocInPlace(g_memPool, ptr[1], REALLOC_PREV_SIZE);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = PatternCheck(ptr[1]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    newPtr = LOS_MemRealloc(g_memPool, ptr[1], REALLOC_BOTH_SIZE);
+    ICUNIT_GOTO_EQUAL(newPtr, ptr[0], newPtr, EXIT);
+    ret = PatternCheck(newPtr);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MemIntegrityCheck(g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    MemFree();
+    MemEnd();
+    return LOS_OK;
+}
+
+VOID ItLosMem051(void)
+{
+    TEST_ADD_CASE("ItLosMem051", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+}
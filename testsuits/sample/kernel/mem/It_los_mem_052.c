@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#define FRAG_BLOCK_NUM   5
+#define FRAG_BLOCK_SIZE  0x100
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT32 histNum = 0;
+    UINT32 ratio;
+    VOID *ptr[FRAG_BLOCK_NUM] = { NULL };
+    LOS_MEM_FRAG_INFO fragInfo;
+
+    MemStart();
+    MemInit();
+
+    ret = LOS_MemFragInfoGet(g_memPool, NULL);
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+
+    for (index = 0; index < FRAG_BLOCK_NUM; index++) {
+        ptr[index] = LOS_MemAlloc(g_memPool, FRAG_BLOCK_SIZE);
+        ICUNIT_GOTO_NOT_EQUAL(ptr[index], NULL, ptr[index], EXIT);
+    }
+    (VOID)LOS_MemFree(g_memPool, ptr[1]);
+    (VOID)LOS_MemFree(g_memPool, ptr[3]); // 3, the fourth block.
+
+    ret = LOS_MemFragInfoGet(g_memPool, &fragInfo);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.freeNodeNum, 3, fragInfo.freeNodeNum, EXIT); // 3, two holes and the tail.
+    for (index = 0; index < LOS_MEM_FRAG_CLASS_NUM; index++) {
+        histNum += fragInfo.freeNodeHist[index];
+    }
+    ICUNIT_GOTO_EQUAL(histNum, fragInfo.freeNodeNum, histNum, EXIT);
+    ratio = (UINT32)(((UINT64)fragInfo.maxFreeNodeSize * 100) / fragInfo.totalFreeSize); // 100: percent
+    ICUNIT_GOTO_EQUAL(fragInfo.maxFreeRatio, ratio, fragInfo.maxFreeRatio, EXIT);
+
+    /* The tail of the pool is the largest free node, behind the last block. */
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[0].size, fragInfo.maxFreeNodeSize, fragInfo.gap[0].size, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[0].prevUsed, ptr[4], fragInfo.gap[0].prevUsed, EXIT); // 4, the last block.
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[0].nextUsed, NULL, fragInfo.gap[0].nextUsed, EXIT);
+
+    /* The two holes have the same size and are reported in address order. */
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[1].size, fragInfo.gap[2].size, fragInfo.gap[1].size, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[1].prevUsed, ptr[0], fragInfo.gap[1].prevUsed, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[1].nextUsed, ptr[2], fragInfo.gap[1].nextUsed, EXIT); // 2, the third block.
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[2].prevUsed, ptr[2], fragInfo.gap[2].prevUsed, EXIT); // 2, the third block.
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[2].nextUsed, ptr[4], fragInfo.gap[2].nextUsed, EXIT); // 4, the last block.
+    ICUNIT_GOTO_EQUAL(fragInfo.gap[3].size, 0, fragInfo.gap[3].size, EXIT); // 3, no fourth free node.
+
+EXIT:
+    MemFree();
+    MemEnd();
+    return LOS_OK;
+}
+
+VOID ItLosMem052(void)
+{
+    TEST_ADD_CASE("ItLosMem052", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#if (LOSCFG_MEM_PROFILE == 1)
+#define PROFILE_BLOCK_NUM   3
+#define PROFILE_BLOCK_SIZE  0x100
+
+static LOS_MEM_PROFILE_SITE g_sites[LOSCFG_MEM_PROFILE_SITE_NUM + 1];
+
+static UINT32 LiveSizeGet(VOID)
+{
+    UINT32 num = LOSCFG_MEM_PROFILE_SITE_NUM + 1;
+    UINT32 liveSize = 0;
+    UINT32 index;
+
+    if (LOS_MemProfileGet(g_sites, &num) != LOS_OK) {
+        return 0;
+    }
+    for (index = 0; index < num; index++) {
+        if ((index > 0) && (g_sites[index - 1].liveSize < g_sites[index].liveSize)) {
+            return 0;
+        }
+        liveSize += g_sites[index].liveSize;
+    }
+    return liveSize;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT32 liveSize;
+    UINT32 usedSize;
+    UINT32 num = 1;
+    VOID *ptr[PROFILE_BLOCK_NUM] = { NULL };
+
+    ret = LOS_MemProfileGet(NULL, &num);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+    ret = LOS_MemProfileGet(g_sites, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    MemStart();
+    MemInit();
+    LOS_TaskLock();
+
+    liveSize = LiveSizeGet();
+    ICUNIT_GOTO_NOT_EQUAL(liveSize, 0, liveSize, EXIT);
+    usedSize = LOS_MemTotalUsedGet(g_memPool);
+    for (index = 0; index < PROFILE_BLOCK_NUM; index++) {
+        ptr[index] = LOS_MemAlloc(g_memPool, PROFILE_BLOCK_SIZE);
+        ICUNIT_GOTO_NOT_EQUAL(ptr[index], NULL, ptr[index], EXIT);
+    }
+
+    /* Every byte taken from the pool is charged to a call site. */
+    ret = LiveSizeGet() - liveSize;
+    ICUNIT_GOTO_EQUAL(ret, LOS_MemTotalUsedGet(g_memPool) - usedSize, ret, EXIT);
+
+    num = 1;
+    ret = LOS_MemProfileGet(g_sites, &num);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(num, 1, num, EXIT);
+
+    for (index = 0; index < PROFILE_BLOCK_NUM; index++) {
+        (VOID)LOS_MemFree(g_memPool, ptr[index]);
+        ptr[index] = NULL;
+    }
+    ret = LiveSizeGet();
+    ICUNIT_GOTO_EQUAL(ret, liveSize, ret, EXIT);
+
+EXIT:
+    for (index = 0; index < PROFILE_BLOCK_NUM; index++) {
+        (VOID)LOS_MemFree(g_memPool, ptr[index]);
+    }
+    LOS_TaskUnlock();
+    MemFree();
+    MemEnd();
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem053(void)
+{
+#if (LOSCFG_MEM_PROFILE == 1)
+    TEST_ADD_CASE("ItLosMem053", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
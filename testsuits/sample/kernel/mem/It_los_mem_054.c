@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#if (LOSCFG_MEM_BACKGROUND_CHECK == 1)
+#define CHECK_BLOCK_NUM   6
+#define CHECK_BLOCK_SIZE  0x40
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    VOID *ptr[CHECK_BLOCK_NUM] = { NULL };
+
+    ret = LOS_MemIntegrityCheckStep(NULL, 1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+    ret = LOS_MemIntegrityCheckStep(m_aucSysMem0, 0);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    MemStart();
+    MemInit();
+
+    for (index = 0; index < CHECK_BLOCK_NUM; index++) {
+        ptr[index] = LOS_MemAlloc(g_memPool, CHECK_BLOCK_SIZE);
+        ICUNIT_GOTO_NOT_EQUAL(ptr[index], NULL, ptr[index], EXIT);
+    }
+
+    /* Stop on every block in turn, then free it so that it merges into the free block before it. */
+    for (index = 0; index < CHECK_BLOCK_NUM; index++) {
+        ret = LOS_MemIntegrityCheckStep(g_memPool, 1);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+        ret = LOS_MemFree(g_memPool, ptr[index]);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+        ptr[index] = NULL;
+    }
+
+    /* More steps than nodes wrap around to the start of the pool. */
+    ret = LOS_MemIntegrityCheckStep(g_memPool, CHECK_BLOCK_NUM * 2); // 2, go over the pool twice.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    for (index = 0; index < CHECK_BLOCK_NUM; index++) {
+        (VOID)LOS_MemFree(g_memPool, ptr[index]);
+    }
+    MemFree();
+    MemEnd();
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem054(void)
+{
+#if (LOSCFG_MEM_BACKGROUND_CHECK == 1)
+    TEST_ADD_CASE("ItLosMem054", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+#include "los_membox.h"
+
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+#define BOX_BLOCK_NUM   4
+#define BOX_BLOCK_SIZE  16
+
+static UINT32 g_boxPool[LOS_MEMBOX_SIZE(BOX_BLOCK_SIZE, BOX_BLOCK_NUM) / sizeof(UINT32)];
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT32 maxBlk;
+    UINT32 blkCnt;
+    UINT32 blkSize;
+    VOID *box[BOX_BLOCK_NUM + 1] = { NULL };
+
+    ret = LOS_MemboxLockFreeEnable(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    ret = LOS_MemboxInit(g_boxPool, sizeof(g_boxPool), BOX_BLOCK_SIZE);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_MemboxLockFreeEnable(g_boxPool);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    for (index = 0; index < BOX_BLOCK_NUM; index++) {
+        box[index] = LOS_MemboxAlloc(g_boxPool);
+        ICUNIT_ASSERT_NOT_EQUAL(box[index], NULL, box[index]);
+    }
+    box[BOX_BLOCK_NUM] = LOS_MemboxAlloc(g_boxPool);
+    ICUNIT_ASSERT_EQUAL(box[BOX_BLOCK_NUM], NULL, box[BOX_BLOCK_NUM]);
+
+    ret = LOS_MemboxStatisticsGet(g_boxPool, &maxBlk, &blkCnt, &blkSize);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(blkCnt, BOX_BLOCK_NUM, blkCnt);
+
+    /* The magic check still rejects a block that is freed twice. */
+    ret = LOS_MemboxFree(g_boxPool, box[1]);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_MemboxFree(g_boxPool, box[1]);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    /* The last block freed is the first one allocated again. */
+    box[BOX_BLOCK_NUM] = LOS_MemboxAlloc(g_boxPool);
+    ICUNIT_ASSERT_EQUAL(box[BOX_BLOCK_NUM], box[1], box[BOX_BLOCK_NUM]);
+
+    for (index = 0; index < BOX_BLOCK_NUM; index++) {
+        ret = LOS_MemboxFree(g_boxPool, box[index]);
+        ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    }
+    ret = LOS_MemboxStatisticsGet(g_boxPool, &maxBlk, &blkCnt, &blkSize);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(blkCnt, 0, blkCnt);
+
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem055(void)
+{
+#if (LOSCFG_MEMBOX_LOCK_FREE == 1)
+    TEST_ADD_CASE("ItLosMem055", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+#include "los_membox.h"
+
+#define BOX_BLOCK_SIZE  16
+
+static UINT32 g_boxPool[LOS_MEMBOX_SIZE(BOX_BLOCK_SIZE, 1) / sizeof(UINT32)];
+static VOID *g_waiterBox[2];
+static UINT32 g_waiterOrder[2];
+
+static VOID TaskF01(UINT32 index)
+{
+    VOID *box = LOS_MemboxAllocWait(g_boxPool, LOS_WAIT_FOREVER);
+
+    g_waiterBox[index] = box;
+    g_waiterOrder[index] = ++g_testCount;
+    if (box != NULL) {
+        (VOID)LOS_MemboxFree(g_boxPool, box);
+    }
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 maxBlk;
+    UINT32 blkCnt;
+    UINT32 blkSize;
+    UINT32 taskID[2] = { OS_INVALID, OS_INVALID };
+    VOID *box = NULL;
+    VOID *box2 = NULL;
+    TSK_INIT_PARAM_S task = { 0 };
+
+    box = LOS_MemboxAllocWait(NULL, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL(box, NULL, box);
+
+    ret = LOS_MemboxInit(g_boxPool, sizeof(g_boxPool), BOX_BLOCK_SIZE);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    box = LOS_MemboxAllocWait(g_boxPool, LOS_NO_WAIT);
+    ICUNIT_ASSERT_NOT_EQUAL(box, NULL, box);
+
+    /* The pool is empty, so both calls fail, the second one after waiting 2 ticks. */
+    box2 = LOS_MemboxAllocWait(g_boxPool, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(box2, NULL, box2, EXIT);
+    box2 = LOS_MemboxAllocWait(g_boxPool, 2); // 2, wait ticks
+    ICUNIT_GOTO_EQUAL(box2, NULL, box2, EXIT);
+
+    g_testCount = 0;
+    g_waiterBox[0] = NULL;
+    g_waiterBox[1] = NULL;
+    task.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task.uwStackSize = TASK_STACK_SIZE_TEST;
+
+    /* Both waiters preempt the test task and block. The one with the higher priority starts waiting last. */
+    task.pcName = "MemboxWait0";
+    task.uwArg = 0;
+    task.usTaskPrio = TASK_PRIO_TEST - 1;
+    ret = LOS_TaskCreate(&taskID[0], &task);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    task.pcName = "MemboxWait1";
+    task.uwArg = 1;
+    task.usTaskPrio = TASK_PRIO_TEST - 2; // 2, higher than the first waiter
+    ret = LOS_TaskCreate(&taskID[1], &task);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 0, g_testCount, EXIT);
+
+    /* The freed block goes to the higher priority waiter, which frees it to the other one. */
+    ret = LOS_MemboxFree(g_boxPool, box);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    box = NULL;
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT); // 2, both waiters ran
+    ICUNIT_GOTO_EQUAL(g_waiterOrder[1], 1, g_waiterOrder[1], EXIT);
+    ICUNIT_GOTO_EQUAL(g_waiterOrder[0], 2, g_waiterOrder[0], EXIT); // 2, served second
+    ICUNIT_GOTO_NOT_EQUAL(g_waiterBox[1], NULL, g_waiterBox[1], EXIT);
+    ICUNIT_GOTO_EQUAL(g_waiterBox[0], g_waiterBox[1], g_waiterBox[0], EXIT);
+
+    ret = LOS_MemboxStatisticsGet(g_boxPool, &maxBlk, &blkCnt, &blkSize);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(blkCnt, 0, blkCnt);
+
+    return LOS_OK;
+EXIT:
+    (VOID)LOS_TaskDelete(taskID[0]);
+    (VOID)LOS_TaskDelete(taskID[1]);
+    if (box != NULL) {
+        (VOID)LOS_MemboxFree(g_boxPool, box);
+    }
+    return LOS_OK;
+}
+
+VOID ItLosMem056(void)
+{
+    TEST_ADD_CASE("ItLosMem056", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+}
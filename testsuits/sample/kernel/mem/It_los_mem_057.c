@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+#include "los_membox.h"
+
+#if (LOSCFG_MEMBOX_MULTI == 1)
+#define MULTI_POOL_SIZE (LOS_MEMBOX_MULTI_HEAD_SIZE + LOS_MEMBOX_SIZE(16, 2) + LOS_MEMBOX_SIZE(64, 1))
+#define MULTI_BOX_NUM   5
+
+static UINTPTR g_multiPool[MULTI_POOL_SIZE / sizeof(UINTPTR)];
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    VOID *box[MULTI_BOX_NUM] = { NULL };
+    LOS_MEMBOX_CLASS_STAT stat = { 0 };
+    LOS_MEMBOX_CLASS_CFG cfg[] = { { 16, 2 }, { 64, 1 } }; // 16, 64: block sizes; 2, 1: block numbers
+    LOS_MEMBOX_CLASS_CFG badCfg[] = { { 64, 1 }, { 16, 2 } }; // 16, 64: block sizes; 2, 1: block numbers
+
+    ret = LOS_MemboxMultiInit(g_multiPool, sizeof(g_multiPool), badCfg, 2, TRUE); // 2, class number
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+    ret = LOS_MemboxMultiInit(g_multiPool, sizeof(g_multiPool) - sizeof(UINTPTR), cfg, 2, TRUE); // 2, class number
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+    ret = LOS_MemboxMultiInit(g_multiPool, sizeof(g_multiPool), cfg, 2, TRUE); // 2, class number
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    /* Two requests fit the 16 byte class, the third falls back to the 64 byte class, the fourth spills. */
+    for (index = 0; index < MULTI_BOX_NUM - 1; index++) {
+        box[index] = LOS_MemboxMultiAlloc(g_multiPool, 10); // 10, request size
+        ICUNIT_GOTO_NOT_EQUAL(box[index], NULL, box[index], EXIT);
+    }
+    box[index] = LOS_MemboxMultiAlloc(g_multiPool, 0x100); // 0x100, larger than every class
+    ICUNIT_GOTO_NOT_EQUAL(box[index], NULL, box[index], EXIT);
+
+    ret = LOS_MemboxMultiStatisticsGet(g_multiPool, 0, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.blkSize, 16, stat.blkSize, EXIT); // 16, block size of the first class
+    ICUNIT_GOTO_EQUAL(stat.blkCnt, 2, stat.blkCnt, EXIT); // 2, class full
+    ICUNIT_GOTO_EQUAL(stat.failCount, 2, stat.failCount, EXIT); // 2, the third and fourth request
+
+    ret = LOS_MemboxMultiStatisticsGet(g_multiPool, 1, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.blkCnt, 1, stat.blkCnt, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.fallbackCount, 1, stat.fallbackCount, EXIT);
+
+    ret = LOS_MemboxMultiStatisticsGet(g_multiPool, 2, &stat); // 2, blocks served by LOS_MemAlloc
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.blkCnt, 2, stat.blkCnt, EXIT); // 2, the fourth and fifth request
+    ICUNIT_GOTO_EQUAL(stat.allocCount, 2, stat.allocCount, EXIT); // 2, the fourth and fifth request
+    ret = LOS_MemboxMultiStatisticsGet(g_multiPool, 3, &stat); // 3, out of range
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+
+    for (index = 0; index < MULTI_BOX_NUM; index++) {
+        ret = LOS_MemboxMultiFree(g_multiPool, box[index]);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+        box[index] = NULL;
+    }
+
+    for (index = 0; index <= 2; index++) { // 2, the classes and the blocks served by LOS_MemAlloc
+        ret = LOS_MemboxMultiStatisticsGet(g_multiPool, index, &stat);
+        ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+        ICUNIT_ASSERT_EQUAL(stat.blkCnt, 0, stat.blkCnt);
+    }
+
+    return LOS_OK;
+EXIT:
+    for (index = 0; index < MULTI_BOX_NUM; index++) {
+        if (box[index] != NULL) {
+            (VOID)LOS_MemboxMultiFree(g_multiPool, box[index]);
+        }
+    }
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem057(void)
+{
+#if (LOSCFG_MEMBOX_MULTI == 1)
+    TEST_ADD_CASE("ItLosMem057", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+#define TIER_FAST_OFFSET    0
+#define TIER_FAST_SIZE      0x1000
+#define TIER_SLOW_OFFSET    0x1400
+#define TIER_SLOW_SIZE      0x800
+#define TIER_DMA_OFFSET     0x2000
+#define TIER_DMA_SIZE       0x800
+#define TIER_BIG_SIZE       0x700
+
+// three non-continuous memory regions in one buffer
+STATIC UINTPTR g_memTierBuf[(TIER_DMA_OFFSET + TIER_DMA_SIZE) / sizeof(UINTPTR)];
+
+#define TIER_IN_REGION(ptr, offset, size) \
+    (((UINTPTR)(ptr) >= ((UINTPTR)g_memTierBuf + (offset))) && \
+     ((UINTPTR)(ptr) < ((UINTPTR)g_memTierBuf + (offset) + (size))))
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    VOID *pool = g_memTierBuf;
+    VOID *fast = NULL;
+    VOID *dma = NULL;
+    VOID *align = NULL;
+    VOID *p = NULL;
+    LOS_MEM_POOL_STATUS status = { 0 };
+    LosMemRegion memRegions[] = {
+        { (UINT8 *)g_memTierBuf + TIER_FAST_OFFSET, TIER_FAST_SIZE, LOS_MEM_HINT_FAST },
+        { (UINT8 *)g_memTierBuf + TIER_SLOW_OFFSET, TIER_SLOW_SIZE, 0 },
+        { (UINT8 *)g_memTierBuf + TIER_DMA_OFFSET, TIER_DMA_SIZE, LOS_MEM_HINT_DMA },
+    };
+    LosMemRegion badRegion = { (UINT8 *)g_memTierBuf + TIER_FAST_OFFSET, TIER_FAST_SIZE, LOS_MEM_HINT_STRICT };
+
+    ret = LOS_MemRegionsAdd(NULL, &badRegion, 1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+    ret = LOS_MemRegionsAdd(NULL, memRegions, sizeof(memRegions) / sizeof(memRegions[0]));
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    dma = LOS_MemAllocHint(pool, 0x100, LOS_MEM_HINT_DMA); // 0x100, alloc size
+    ICUNIT_ASSERT_EQUAL(TIER_IN_REGION(dma, TIER_DMA_OFFSET, TIER_DMA_SIZE), TRUE, dma);
+    fast = LOS_MemAllocHint(pool, 0x100, LOS_MEM_HINT_FAST); // 0x100, alloc size
+    ICUNIT_GOTO_EQUAL(TIER_IN_REGION(fast, TIER_FAST_OFFSET, TIER_FAST_SIZE), TRUE, fast, EXIT);
+    align = LOS_MemAllocAlignHint(pool, 0x40, 0x40, LOS_MEM_HINT_DMA); // 0x40, alloc size and boundary
+    ICUNIT_GOTO_EQUAL(TIER_IN_REGION(align, TIER_DMA_OFFSET, TIER_DMA_SIZE), TRUE, align, EXIT);
+    ICUNIT_GOTO_EQUAL(((UINTPTR)align & (0x40 - 1)), 0, align, EXIT); // 0x40, boundary
+
+    /* No DMA region is large enough: strict fails, otherwise the block comes from elsewhere. */
+    p = LOS_MemAllocHint(pool, TIER_BIG_SIZE, LOS_MEM_HINT_DMA | LOS_MEM_HINT_STRICT);
+    ICUNIT_GOTO_EQUAL(p, NULL, p, EXIT);
+    p = LOS_MemAllocHint(pool, TIER_BIG_SIZE, LOS_MEM_HINT_DMA);
+    ICUNIT_GOTO_NOT_EQUAL(p, NULL, p, EXIT);
+    ICUNIT_GOTO_EQUAL(TIER_IN_REGION(p, TIER_DMA_OFFSET, TIER_DMA_SIZE), FALSE, p, EXIT);
+
+    ret = LOS_MemTierInfoGet(pool, LOS_MEM_HINT_DMA, &status);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL((status.totalUsedSize > 0x140), TRUE, status.totalUsedSize, EXIT); // 0x140, dma and align
+    ICUNIT_GOTO_EQUAL((status.totalUsedSize + status.totalFreeSize) <= TIER_DMA_SIZE, TRUE,
+                      status.totalFreeSize, EXIT);
+    ret = LOS_MemTierInfoGet(pool, 0, &status);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL((status.usedNodeNum >= 1), TRUE, status.usedNodeNum, EXIT); // 1, the gap node before DMA
+
+EXIT:
+    (VOID)LOS_MemFree(pool, p);
+    (VOID)LOS_MemFree(pool, align);
+    (VOID)LOS_MemFree(pool, fast);
+    (VOID)LOS_MemFree(pool, dma);
+
+    /* All the blocks are back, so the fast region holds enough free memory for a strict request again. */
+    p = LOS_MemAllocHint(pool, TIER_FAST_SIZE / 2, LOS_MEM_HINT_FAST | LOS_MEM_HINT_STRICT); // 2, half the region
+    ICUNIT_ASSERT_EQUAL(TIER_IN_REGION(p, TIER_FAST_OFFSET, TIER_FAST_SIZE), TRUE, p);
+    (VOID)LOS_MemFree(pool, p);
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem058(void)
+{
+#if (LOSCFG_MEM_MUL_REGIONS == 1)
+    TEST_ADD_CASE("ItLosMem058", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
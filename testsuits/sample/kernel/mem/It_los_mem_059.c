@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+#include "los_arena.h"
+
+#if (LOSCFG_MEM_ARENA == 1)
+#define ARENA_POOL_SIZE     0x1000
+#define ARENA_CHUNK_SIZE    0x100
+
+STATIC UINTPTR g_arenaPool[ARENA_POOL_SIZE / sizeof(UINTPTR)];
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 usedBefore;
+    UINT32 usedCreated;
+    VOID *arena = NULL;
+    UINT8 *first = NULL;
+    UINT8 *p1 = NULL;
+    UINT8 *p2 = NULL;
+    UINT8 *big = NULL;
+    LOS_MEM_POOL_STATUS poolStatus = { 0 };
+    LOS_ARENA_STATUS status = { 0 };
+
+    ret = LOS_MemInit(g_arenaPool, sizeof(g_arenaPool));
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    (VOID)LOS_MemInfoGet(g_arenaPool, &poolStatus);
+    usedBefore = poolStatus.totalUsedSize;
+
+    arena = LOS_ArenaCreate(NULL, ARENA_CHUNK_SIZE);
+    ICUNIT_GOTO_EQUAL(arena, NULL, arena, EXIT);
+    arena = LOS_ArenaCreate(g_arenaPool, ARENA_CHUNK_SIZE);
+    ICUNIT_GOTO_NOT_EQUAL(arena, NULL, arena, EXIT);
+    (VOID)LOS_MemInfoGet(g_arenaPool, &poolStatus);
+    usedCreated = poolStatus.totalUsedSize;
+
+    ICUNIT_GOTO_EQUAL(LOS_ArenaAlloc(arena, 0), NULL, arena, EXIT1);
+    ICUNIT_GOTO_EQUAL(LOS_ArenaAllocAlign(arena, 0x10, 0x30), NULL, arena, EXIT1); // 0x10, 0x30: not a power of 2
+
+    /* Consecutive requests are carved one after another from the first chunk. */
+    first = (UINT8 *)LOS_ArenaAlloc(arena, 0x10); // 0x10, alloc size
+    ICUNIT_GOTO_NOT_EQUAL(first, NULL, first, EXIT1);
+    p1 = (UINT8 *)LOS_ArenaAlloc(arena, 0x3); // 0x3, alloc size
+    ICUNIT_GOTO_EQUAL(p1, first + 0x10, p1, EXIT1); // 0x10, size of the previous request
+    p2 = (UINT8 *)LOS_ArenaAllocAlign(arena, 0x20, 0x40); // 0x20, 0x40: alloc size and boundary
+    ICUNIT_GOTO_NOT_EQUAL(p2, NULL, p2, EXIT1);
+    ICUNIT_GOTO_EQUAL(((UINTPTR)p2 & (0x40 - 1)), 0, p2, EXIT1); // 0x40, boundary
+    p1 = (UINT8 *)LOS_ArenaAlloc(arena, 0x8); // 0x8, alloc size
+    ICUNIT_GOTO_EQUAL(p1, p2 + 0x20, p1, EXIT1); // 0x20, size of the previous request
+
+    /* A request larger than the chunk size gets a chunk of its own, the first chunk stays in use. */
+    big = (UINT8 *)LOS_ArenaAlloc(arena, ARENA_CHUNK_SIZE * 2); // 2, twice the chunk size
+    ICUNIT_GOTO_NOT_EQUAL(big, NULL, big, EXIT1);
+    p2 = (UINT8 *)LOS_ArenaAlloc(arena, 0x8); // 0x8, alloc size
+    ICUNIT_GOTO_EQUAL(p2, p1 + 0x8, p2, EXIT1); // 0x8, size of the previous request
+
+    /* A request that does not fit the rest of the first chunk starts a new one. */
+    p1 = (UINT8 *)LOS_ArenaAlloc(arena, ARENA_CHUNK_SIZE - 0x10); // 0x10, less than the space used
+    ICUNIT_GOTO_NOT_EQUAL(p1, NULL, p1, EXIT1);
+    ICUNIT_GOTO_EQUAL(((p1 >= first) && (p1 < first + ARENA_CHUNK_SIZE)), FALSE, p1, EXIT1);
+
+    ret = LOS_ArenaInfoGet(arena, &status);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(status.chunkNum, 3, status.chunkNum, EXIT1); // 3, the first, the large and the new chunk
+    ICUNIT_GOTO_EQUAL(status.totalSize, ARENA_CHUNK_SIZE * 4, status.totalSize, EXIT1); // 4, 1 + 2 + 1 chunk sizes
+    ICUNIT_GOTO_EQUAL(status.usedSize, 0x10 + 0x3 + 0x20 + 0x8 + ARENA_CHUNK_SIZE * 3 + 0x8 - 0x10,
+                      status.usedSize, EXIT1);
+
+    /* Reset gives back every chunk but the first one, and allocation starts over. */
+    ret = LOS_ArenaReset(arena);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    (VOID)LOS_MemInfoGet(g_arenaPool, &poolStatus);
+    ICUNIT_GOTO_EQUAL(poolStatus.totalUsedSize, usedCreated, poolStatus.totalUsedSize, EXIT1);
+    ret = LOS_ArenaInfoGet(arena, &status);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(status.chunkNum, 1, status.chunkNum, EXIT1);
+    ICUNIT_GOTO_EQUAL(status.usedSize, 0, status.usedSize, EXIT1);
+    ICUNIT_GOTO_NOT_EQUAL(status.peakUsedSize, 0, status.peakUsedSize, EXIT1);
+    p1 = (UINT8 *)LOS_ArenaAlloc(arena, 0x10); // 0x10, alloc size
+    ICUNIT_GOTO_EQUAL(p1, first, p1, EXIT1);
+
+    ret = LOS_ArenaDestroy(arena);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    (VOID)LOS_MemInfoGet(g_arenaPool, &poolStatus);
+    ICUNIT_ASSERT_EQUAL(poolStatus.totalUsedSize, usedBefore, poolStatus.totalUsedSize);
+
+    ret = LOS_ArenaReset(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+    ret = LOS_ArenaDestroy(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    return LOS_OK;
+EXIT1:
+    (VOID)LOS_ArenaDestroy(arena);
+EXIT:
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem059(void)
+{
+#if (LOSCFG_MEM_ARENA == 1)
+    TEST_ADD_CASE("ItLosMem059", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+#endif
+}
@@ -108,6 +108,18 @@ VOID ItSuiteLosMem(void)
     ItLosMem046();
     ItLosMem047();
 #endif
+    ItLosMem048();
+    ItLosMem049();
+    ItLosMem050();
+    ItLosMem051();
+    ItLosMem052();
+    ItLosMem053();
+    ItLosMem054();
+    ItLosMem055();
+    ItLosMem056();
+    ItLosMem057();
+    ItLosMem058();
+    ItLosMem059();
 
 #if (LOS_KERNEL_TEST_FULL == 1)
     ItLosTick001();
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mux.h"
+
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_MuxPend(g_mutexTest1, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    // 2, the ceiling of the mutex.
+    ICUNIT_ASSERT_EQUAL_VOID(g_losTask.runTask->priority, TASK_PRIO_TEST - 2, g_losTask.runTask->priority);
+
+    g_testCount++;
+
+    ret = LOS_MuxPost(g_mutexTest1);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL_VOID(g_losTask.runTask->priority, TASK_PRIO_TEST - 1, g_losTask.runTask->priority);
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    LosMuxAttr attr = { 0 };
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "TskMux36";
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+    task1.uwResved = LOS_TASK_STATUS_DETACHED;
+
+    g_testCount = 0;
+
+    attr.protocol = LOS_MUX_PRIO_PROTECT + 1;
+    ret = LOS_MuxCreateEx(&g_mutexTest1, &attr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_MUX_INVALID, ret);
+    attr.protocol = LOS_MUX_PRIO_PROTECT;
+    attr.prioCeiling = OS_TASK_PRIORITY_LOWEST + 1;
+    ret = LOS_MuxCreateEx(&g_mutexTest1, &attr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_MUX_INVALID, ret);
+
+    /* A ceiling below the priority of the task cannot be locked by it. */
+    attr.prioCeiling = TASK_PRIO_TEST + 1;
+    ret = LOS_MuxCreateEx(&g_mutexTest2, &attr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_MuxPend(g_mutexTest2, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_MUX_CEILING, ret, EXIT1);
+    ret = LOS_MuxDelete(g_mutexTest2);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    attr.prioCeiling = TASK_PRIO_TEST - 2; // 2, above the helper task.
+    ret = LOS_MuxCreateEx(&g_mutexTest1, &attr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    /* The owner runs at the ceiling until the last unlock. */
+    ret = LOS_MuxPend(g_mutexTest1, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    // 2, the ceiling of the mutex.
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST - 2, g_losTask.runTask->priority, EXIT);
+    ret = LOS_MuxPend(g_mutexTest1, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MuxPost(g_mutexTest1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    // 2, the ceiling of the mutex.
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST - 2, g_losTask.runTask->priority, EXIT);
+
+    /* A task below the ceiling cannot preempt the owner, so it never blocks on the mutex. */
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 0, g_testCount, EXIT);
+
+    ret = LOS_MuxPost(g_mutexTest1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT);
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST, g_losTask.runTask->priority, EXIT);
+
+    ret = LOS_MuxDelete(g_mutexTest1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+    LOS_MuxPost(g_mutexTest1);
+    LOS_MuxPost(g_mutexTest1);
+    LOS_MuxDelete(g_mutexTest1);
+    return LOS_OK;
+
+EXIT1:
+    LOS_MuxDelete(g_mutexTest2);
+    return LOS_OK;
+}
+
+VOID ItLosMux036(void)
+{
+    TEST_ADD_CASE("ItLosMux036", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL1, TEST_FUNCTION);
+}
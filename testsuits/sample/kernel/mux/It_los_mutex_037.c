@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mux.h"
+
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    g_testCount++;
+    ret = LOS_MuxPend(g_mutexTest2, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    ret = LOS_MuxPost(g_mutexTest2);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    g_testCount++;
+}
+
+static VOID TaskF02(VOID)
+{
+    UINT32 ret;
+
+    g_testCount++;
+    ret = LOS_MuxPend(g_mutexTest1, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    ret = LOS_MuxPost(g_mutexTest1);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    g_testCount++;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.uwResved = LOS_TASK_STATUS_DETACHED;
+
+    g_testCount = 0;
+
+    ret = LOS_MuxCreate(&g_mutexTest1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_MuxCreate(&g_mutexTest2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    /* Both mutexes are taken uncontended. */
+    ret = LOS_MuxPend(g_mutexTest1, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MuxPend(g_mutexTest2, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* A waiter on the second mutex raises the owner before anyone contends for the first one. */
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.pcName = "TskMux37A";
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT);
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST - 1, g_losTask.runTask->priority, EXIT);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task1.pcName = "TskMux37B";
+    task1.usTaskPrio = TASK_PRIO_TEST - 2; // 2, above the first waiter.
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT); // Compare wiht the expected value 2.
+    // 2, raised by the second waiter.
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST - 2, g_losTask.runTask->priority, EXIT);
+
+    ret = LOS_MuxPost(g_mutexTest2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 3, g_testCount, EXIT); // Compare wiht the expected value 3.
+
+    /* The first mutex restores the priority the owner had when it took it, not the raised one. */
+    ret = LOS_MuxPost(g_mutexTest1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 4, g_testCount, EXIT); // Compare wiht the expected value 4.
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST, g_losTask.runTask->priority, EXIT);
+
+    ret = LOS_MuxDelete(g_mutexTest2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ret = LOS_MuxDelete(g_mutexTest1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_MuxPost(g_mutexTest2);
+    LOS_MuxPost(g_mutexTest1);
+    LOS_TaskPriSet(LOS_CurTaskIDGet(), TASK_PRIO_TEST);
+    LOS_MuxDelete(g_mutexTest2);
+EXIT1:
+    LOS_MuxDelete(g_mutexTest1);
+    return LOS_OK;
+}
+
+VOID ItLosMux037(void)
+{
+    TEST_ADD_CASE("ItLosMux037", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mux.h"
+
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    LosMuxAttr attr = { 0 };
+
+    attr.protocol = LOS_MUX_PRIO_PROTECT;
+    attr.prioCeiling = TASK_PRIO_TEST - 2; // 2, the lower ceiling.
+    ret = LOS_MuxCreateEx(&g_mutexTest1, &attr);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    attr.prioCeiling = TASK_PRIO_TEST - 4; // 4, the higher ceiling.
+    ret = LOS_MuxCreateEx(&g_mutexTest2, &attr);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = LOS_MuxPend(g_mutexTest1, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ret = LOS_MuxPend(g_mutexTest2, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    // 4, the higher ceiling.
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST - 4, g_losTask.runTask->priority, EXIT);
+
+    /* Released out of order, the mutex still held keeps its ceiling, and the last one restores the original. */
+    ret = LOS_MuxPost(g_mutexTest1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    // 4, the higher ceiling.
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST - 4, g_losTask.runTask->priority, EXIT);
+    ret = LOS_MuxPost(g_mutexTest2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(g_losTask.runTask->priority, TASK_PRIO_TEST, g_losTask.runTask->priority, EXIT1);
+
+    ret = LOS_MuxDelete(g_mutexTest2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ret = LOS_MuxDelete(g_mutexTest1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_MuxPost(g_mutexTest2);
+    LOS_MuxPost(g_mutexTest1);
+EXIT1:
+    LOS_MuxDelete(g_mutexTest2);
+EXIT2:
+    LOS_MuxDelete(g_mutexTest1);
+    (VOID)LOS_TaskPriSet(LOS_CurTaskIDGet(), TASK_PRIO_TEST);
+    return LOS_OK;
+}
+
+VOID ItLosMux038(void)
+{
+    TEST_ADD_CASE("ItLosMux038", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL1, TEST_FUNCTION);
+}
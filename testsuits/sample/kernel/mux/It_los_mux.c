@@ -51,6 +51,10 @@ VOID ItSuiteLosMux(void)
     ItLosMux027();
     ItLosMux029();
     ItLosMux031();
+    ItLosMux035();
+    ItLosMux036();
+    ItLosMux037();
+    ItLosMux038();
 
 #if (LOS_KERNEL_TEST_FULL == 1)
     ItLosMux007();
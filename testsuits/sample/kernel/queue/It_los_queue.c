@@ -116,6 +116,10 @@ VOID ItSuiteLosQueue(VOID)
     ItLosQueue106();
     ItLosQueue107();
     ItLosQueue114();
+    ItLosQueue115();
+    ItLosQueue116();
+    ItLosQueue117();
+    ItLosQueue118();
     ItLosQueueHead001();
     ItLosQueueHead002();
     ItLosQueueHead003();
@@ -149,6 +149,10 @@ extern VOID ItLosQueue108(VOID);
 extern VOID ItLosQueue109(VOID);
 extern VOID ItLosQueue110(VOID);
 extern VOID ItLosQueue114(VOID);
+extern VOID ItLosQueue115(VOID);
+extern VOID ItLosQueue116(VOID);
+extern VOID ItLosQueue117(VOID);
+extern VOID ItLosQueue118(VOID);
 extern VOID ItLosQueueHead001(VOID);
 extern VOID ItLosQueueHead002(VOID);
 extern VOID ItLosQueueHead003(VOID);
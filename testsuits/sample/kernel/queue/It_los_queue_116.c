@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "It_los_queue.h"
+
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+    CHAR buff2[QUEUE_SHORT_BUFFER_LENGTH] = "";
+
+    g_testCount++;
+
+    ret = LOS_QueueRead(g_testQueueID01, &buff2, QUEUE_BASE_MSGSIZE, LOS_WAIT_FOREVER);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    g_testCount++;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+}
+
+static VOID TaskF02(VOID)
+{
+    UINT32 ret;
+    CHAR buff2[QUEUE_SHORT_BUFFER_LENGTH] = "";
+
+    g_testCount++;
+
+    ret = LOS_QueueRead(g_testQueueID01, &buff2, QUEUE_BASE_MSGSIZE, LOS_WAIT_FOREVER);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    g_testCount++;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID02);
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 count;
+    UINT32 buff1[QUEUE_BASE_NUM] = { 0x11, 0x22, 0x33 };
+    UINT32 buff2[QUEUE_BASE_NUM] = { 0 };
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.pcName = "TskName115_1";
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+
+    TSK_INIT_PARAM_S task2 = { 0 };
+    task2.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task2.pcName = "TskName115_2";
+    task2.uwStackSize = TASK_STACK_SIZE_TEST;
+    task2.usTaskPrio = TASK_PRIO_TEST - 1;
+
+    g_testCount = 0;
+
+    ret = LOS_QueueCreate("Q1", QUEUE_BASE_NUM, &g_testQueueID01, 0, sizeof(UINT32));
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_TaskCreate(&g_testTaskID02, &task2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT2); // Compare wiht the expected value 2.
+
+    /* Both readers are pending, one batch hands a node to each of them and leaves the third one queued. */
+    count = QUEUE_BASE_NUM;
+    ret = LOS_QueueWriteBatch(g_testQueueID01, buff1, sizeof(UINT32), &count, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(count, QUEUE_BASE_NUM, count, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 4, g_testCount, EXIT2); // Compare wiht the expected value 4.
+
+    count = QUEUE_BASE_NUM;
+    ret = LOS_QueueReadBatch(g_testQueueID01, buff2, sizeof(UINT32), &count, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(count, 1, count, EXIT);
+    ICUNIT_GOTO_EQUAL(buff2[0], buff1[2], buff2[0], EXIT); // 2, the last message is the only one left.
+
+    ret = LOS_QueueDelete(g_testQueueID01);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT2:
+    LOS_TaskDelete(g_testTaskID02);
+EXIT1:
+    LOS_TaskDelete(g_testTaskID01);
+EXIT:
+    LOS_QueueDelete(g_testQueueID01);
+    return LOS_OK;
+}
+
+VOID ItLosQueue116(VOID)
+{
+    TEST_ADD_CASE("ItLosQueue116", Testcase, TEST_LOS, TEST_QUE, TEST_LEVEL1, TEST_FUNCTION);
+}
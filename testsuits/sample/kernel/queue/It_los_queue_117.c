@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_queue.h"
+
+#define QUEUE_MSGBUF_SIZE 16
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 count;
+    UINT32 readSize;
+    CHAR buff[QUEUE_BASE_MSGSIZE] = "";
+    QUEUE_INFO_S queueInfo;
+
+    ret = LOS_QueueCreateMsgBuf("Q1", OS_QUEUE_MSGBUF_NODE_SIZE(QUEUE_BASE_MSGSIZE) - 1, &g_testQueueID01, 0,
+                                QUEUE_BASE_MSGSIZE);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_QUEUE_SIZE_TOO_BIG, ret);
+
+    ret = LOS_QueueCreateMsgBuf("Q1", QUEUE_MSGBUF_SIZE, &g_testQueueID01, 0, QUEUE_BASE_MSGSIZE);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    /* "ab" takes 4 bytes and "cdefgh" 8 bytes, a message needing 5 more bytes does not fit. */
+    ret = LOS_QueueWriteCopy(g_testQueueID01, "ab", 2, 0); // 2, message length.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueWriteCopy(g_testQueueID01, "cdefgh", 6, 0); // 6, message length.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueWriteCopy(g_testQueueID01, "xyz", 3, 0); // 3, message length.
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUE_ISFULL, ret, EXIT);
+
+    readSize = QUEUE_BASE_MSGSIZE;
+    ret = LOS_QueueReadCopy(g_testQueueID01, buff, &readSize, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(readSize, 2, readSize, EXIT); // 2, length of "ab".
+    ICUNIT_GOTO_EQUAL(memcmp(buff, "ab", readSize), 0, buff[0], EXIT);
+
+    /* "klmno" wraps around the end of the ring. */
+    ret = LOS_QueueWriteCopy(g_testQueueID01, "klmno", 5, 0); // 5, message length.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    readSize = QUEUE_BASE_MSGSIZE;
+    ret = LOS_QueueReadCopy(g_testQueueID01, buff, &readSize, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(readSize, 6, readSize, EXIT); // 6, length of "cdefgh".
+    ICUNIT_GOTO_EQUAL(memcmp(buff, "cdefgh", readSize), 0, buff[0], EXIT);
+
+    /* A message written to the head is read before the older one. */
+    ret = LOS_QueueWriteHeadCopy(g_testQueueID01, "x", 1, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    readSize = QUEUE_BASE_MSGSIZE;
+    ret = LOS_QueueReadCopy(g_testQueueID01, buff, &readSize, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(readSize, 1, readSize, EXIT);
+    ICUNIT_GOTO_EQUAL(buff[0], 'x', buff[0], EXIT);
+
+    readSize = QUEUE_BASE_MSGSIZE;
+    ret = LOS_QueueReadCopy(g_testQueueID01, buff, &readSize, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(readSize, 5, readSize, EXIT); // 5, length of "klmno".
+    ICUNIT_GOTO_EQUAL(memcmp(buff, "klmno", readSize), 0, buff[0], EXIT);
+
+    readSize = QUEUE_BASE_MSGSIZE;
+    ret = LOS_QueueReadCopy(g_testQueueID01, buff, &readSize, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUE_ISEMPTY, ret, EXIT);
+
+    count = 1;
+    ret = LOS_QueueReadBatch(g_testQueueID01, buff, QUEUE_BASE_MSGSIZE, &count, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUE_TYPE_UNSUPPORTED, ret, EXIT);
+
+    ret = LOS_QueueInfoGet(g_testQueueID01, &queueInfo);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(queueInfo.queueLen, QUEUE_MSGBUF_SIZE, queueInfo.queueLen, EXIT);
+    ICUNIT_GOTO_EQUAL(queueInfo.writableCnt, QUEUE_MSGBUF_SIZE, queueInfo.writableCnt, EXIT);
+    ICUNIT_GOTO_EQUAL(queueInfo.readableCnt, 0, queueInfo.readableCnt, EXIT);
+
+    ret = LOS_QueueDelete(g_testQueueID01);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_QueueDelete(g_testQueueID01);
+    return LOS_OK;
+}
+
+VOID ItLosQueue117(VOID)
+{
+    TEST_ADD_CASE("ItLosQueue117", Testcase, TEST_LOS, TEST_QUE, TEST_LEVEL0, TEST_FUNCTION);
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_queueset.h"
+
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 msg = 0x5a;
+    UINT32 readBuf = 0;
+    UINT32 readSize = sizeof(readBuf);
+    QUEUESET_MEMBER_S member = { 0 };
+    QUEUESET_MEMBER_S ready = { 0 };
+
+    ret = LOS_QueueCreate("QueueSet1", QUEUESET_QUEUE_LEN, &g_testQueueSetQueue, 0, sizeof(UINT32));
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_SemCreate(0, &g_testQueueSetSem);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ret = LOS_EventInit(&g_testQueueSetEvent);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    ret = LOS_QueueSetSelect(&g_testQueueSet, &ready, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUESET_NOT_INITIALIZED, ret, EXIT);
+    ret = LOS_QueueSetInit(&g_testQueueSet);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    member.type = LOS_QUEUESET_TYPE_QUEUE;
+    member.handle = g_testQueueSetQueue;
+    ret = LOS_QueueSetAdd(&g_testQueueSet, &member);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueSetAdd(&g_testQueueSet, &member);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUESET_MEMBER_IN_SET, ret, EXIT);
+
+    member.type = LOS_QUEUESET_TYPE_SEM;
+    member.handle = g_testQueueSetSem;
+    ret = LOS_QueueSetAdd(&g_testQueueSet, &member);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    member.type = LOS_QUEUESET_TYPE_EVENT;
+    member.handle = (UINTPTR)&g_testQueueSetEvent;
+    member.eventMask = QUEUESET_EVENT_MASK;
+    member.eventMode = LOS_WAITMODE_AND;
+    ret = LOS_QueueSetAdd(&g_testQueueSet, &member);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_QueueSetSelect(&g_testQueueSet, &ready, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUESET_NOT_READY, ret, EXIT);
+
+    /* Members of a set cannot be deleted. */
+    ret = LOS_QueueDelete(g_testQueueSetQueue);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUE_IN_TSKUSE, ret, EXIT);
+    ret = LOS_SemDelete(g_testQueueSetSem);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SEM_PENDED, ret, EXIT);
+
+    /* An AND event member is not ready until all of its bits are set. */
+    ret = LOS_EventWrite(&g_testQueueSetEvent, 0x1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueSetSelect(&g_testQueueSet, &ready, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUESET_NOT_READY, ret, EXIT);
+    ret = LOS_EventWrite(&g_testQueueSetEvent, 0x2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueSetSelect(&g_testQueueSet, &ready, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(ready.type, LOS_QUEUESET_TYPE_EVENT, ready.type, EXIT);
+    ICUNIT_GOTO_EQUAL(ready.handle, (UINTPTR)&g_testQueueSetEvent, ready.handle, EXIT);
+    ret = LOS_EventClear(&g_testQueueSetEvent, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* With several members ready, selection goes round robin. */
+    ret = LOS_QueueWriteCopy(g_testQueueSetQueue, &msg, sizeof(msg), LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_SemPost(g_testQueueSetSem);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_QueueSetSelect(&g_testQueueSet, &ready, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(ready.type, LOS_QUEUESET_TYPE_QUEUE, ready.type, EXIT);
+    ret = LOS_QueueSetSelect(&g_testQueueSet, &ready, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(ready.type, LOS_QUEUESET_TYPE_SEM, ready.type, EXIT);
+
+    /* Selecting does not consume, the caller takes the message itself. */
+    ret = LOS_QueueReadCopy(g_testQueueSetQueue, &readBuf, &readSize, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(readBuf, msg, readBuf, EXIT);
+    ret = LOS_SemPend(g_testQueueSetSem, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueSetSelect(&g_testQueueSet, &ready, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUESET_NOT_READY, ret, EXIT);
+
+    ret = LOS_QueueSetRemove(&g_testQueueSet, LOS_QUEUESET_TYPE_SEM, g_testQueueSetSem);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueSetRemove(&g_testQueueSet, LOS_QUEUESET_TYPE_SEM, g_testQueueSetSem);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_QUEUESET_MEMBER_NOT_FOUND, ret, EXIT);
+    ret = LOS_SemDelete(g_testQueueSetSem);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_QueueSetDestroy(&g_testQueueSet);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_QueueDelete(g_testQueueSetQueue);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_EventDestroy(&g_testQueueSetEvent);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_QueueSetDestroy(&g_testQueueSet);
+    LOS_EventDestroy(&g_testQueueSetEvent);
+EXIT1:
+    LOS_SemDelete(g_testQueueSetSem);
+EXIT2:
+    LOS_QueueDelete(g_testQueueSetQueue);
+    return LOS_OK;
+}
+
+VOID ItLosQueueset001(VOID)
+{
+    TEST_ADD_CASE("ItLosQueueset001", Testcase, TEST_LOS, TEST_QUE, TEST_LEVEL0, TEST_FUNCTION);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "It_los_rwlock.h"
+
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    g_testCount++;
+
+    ret = LOS_RwLockWrLock(g_testRwLockID, LOS_WAIT_FOREVER);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    g_testCount++;
+
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+}
+
+static VOID TaskF02(VOID)
+{
+    UINT32 ret;
+
+    g_testCount++;
+
+    ret = LOS_RwLockRdLock(g_testRwLockID, LOS_WAIT_FOREVER);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    g_testCount++;
+
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID02);
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+
+    g_testCount = 0;
+
+    ret = LOS_RwLockCreate(&g_testRwLockID, LOS_RWLOCK_PREFER_WRITER);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_RwLockRdLock(g_testRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.pcName = "TskRwLock2A";
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT1);
+
+    /* A waiting writer holds back new readers. */
+    ret = LOS_RwLockRdLock(g_testRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_RWLOCK_UNAVAILABLE, ret, EXIT1);
+
+    /* The last reader hands the lock to the writer. */
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT1); // Compare wiht the expected value 2.
+
+    /* A reader blocked by the writer raises the writer's priority. */
+    ret = LOS_RwLockWrLock(g_testRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task1.pcName = "TskRwLock2B";
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 3, g_testCount, EXIT2); // Compare wiht the expected value 3.
+    ret = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    ICUNIT_GOTO_EQUAL(ret, TASK_PRIO_TEST - 1, ret, EXIT2);
+
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 4, g_testCount, EXIT); // Compare wiht the expected value 4.
+    ret = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    ICUNIT_GOTO_EQUAL(ret, TASK_PRIO_TEST, ret, EXIT);
+
+    ret = LOS_RwLockDelete(g_testRwLockID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT2:
+    LOS_RwLockUnlock(g_testRwLockID);
+    LOS_TaskDelete(g_testTaskID02);
+    LOS_RwLockDelete(g_testRwLockID);
+    return LOS_OK;
+EXIT1:
+    LOS_RwLockUnlock(g_testRwLockID);
+    LOS_TaskDelete(g_testTaskID01);
+EXIT:
+    LOS_RwLockDelete(g_testRwLockID);
+    return LOS_OK;
+}
+
+VOID ItLosRwlock002(VOID)
+{
+    TEST_ADD_CASE("ItLosRwlock002", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL1, TEST_FUNCTION);
+}
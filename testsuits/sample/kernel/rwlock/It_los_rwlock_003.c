@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "It_los_rwlock.h"
+
+#define RWLOCK_WAIT_TIMEOUT 10
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    /* The task holds no read lock, so it cannot release the one the test task holds. */
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_RWLOCK_INVALID, ret, EXIT);
+    g_testCount++;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+}
+
+static VOID TaskF02(VOID)
+{
+    UINT32 ret;
+
+    g_testCount++;
+
+    ret = LOS_RwLockRdLock(g_testRwLockID, RWLOCK_WAIT_TIMEOUT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_RWLOCK_TIMEOUT, ret, EXIT);
+
+    g_testCount++;
+
+EXIT:
+    LOS_TaskDelete(g_testTaskID02);
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+
+    g_testCount = 0;
+
+    ret = LOS_RwLockCreate(&g_testRwLockID, 0);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_RwLockRdLock(g_testRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.pcName = "TskRwLock3A";
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT1);
+
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_RWLOCK_INVALID, ret, EXIT);
+
+    /* A reader that gives up waiting takes back the priority it lent the writer. */
+    ret = LOS_RwLockWrLock(g_testRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task1.pcName = "TskRwLock3B";
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT2); // Compare wiht the expected value 2.
+    ret = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    ICUNIT_GOTO_EQUAL(ret, TASK_PRIO_TEST - 1, ret, EXIT2);
+
+    ret = LOS_TaskDelay(RWLOCK_WAIT_TIMEOUT * 2); // 2, wait until the reader has timed out.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 3, g_testCount, EXIT1); // Compare wiht the expected value 3.
+    ret = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    ICUNIT_GOTO_EQUAL(ret, TASK_PRIO_TEST, ret, EXIT1);
+
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_RwLockDelete(g_testRwLockID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT2:
+    LOS_TaskDelete(g_testTaskID02);
+EXIT1:
+    LOS_RwLockUnlock(g_testRwLockID);
+EXIT:
+    LOS_RwLockDelete(g_testRwLockID);
+    return LOS_OK;
+}
+
+VOID ItLosRwlock003(VOID)
+{
+    TEST_ADD_CASE("ItLosRwlock003", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL1, TEST_FUNCTION);
+}
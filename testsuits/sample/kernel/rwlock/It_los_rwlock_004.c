@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "It_los_rwlock.h"
+
+#define RWLOCK_READ_NUM     LOSCFG_BASE_IPC_RWLOCK_READ_LIMIT
+
+static UINT32 g_otherRwLockID;
+
+static VOID TaskF01(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_RwLockRdLock(g_otherRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    g_testCount++;
+
+    /* A read lock on another lock does not let the task release the one the test task holds. */
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_RWLOCK_INVALID, ret, EXIT1);
+    g_testCount++;
+
+EXIT1:
+    LOS_RwLockUnlock(g_otherRwLockID);
+EXIT:
+    LOS_TaskDelete(g_testTaskID01);
+}
+
+/* With the test lock read-held, the task has room for RWLOCK_READ_NUM - 1 more locks. */
+static UINT32 ReadFullCheck(VOID)
+{
+#if (LOSCFG_BASE_IPC_RWLOCK_LIMIT >= (RWLOCK_READ_NUM + 2)) // 2: the test lock and the other lock
+
+    UINT32 rwlockID[RWLOCK_READ_NUM] = { 0 };
+    UINT32 num;
+    UINT32 ret;
+
+    for (num = 0; num < RWLOCK_READ_NUM; num++) {
+        ret = LOS_RwLockCreate(&rwlockID[num], LOS_RWLOCK_PREFER_READER);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    }
+
+    for (num = 0; num < (RWLOCK_READ_NUM - 1); num++) {
+        ret = LOS_RwLockRdLock(rwlockID[num], LOS_NO_WAIT);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    }
+    ret = LOS_RwLockRdLock(rwlockID[num], LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_RWLOCK_READ_FULL, ret, EXIT);
+
+    /* Taking a held lock again needs no new slot. */
+    ret = LOS_RwLockRdLock(g_testRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    for (num = 0; num < RWLOCK_READ_NUM; num++) {
+        LOS_RwLockUnlock(rwlockID[num]);
+        LOS_RwLockDelete(rwlockID[num]);
+    }
+    return ret;
+#else
+    return LOS_OK;
+#endif
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "TskRwLock4";
+    task1.usTaskPrio = TASK_PRIO_TEST - 1;
+
+    g_testCount = 0;
+
+    ret = LOS_RwLockCreate(&g_testRwLockID, LOS_RWLOCK_PREFER_READER);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_RwLockCreate(&g_otherRwLockID, LOS_RWLOCK_PREFER_READER);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_RwLockRdLock(g_testRwLockID, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT2); // Compare wiht the expected value 2.
+
+    /* The test task holds no read lock on the other lock either. */
+    ret = LOS_RwLockUnlock(g_otherRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_RWLOCK_INVALID, ret, EXIT2);
+
+    ret = ReadFullCheck();
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = LOS_RwLockUnlock(g_testRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    ret = LOS_RwLockDelete(g_otherRwLockID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_RwLockDelete(g_testRwLockID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT2:
+    LOS_RwLockUnlock(g_testRwLockID);
+EXIT1:
+    LOS_RwLockDelete(g_otherRwLockID);
+EXIT:
+    LOS_RwLockDelete(g_testRwLockID);
+    return LOS_OK;
+}
+
+VOID ItLosRwlock004(VOID)
+{
+    TEST_ADD_CASE("ItLosRwlock004", Testcase, TEST_LOS, TEST_MUX, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -63,6 +63,8 @@ VOID ItSuiteLosSem(void)
     ItLosSem031();
 #endif
     ItLosSem032();
+    ItLosSem044();
+    ItLosSem045();
     ItLosSem038();
     ItLosSem040();
     ItLosSem041();
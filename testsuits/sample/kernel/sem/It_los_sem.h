@@ -84,6 +84,7 @@ VOID ItLosSem041(void);
 VOID ItLosSem042(void);
 VOID ItLosSem043(void);
 VOID ItLosSem044(void);
+VOID ItLosSem045(void);
 
 #ifdef __cplusplus
 #if __cplusplus
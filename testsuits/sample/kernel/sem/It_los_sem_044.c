@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_sem.h"
+
+
+#define SEM_BIG_REQUEST   3
+#define SEM_HUGE_REQUEST  5
+#define SEM_PEND_TIMEOUT  10
+
+static UINT32 g_semHandle;
+
+static VOID TaskF01(void)
+{
+    UINT32 ret;
+
+    ret = LOS_SemPendN(g_semHandle, SEM_BIG_REQUEST, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    g_testCount++;
+}
+
+static VOID TaskF02(void)
+{
+    UINT32 ret;
+
+    ret = LOS_SemPendN(g_semHandle, 1, LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_OK, ret);
+    g_testCount++;
+}
+
+static VOID TaskF03(void)
+{
+    UINT32 ret;
+
+    ret = LOS_SemPendN(g_semHandle, SEM_HUGE_REQUEST, SEM_PEND_TIMEOUT);
+    ICUNIT_ASSERT_EQUAL_VOID(ret, LOS_ERRNO_SEM_TIMEOUT, ret);
+    g_testCount++;
+}
+
+static UINT32 CreateTask(UINT32 *taskID, TSK_ENTRY_FUNC func)
+{
+    TSK_INIT_PARAM_S task = { 0 };
+
+    task.pfnTaskEntry = func;
+    task.pcName = "SemTsk044";
+    task.uwStackSize = TASK_STACK_SIZE_TEST;
+    task.usTaskPrio = TASK_PRIO_TEST - 1;
+    return LOS_TaskCreate(taskID, &task);
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 binHandle;
+    INT32 value = 0;
+
+    g_testCount = 0;
+    ret = LOS_BinarySemCreate(0, &binHandle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_SemPendN(binHandle, 2, 0); // 2, more units than a binary semaphore holds.
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SEM_COUNT_INVALID, ret, EXIT1);
+
+    ret = LOS_SemPostN(binHandle, 2); // 2, more units than a binary semaphore holds.
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SEM_OVERFLOW, ret, EXIT1);
+
+    ret = LOS_SemPostN(binHandle, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SEM_COUNT_INVALID, ret, EXIT1);
+
+    ret = LOS_SemCreate(0, &g_semHandle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    /* A large request at the head of the queue keeps the smaller one behind it waiting. */
+    ret = CreateTask(&g_testTaskID01, (TSK_ENTRY_FUNC)TaskF01);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = CreateTask(&g_testTaskID02, (TSK_ENTRY_FUNC)TaskF02);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = LOS_SemPostN(g_semHandle, 2); // 2, fewer units than the head of the queue asks for.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 0, g_testCount, EXIT2);
+
+    ret = LOS_SemPendN(g_semHandle, 1, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SEM_UNAVAILABLE, ret, EXIT2);
+
+    ret = LOS_SemPostN(g_semHandle, 2); // 2, four units now satisfy both waiters.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT2); // 2, both waiters have run.
+
+    ret = LOS_SemGetValue(g_semHandle, &value);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(value, 0, value, EXIT2);
+
+    /* A timed out request at the head hands the units to the waiter behind it. */
+    ret = CreateTask(&g_testTaskID01, (TSK_ENTRY_FUNC)TaskF03);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = CreateTask(&g_testTaskID02, (TSK_ENTRY_FUNC)TaskF02);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = LOS_SemPost(g_semHandle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT2); // 2, nobody has been woken up.
+
+    LOS_TaskDelay(SEM_PEND_TIMEOUT * 2); // 2, wait past the timeout of the head of the queue.
+    ICUNIT_GOTO_EQUAL(g_testCount, 4, g_testCount, EXIT2); // 4, both waiters have run.
+
+EXIT2:
+    (VOID)LOS_TaskDelete(g_testTaskID01);
+    (VOID)LOS_TaskDelete(g_testTaskID02);
+    ret = LOS_SemDelete(g_semHandle);
+    ICUNIT_TRACK_EQUAL(ret, LOS_OK, ret);
+EXIT1:
+    ret = LOS_SemDelete(binHandle);
+    ICUNIT_TRACK_EQUAL(ret, LOS_OK, ret);
+    return LOS_OK;
+}
+
+VOID ItLosSem044(void)
+{
+    TEST_ADD_CASE("ItLosSem044", Testcase, TEST_LOS, TEST_SEM, TEST_LEVEL1, TEST_FUNCTION);
+}
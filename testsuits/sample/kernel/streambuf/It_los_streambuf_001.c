@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "It_los_streambuf.h"
+
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 len;
+    UINT8 storage[STREAMBUF_BASE_SIZE];
+    CHAR buff1[STREAMBUF_BASE_SIZE] = "0123456789abcde";
+    CHAR buff2[STREAMBUF_BASE_SIZE] = "";
+
+    ret = LOS_StreamBufInit(&g_testStreamBuf, storage, 1, 1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_STREAMBUF_SIZE_INVALID, ret);
+
+    ret = LOS_StreamBufInit(&g_testStreamBuf, storage, STREAMBUF_BASE_SIZE, STREAMBUF_BASE_SIZE);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_STREAMBUF_TRIGGER_INVALID, ret);
+
+    ret = LOS_StreamBufInit(&g_testStreamBuf, storage, STREAMBUF_BASE_SIZE, 1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    len = sizeof(buff2);
+    ret = LOS_StreamBufRead(&g_testStreamBuf, buff2, &len, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_STREAMBUF_ISEMPTY, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(len, 0, len, EXIT);
+
+    len = 10; // 10, write part of the data, so that the next write wraps around.
+    ret = LOS_StreamBufWrite(&g_testStreamBuf, buff1, &len, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(len, 10, len, EXIT); // 10, all of the data is written.
+
+    len = 10; // 10, read back all of the data.
+    ret = LOS_StreamBufRead(&g_testStreamBuf, buff2, &len, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(len, 10, len, EXIT); // 10, all of the data is read.
+    ret = memcmp(buff1, buff2, len);
+    ICUNIT_GOTO_EQUAL(ret, 0, ret, EXIT);
+
+    /* Only STREAMBUF_BASE_SIZE - 1 bytes fit, the data wraps around the end of the storage. */
+    len = sizeof(buff1);
+    ret = LOS_StreamBufWrite(&g_testStreamBuf, buff1, &len, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(len, STREAMBUF_BASE_SIZE - 1, len, EXIT);
+    ICUNIT_GOTO_EQUAL(LOS_StreamBufSpaceGet(&g_testStreamBuf), 0, LOS_StreamBufSpaceGet(&g_testStreamBuf), EXIT);
+
+    len = 1;
+    ret = LOS_StreamBufWrite(&g_testStreamBuf, buff1, &len, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_STREAMBUF_ISFULL, ret, EXIT);
+
+    len = sizeof(buff1);
+    ret = LOS_StreamBufWrite(&g_testStreamBuf, buff1, &len, LOS_WAIT_FOREVER);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_STREAMBUF_LEN_TOO_BIG, ret, EXIT);
+
+    (VOID)memset_s(buff2, sizeof(buff2), 0, sizeof(buff2));
+    len = sizeof(buff2);
+    ret = LOS_StreamBufRead(&g_testStreamBuf, buff2, &len, LOS_NO_WAIT);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(len, STREAMBUF_BASE_SIZE - 1, len, EXIT);
+    ret = memcmp(buff1, buff2, len);
+    ICUNIT_GOTO_EQUAL(ret, 0, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(LOS_StreamBufUsedGet(&g_testStreamBuf), 0, LOS_StreamBufUsedGet(&g_testStreamBuf), EXIT);
+
+    ret = LOS_StreamBufDestroy(&g_testStreamBuf);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_StreamBufDestroy(&g_testStreamBuf);
+    return LOS_OK;
+}
+
+VOID ItLosStreambuf001(VOID)
+{
+    TEST_ADD_CASE("ItLosStreambuf001", Testcase, TEST_LOS, TEST_QUE, TEST_LEVEL0, TEST_FUNCTION);
+}
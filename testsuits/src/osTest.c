@@ -108,6 +108,24 @@ void TestKernel(void)
 #if (LOS_KERNEL_IPC_QUEUE_TEST == 1)
     ItSuiteLosQueue();
 #endif
+#if (LOS_KERNEL_IPC_STREAMBUF_TEST == 1)
+    ItSuiteLosStreambuf();
+#endif
+#if (LOS_KERNEL_IPC_QUEUESET_TEST == 1)
+    ItSuiteLosQueueset();
+#endif
+#if (LOS_KERNEL_IPC_RWLOCK_TEST == 1)
+    ItSuiteLosRwlock();
+#endif
+#if (LOS_KERNEL_IPC_CONDVAR_TEST == 1)
+    ItSuiteLosCondvar();
+#endif
+#if (LOS_KERNEL_IPC_BARRIER_TEST == 1)
+    ItSuiteLosBarrier();
+#endif
+#if (LOS_KERNEL_ATOMIC_TEST == 1)
+    ItSuiteLosAtomic();
+#endif
 #if (LOS_KERNEL_IPC_MUX_TEST == 1)
     ItSuiteLosMux();
 #endif
@@ -241,6 +259,30 @@ UINT64 LosCpuCycleGet(VOID)
     timeCycle = LOS_SysCycleGet();
     return timeCycle;
 }
+#elif defined(__linux__)
+VOID TestHwiTrigger(UINT32 hwiNum)
+{
+    (VOID)HalIrqPending(hwiNum);
+}
+
+VOID TestHwiUnTrigger(UINT32 hwiNum)
+{
+    (VOID)HalIrqUnpending(hwiNum);
+}
+
+UINT32 TestHwiDelete(UINT32 hwiNum)
+{
+    UINT32 ret = HalHwiDelete(hwiNum);
+    if (ret != LOS_OK) {
+        return LOS_NOK;
+    }
+    return LOS_OK;
+}
+
+VOID TestHwiClear(UINT32 hwiNum)
+{
+    (VOID)HalIrqUnpending(hwiNum);
+}
 #else
 
 #define OS_NVIC_SETPEND 0xE000E200
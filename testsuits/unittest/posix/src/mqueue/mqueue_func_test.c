@@ -33,6 +33,7 @@
 #include "hctest.h"
 #include <mqueue.h>
 #include <fcntl.h>
+#include "mqueue_ext.h"
 #include "common_test.h"
 
 #define MQUEUE_STANDARD_NAME_LENGTH 50
@@ -508,4 +509,56 @@ LITE_TEST_CASE(MqueueFuncTestSuite, testMqReceiveEAGAIN, Function | MediumTest |
     ICUNIT_TRACK_EQUAL(ret, 0, ret);
 }
 
+/**
+ * @tc.number SUB_KERNEL_IPC_MQ_VARLEN_0100
+ * @tc.name   mq_open with MQ_VARLEN stores messages of their actual length
+ * @tc.desc   [C- SOFTWARE -0200]
+ */
+LITE_TEST_CASE(MqueueFuncTestSuite, testMqVarLen, Function | MediumTest | Level2)
+{
+    mqd_t queue;
+    struct mq_attr attr = {0};
+    struct mq_attr getAttr = {0};
+    char qName[MQ_NAME_LEN], rMsg[MQ_RX_LEN];
+    const int msgNum = 5;  // messages of MQ_MSG_LEN bytes that fill the buffer
+    int i, ret;
+
+    sprintf_s(qName, MQ_NAME_LEN, "testMqVarLen_%d", GetRandom(10000));
+    attr.mq_flags = MQ_VARLEN;
+    attr.mq_msgsize = MQ_MSG_SIZE;
+    attr.mq_maxmsg = msgNum * (MQ_MSG_LEN + sizeof(unsigned short));
+    queue = mq_open(qName, O_CREAT | O_RDWR | O_NONBLOCK, S_IRUSR | S_IWUSR, &attr);
+    ICUNIT_GOTO_NOT_EQUAL(queue, (mqd_t)-1, queue, EXIT);
+
+    for (i = 0; i < msgNum; i++) {
+        ret = mq_send(queue, MQ_MSG, MQ_MSG_LEN, MQ_MSG_PRIO);
+        ICUNIT_TRACK_EQUAL(ret, 0, ret);
+    }
+    ret = mq_send(queue, MQ_MSG, MQ_MSG_LEN, MQ_MSG_PRIO);
+    ICUNIT_TRACK_EQUAL(ret, -1, ret);
+    ICUNIT_TRACK_EQUAL(errno, EAGAIN, errno);
+
+    ret = mq_getattr(queue, &getAttr);
+    ICUNIT_TRACK_EQUAL(ret, 0, ret);
+    ICUNIT_TRACK_EQUAL(getAttr.mq_flags & MQ_VARLEN, MQ_VARLEN, getAttr.mq_flags);
+    ICUNIT_TRACK_EQUAL(getAttr.mq_maxmsg, attr.mq_maxmsg, getAttr.mq_maxmsg);
+    ICUNIT_TRACK_EQUAL(getAttr.mq_msgsize, MQ_MSG_SIZE, getAttr.mq_msgsize);
+    ICUNIT_TRACK_EQUAL(getAttr.mq_curmsgs, msgNum, getAttr.mq_curmsgs);
+
+    for (i = 0; i < msgNum; i++) {
+        ret = mq_receive(queue, rMsg, getAttr.mq_msgsize, NULL);
+        ICUNIT_TRACK_EQUAL(ret, MQ_MSG_LEN, ret);
+        ICUNIT_TRACK_EQUAL(strncmp(MQ_MSG, rMsg, MQ_MSG_LEN), 0, -1);
+    }
+
+    ret = mq_close(queue);
+    ICUNIT_TRACK_EQUAL(ret, 0, ret);
+
+    ret = mq_unlink(qName);
+    ICUNIT_TRACK_EQUAL(ret, 0, ret);
+
+EXIT:
+    return;
+}
+
 RUN_TEST_SUITE(MqueueFuncTestSuite);
@@ -30,11 +30,15 @@
  */
 
 #include "ohos_types.h"
+#include <errno.h>
+#include <time.h>
 #include <securec.h>
 #include "hctest.h"
 #include "los_config.h"
+#include "los_task.h"
 #include "cmsis_os2.h"
 #include "common_test.h"
+#include "pthread_ext.h"
 
 /**
  * @tc.desc      : register a test suite, this suite is used to test basic flow and interface dependency
@@ -72,4 +76,128 @@ LITE_TEST_CASE(PthreadFuncTestSuite, testPthread001, Function | MediumTest | Lev
 {
 };
 
+#if (LOSCFG_BASE_IPC_RWLOCK == 1)
+/**
+ * @tc.number    : SUB_KERNEL_PTHREAD_OPERATION_002
+ * @tc.name      : rwlock shared and exclusive locking
+ * @tc.desc      : [C- SOFTWARE -0200]
+ */
+LITE_TEST_CASE(PthreadFuncTestSuite, testPthreadRwlock001, Function | MediumTest | Level1)
+{
+    pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
+    pthread_rwlockattr_t attr;
+    int pref = -1;
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_rdlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_tryrdlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(EBUSY, pthread_rwlock_trywrlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_unlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_unlock(&rwlock));
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_wrlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(EDEADLK, pthread_rwlock_tryrdlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(EBUSY, pthread_rwlock_destroy(&rwlock));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_unlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_destroy(&rwlock));
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlockattr_init(&attr));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlockattr_getkind_np(&attr, &pref));
+    TEST_ASSERT_EQUAL_INT(PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP, pref);
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_init(&rwlock, &attr));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlockattr_destroy(&attr));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_wrlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_unlock(&rwlock));
+    TEST_ASSERT_EQUAL_INT(0, pthread_rwlock_destroy(&rwlock));
+};
+#endif
+
+/**
+ * @tc.number    : SUB_KERNEL_PTHREAD_OPERATION_003
+ * @tc.name      : cond timed wait and signal without waiters
+ * @tc.desc      : [C- SOFTWARE -0200]
+ */
+LITE_TEST_CASE(PthreadFuncTestSuite, testPthreadCond002, Function | MediumTest | Level1)
+{
+    pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+    pthread_mutex_t mutex;
+    struct timespec absTime = {0};
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_init(&mutex, NULL));
+    TEST_ASSERT_EQUAL_INT(0, pthread_cond_signal(&cond));
+    TEST_ASSERT_EQUAL_INT(0, pthread_cond_broadcast(&cond));
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_lock(&mutex));
+    TEST_ASSERT_EQUAL_INT(0, clock_gettime(CLOCK_REALTIME, &absTime));
+    TEST_ASSERT_EQUAL_INT(ETIMEDOUT, pthread_cond_timedwait(&cond, &mutex, &absTime));
+    absTime.tv_nsec += 20000000; // 20000000, wait for 20 ms.
+    if (absTime.tv_nsec >= 1000000000) { // 1000000000, nanoseconds per second.
+        absTime.tv_sec++;
+        absTime.tv_nsec -= 1000000000; // 1000000000, nanoseconds per second.
+    }
+    TEST_ASSERT_EQUAL_INT(ETIMEDOUT, pthread_cond_timedwait(&cond, &mutex, &absTime));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_unlock(&mutex));
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_cond_destroy(&cond));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_destroy(&mutex));
+};
+
+/**
+ * @tc.number    : SUB_KERNEL_PTHREAD_OPERATION_004
+ * @tc.name      : mutex priority ceiling protocol
+ * @tc.desc      : [C- SOFTWARE -0200]
+ */
+LITE_TEST_CASE(PthreadFuncTestSuite, testPthreadMutexPrioProtect001, Function | MediumTest | Level1)
+{
+    pthread_mutex_t mutex;
+    pthread_mutexattr_t attr;
+    int prio = (int)LOS_TaskPriGet(LOS_CurTaskIDGet());
+    int value = -1;
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutexattr_init(&attr));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutexattr_getprotocol(&attr, &value));
+    TEST_ASSERT_EQUAL_INT(PTHREAD_PRIO_INHERIT, value);
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_PROTECT));
+    TEST_ASSERT_EQUAL_INT(EINVAL, pthread_mutexattr_setprioceiling(&attr, sched_get_priority_min(SCHED_RR) + 1));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutexattr_setprioceiling(&attr, prio - 1));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutexattr_getprioceiling(&attr, &value));
+    TEST_ASSERT_EQUAL_INT(prio - 1, value);
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_init(&mutex, &attr));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutexattr_destroy(&attr));
+
+    /* The owner runs at the ceiling while it holds the mutex. */
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_lock(&mutex));
+    TEST_ASSERT_EQUAL_INT(prio - 1, LOS_TaskPriGet(LOS_CurTaskIDGet()));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_unlock(&mutex));
+    TEST_ASSERT_EQUAL_INT(prio, LOS_TaskPriGet(LOS_CurTaskIDGet()));
+    TEST_ASSERT_EQUAL_INT(0, pthread_mutex_destroy(&mutex));
+};
+
+#if (LOSCFG_BASE_IPC_BARRIER == 1)
+/**
+ * @tc.number    : SUB_KERNEL_PTHREAD_OPERATION_005
+ * @tc.name      : barrier attributes and a barrier released by its only thread
+ * @tc.desc      : [C- SOFTWARE -0200]
+ */
+LITE_TEST_CASE(PthreadFuncTestSuite, testPthreadBarrier001, Function | MediumTest | Level1)
+{
+    pthread_barrier_t barrier;
+    pthread_barrierattr_t attr;
+    int pshared = -1;
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_barrierattr_init(&attr));
+    TEST_ASSERT_EQUAL_INT(0, pthread_barrierattr_getpshared(&attr, &pshared));
+    TEST_ASSERT_EQUAL_INT(PTHREAD_PROCESS_PRIVATE, pshared);
+    TEST_ASSERT_EQUAL_INT(ENOTSUP, pthread_barrierattr_setpshared(&attr, PTHREAD_PROCESS_SHARED));
+    TEST_ASSERT_EQUAL_INT(EINVAL, pthread_barrier_init(&barrier, &attr, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_barrier_init(&barrier, &attr, 1));
+    TEST_ASSERT_EQUAL_INT(0, pthread_barrierattr_destroy(&attr));
+    TEST_ASSERT_EQUAL_INT(PTHREAD_BARRIER_SERIAL_THREAD, pthread_barrier_wait(&barrier));
+    TEST_ASSERT_EQUAL_INT(PTHREAD_BARRIER_SERIAL_THREAD, pthread_barrier_wait(&barrier));
+    TEST_ASSERT_EQUAL_INT(0, pthread_barrier_destroy(&barrier));
+    TEST_ASSERT_EQUAL_INT(EINVAL, pthread_barrier_wait(&barrier));
+};
+#endif
+
 RUN_TEST_SUITE(PthreadFuncTestSuite);
@@ -200,6 +200,11 @@ enum LOS_MODULE_ID {
     LOS_MOD_CPUP             = 0x1e,
     LOS_MOD_HOOK             = 0x1f,
     LOS_MOD_PM               = 0x20,
+    LOS_MOD_STREAMBUF        = 0x21,
+    LOS_MOD_QUEUESET         = 0x22,
+    LOS_MOD_RWLOCK           = 0x23,
+    LOS_MOD_CONDVAR          = 0x24,
+    LOS_MOD_BARRIER          = 0x25,
     LOS_MOD_SHELL            = 0x31,
     LOS_MOD_BUTT
 };